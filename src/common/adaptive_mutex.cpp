@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/adaptive_mutex.h"
+
+#if _MSC_VER
+#include <intrin.h>
+#if _M_AMD64
+#define __x86_64__ 1
+#endif
+#if _M_ARM64
+#define __aarch64__ 1
+#endif
+#else
+#if __x86_64__
+#include <xmmintrin.h>
+#endif
+#endif
+
+namespace {
+
+void ThreadPause() {
+#if __x86_64__
+    _mm_pause();
+#elif __aarch64__ && _MSC_VER
+    __yield();
+#elif __aarch64__
+    asm("yield");
+#endif
+}
+
+std::atomic<u32> spin_budget{1024};
+
+std::mutex stats_registry_mutex;
+std::vector<const Common::AdaptiveSpinMutex*> stats_registry;
+
+} // Anonymous namespace
+
+namespace Common {
+
+u32 GetAdaptiveSpinBudget() {
+    return spin_budget.load(std::memory_order_relaxed);
+}
+
+void SetAdaptiveSpinBudget(u32 budget) {
+    spin_budget.store(budget, std::memory_order_relaxed);
+}
+
+std::vector<MutexStats> GetMutexStats() {
+    std::scoped_lock lock{stats_registry_mutex};
+    std::vector<MutexStats> stats;
+    stats.reserve(stats_registry.size());
+    for (const auto* mutex : stats_registry) {
+        stats.push_back(mutex->GetStats());
+    }
+    return stats;
+}
+
+AdaptiveSpinMutex::AdaptiveSpinMutex(const char* name_) : name{name_} {
+    std::scoped_lock lock{stats_registry_mutex};
+    stats_registry.push_back(this);
+}
+
+void AdaptiveSpinMutex::lock() {
+    num_acquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (impl.try_lock()) [[likely]] {
+        return;
+    }
+
+    num_contended.fetch_add(1, std::memory_order_relaxed);
+    const u32 budget = spin_budget.load(std::memory_order_relaxed);
+    for (u32 i = 0; i < budget; i++) {
+        ThreadPause();
+        if (impl.try_lock()) {
+            return;
+        }
+    }
+
+    num_parked.fetch_add(1, std::memory_order_relaxed);
+    impl.lock();
+}
+
+} // namespace Common
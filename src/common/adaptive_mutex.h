@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <vector>
 #ifdef __linux__
 #include <pthread.h>
 #endif
+#include "common/types.h"
 
 namespace Common {
 
@@ -27,4 +31,58 @@ private:
 };
 #endif // PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
 
+/// Point-in-time counters of one named adaptive mutex, surfaced in devtools.
+struct MutexStats {
+    const char* name;
+    u64 acquisitions;
+    u64 contended;
+    u64 parked;
+};
+
+/// Snapshots the counters of every named AdaptiveSpinMutex.
+std::vector<MutexStats> GetMutexStats();
+
+/// Spin iterations attempted before parking on the OS mutex. Tunable from devtools.
+u32 GetAdaptiveSpinBudget();
+void SetAdaptiveSpinBudget(u32 budget);
+
+/// Portable spin-then-park mutex for short GPU-path critical sections. Under contention the
+/// waiter burns a bounded spin budget before falling back to a blocking lock, avoiding the
+/// context-switch storms std::mutex produces when hold times are shorter than a syscall.
+/// Named instances register contention counters for the devtools lock window and are expected
+/// to live for the remainder of the process.
+class AdaptiveSpinMutex {
+public:
+    explicit AdaptiveSpinMutex(const char* name);
+
+    AdaptiveSpinMutex(const AdaptiveSpinMutex&) = delete;
+    AdaptiveSpinMutex& operator=(const AdaptiveSpinMutex&) = delete;
+
+    void lock();
+
+    void unlock() {
+        impl.unlock();
+    }
+
+    [[nodiscard]] bool try_lock() {
+        return impl.try_lock();
+    }
+
+    MutexStats GetStats() const {
+        return {
+            .name = name,
+            .acquisitions = num_acquisitions.load(std::memory_order_relaxed),
+            .contended = num_contended.load(std::memory_order_relaxed),
+            .parked = num_parked.load(std::memory_order_relaxed),
+        };
+    }
+
+private:
+    std::mutex impl;
+    const char* name;
+    std::atomic<u64> num_acquisitions{};
+    std::atomic<u64> num_contended{};
+    std::atomic<u64> num_parked{};
+};
+
 } // namespace Common
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
+#include <span>
+#include <thread>
 #include "common/polyfill_thread.h"
 
 namespace Common {
@@ -199,50 +202,227 @@ private:
     std::mutex write_mutex;
 };
 
+/// Bounded multi-producer multi-consumer queue after Vyukov: every slot carries a
+/// sequence counter, so producers and consumers claim tickets with a single CAS and
+/// never take a lock on the fast path. The condition variables are only used to put
+/// threads to sleep once spinning failed.
 template <typename T, std::size_t Capacity = detail::DefaultCapacity>
 class MPMCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
 public:
+    MPMCQueue() {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order::relaxed);
+        }
+    }
+
     template <typename... Args>
     bool TryEmplace(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        return spsc_queue.TryEmplace(std::forward<Args>(args)...);
+        std::size_t pos = m_write_index.load(std::memory_order::relaxed);
+        while (true) {
+            Slot& slot = slots[pos % Capacity];
+            const std::size_t seq = slot.sequence.load(std::memory_order::acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                // The slot is free, try to claim the ticket.
+                if (m_write_index.compare_exchange_weak(pos, pos + 1,
+                                                        std::memory_order::relaxed)) {
+                    slot.data = T(std::forward<Args>(args)...);
+                    slot.sequence.store(pos + 1, std::memory_order::release);
+                    std::scoped_lock lock{consumer_cv_mutex};
+                    consumer_cv.notify_one();
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The slot is still occupied by an element Capacity entries behind.
+                return false;
+            } else {
+                pos = m_write_index.load(std::memory_order::relaxed);
+            }
+        }
     }
 
     template <typename... Args>
     void EmplaceWait(Args&&... args) {
-        std::scoped_lock lock{write_mutex};
-        spsc_queue.EmplaceWait(std::forward<Args>(args)...);
+        if (TryEmplace(std::forward<Args>(args)...)) {
+            return;
+        }
+        std::unique_lock lock{producer_cv_mutex};
+        producer_cv.wait(lock, [&] { return TryEmplace(std::forward<Args>(args)...); });
+    }
+
+    /// Claims a run of write tickets with a single compare-exchange and moves that many
+    /// leading elements of in into the queue. Returns the number of elements pushed,
+    /// zero when the queue is full.
+    std::size_t TryPushBatch(std::span<T> in) {
+        std::size_t pos = m_write_index.load(std::memory_order::relaxed);
+        while (!in.empty()) {
+            const std::size_t seq = slots[pos % Capacity].sequence.load(std::memory_order::acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff < 0) {
+                return 0;
+            }
+            if (diff > 0) {
+                pos = m_write_index.load(std::memory_order::relaxed);
+                continue;
+            }
+            // Count how many consecutive slots past the first are also free, then claim
+            // the whole run with one ticket bump.
+            std::size_t run = 1;
+            while (run < in.size() &&
+                   slots[(pos + run) % Capacity].sequence.load(std::memory_order::acquire) ==
+                       pos + run) {
+                ++run;
+            }
+            if (!m_write_index.compare_exchange_weak(pos, pos + run,
+                                                     std::memory_order::relaxed)) {
+                continue;
+            }
+            for (std::size_t i = 0; i < run; ++i) {
+                Slot& slot = slots[(pos + i) % Capacity];
+                slot.data = std::move(in[i]);
+                slot.sequence.store(pos + i + 1, std::memory_order::release);
+            }
+            std::scoped_lock lock{consumer_cv_mutex};
+            consumer_cv.notify_all();
+            return run;
+        }
+        return 0;
+    }
+
+    /// Pushes every element of in, blocking while the queue is full. Elements become
+    /// visible to consumers in order as their slots are filled.
+    void PushBatchWait(std::span<T> in) {
+        while (!in.empty()) {
+            std::size_t pushed = TryPushBatch(in);
+            if (pushed == 0) {
+                std::unique_lock lock{producer_cv_mutex};
+                producer_cv.wait(lock, [&] { return (pushed = TryPushBatch(in)) != 0; });
+            }
+            in = in.subspan(pushed);
+        }
     }
 
     bool TryPop(T& t) {
-        std::scoped_lock lock{read_mutex};
-        return spsc_queue.TryPop(t);
+        std::size_t pos = m_read_index.load(std::memory_order::relaxed);
+        while (true) {
+            Slot& slot = slots[pos % Capacity];
+            const std::size_t seq = slot.sequence.load(std::memory_order::acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_read_index.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed)) {
+                    t = std::move(slot.data);
+                    slot.sequence.store(pos + Capacity, std::memory_order::release);
+                    std::scoped_lock lock{producer_cv_mutex};
+                    producer_cv.notify_one();
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_read_index.load(std::memory_order::relaxed);
+            }
+        }
+    }
+
+    /// Claims a run of read tickets with a single compare-exchange and moves the claimed
+    /// elements into out. Returns the number of elements popped, zero when empty.
+    std::size_t TryPopBatch(std::span<T> out) {
+        std::size_t pos = m_read_index.load(std::memory_order::relaxed);
+        while (!out.empty()) {
+            const std::size_t seq = slots[pos % Capacity].sequence.load(std::memory_order::acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff < 0) {
+                return 0;
+            }
+            if (diff > 0) {
+                pos = m_read_index.load(std::memory_order::relaxed);
+                continue;
+            }
+            std::size_t run = 1;
+            while (run < out.size() &&
+                   slots[(pos + run) % Capacity].sequence.load(std::memory_order::acquire) ==
+                       pos + run + 1) {
+                ++run;
+            }
+            if (!m_read_index.compare_exchange_weak(pos, pos + run, std::memory_order::relaxed)) {
+                continue;
+            }
+            for (std::size_t i = 0; i < run; ++i) {
+                Slot& slot = slots[(pos + i) % Capacity];
+                out[i] = std::move(slot.data);
+                slot.sequence.store(pos + i + Capacity, std::memory_order::release);
+            }
+            std::scoped_lock lock{producer_cv_mutex};
+            producer_cv.notify_all();
+            return run;
+        }
+        return 0;
     }
 
     void PopWait(T& t) {
-        std::scoped_lock lock{read_mutex};
-        spsc_queue.PopWait(t);
+        if (TrySpinPop(t)) {
+            return;
+        }
+        std::unique_lock lock{consumer_cv_mutex};
+        consumer_cv.wait(lock, [&] { return TryPop(t); });
     }
 
     void PopWait(T& t, std::stop_token stop_token) {
-        std::scoped_lock lock{read_mutex};
-        spsc_queue.PopWait(t, stop_token);
+        if (TrySpinPop(t)) {
+            return;
+        }
+        std::unique_lock lock{consumer_cv_mutex};
+        Common::CondvarWait(consumer_cv, lock, stop_token, [&] { return TryPop(t); });
     }
 
     T PopWait() {
-        std::scoped_lock lock{read_mutex};
-        return spsc_queue.PopWait();
+        T t;
+        PopWait(t);
+        return t;
     }
 
     T PopWait(std::stop_token stop_token) {
-        std::scoped_lock lock{read_mutex};
-        return spsc_queue.PopWait(stop_token);
+        T t;
+        PopWait(t, stop_token);
+        return t;
+    }
+
+    /// Approximate element count; racy by nature, intended for status reporting.
+    std::size_t Size() const {
+        const std::size_t read = m_read_index.load(std::memory_order::acquire);
+        const std::size_t write = m_write_index.load(std::memory_order::acquire);
+        return write > read ? write - read : 0;
     }
 
 private:
-    SPSCQueue<T, Capacity> spsc_queue;
-    std::mutex write_mutex;
-    std::mutex read_mutex;
+    bool TrySpinPop(T& t) {
+        for (int spin = 0; spin < 128; ++spin) {
+            if (TryPop(t)) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
+    struct Slot {
+        std::atomic_size_t sequence;
+        T data;
+    };
+
+    alignas(128) std::atomic_size_t m_read_index{0};
+    alignas(128) std::atomic_size_t m_write_index{0};
+
+    std::array<Slot, Capacity> slots;
+
+    std::condition_variable_any producer_cv;
+    std::mutex producer_cv_mutex;
+    std::condition_variable_any consumer_cv;
+    std::mutex consumer_cv_mutex;
 };
 
 } // namespace Common
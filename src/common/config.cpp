@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <fstream>
 #include <map>
 #include <optional>
@@ -55,6 +56,10 @@ std::optional<T> get_optional(const toml::value& v, const std::string& key) {
         if (it->second.is_integer()) {
             return static_cast<u32>(toml::get<unsigned int>(it->second));
         }
+    } else if constexpr (std::is_same_v<T, u64>) {
+        if (it->second.is_integer()) {
+            return static_cast<u64>(toml::get<u64>(it->second));
+        }
     } else if constexpr (std::is_same_v<T, double>) {
         if (it->second.is_floating()) {
             return toml::get<double>(it->second);
@@ -178,14 +183,17 @@ static ConfigEntry<bool> isNullGpu(false);
 static ConfigEntry<bool> shouldCopyGPUBuffers(false);
 static ConfigEntry<int> readbacksMode(GpuReadbacksMode::Disabled);
 static ConfigEntry<bool> readbackLinearImagesEnabled(false);
+static ConfigEntry<bool> textureContentHashEnabled(true);
 static ConfigEntry<bool> directMemoryAccessEnabled(false);
 static ConfigEntry<std::vector<u64>> skipedHashes(std::vector<u64>{});
 static ConfigEntry<bool> shouldDumpShaders(false);
 static ConfigEntry<bool> shouldPatchShaders(false);
 static ConfigEntry<u32> vblankFrequency(60);
+static ConfigEntry<u64> gpuThreadAffinity(0);
 static ConfigEntry<bool> isFullscreen(false);
 static ConfigEntry<string> fullscreenMode("Windowed");
 static ConfigEntry<string> presentMode("Mailbox");
+static ConfigEntry<u32> maxFramesInFlight(2);
 static ConfigEntry<bool> isHDRAllowed(false);
 static ConfigEntry<bool> fsrEnabled(false);
 static ConfigEntry<bool> rcasEnabled(true);
@@ -203,6 +211,7 @@ static ConfigEntry<bool> vkGuestMarkers(false);
 static ConfigEntry<bool> rdocEnable(false);
 static ConfigEntry<bool> pipelineCacheEnable(false);
 static ConfigEntry<bool> pipelineCacheArchive(false);
+static ConfigEntry<bool> asyncShaderCompilation(false);
 
 // Debug
 static ConfigEntry<bool> isDebugDump(false);
@@ -341,6 +350,10 @@ std::string getPresentMode() {
     return presentMode.get();
 }
 
+u32 getMaxFramesInFlight() {
+    return std::clamp(maxFramesInFlight.get(), 1u, 3u);
+}
+
 bool getisTrophyPopupDisabled() {
     return isTrophyPopupDisabled.get();
 }
@@ -453,6 +466,10 @@ bool readbackLinearImages() {
     return readbackLinearImagesEnabled.get();
 }
 
+bool textureContentHash() {
+    return textureContentHashEnabled.get();
+}
+
 bool directMemoryAccess() {
     return directMemoryAccessEnabled.get();
 }
@@ -481,6 +498,10 @@ bool isPipelineCacheArchived() {
     return pipelineCacheArchive.get();
 }
 
+bool getAsyncShaderCompilation() {
+    return asyncShaderCompilation.get();
+}
+
 bool getShowFpsCounter() {
     return showFpsCounter.get();
 }
@@ -500,6 +521,10 @@ u32 vblankFreq() {
     return vblankFrequency.get();
 }
 
+u64 gpuThreadAffinityMask() {
+    return gpuThreadAffinity.get();
+}
+
 bool vkValidationEnabled() {
     return vkValidation.get();
 }
@@ -608,6 +633,10 @@ void setReadbackLinearImages(bool enable, bool is_game_specific) {
     readbackLinearImagesEnabled.set(enable, is_game_specific);
 }
 
+void setTextureContentHash(bool enable, bool is_game_specific) {
+    textureContentHashEnabled.set(enable, is_game_specific);
+}
+
 void setDirectMemoryAccess(bool enable, bool is_game_specific) {
     directMemoryAccessEnabled.set(enable, is_game_specific);
 }
@@ -648,6 +677,10 @@ void setPipelineCacheArchived(bool enable, bool is_game_specific) {
     pipelineCacheArchive.set(enable, is_game_specific);
 }
 
+void setAsyncShaderCompilation(bool enable, bool is_game_specific) {
+    asyncShaderCompilation.set(enable, is_game_specific);
+}
+
 void setVblankFreq(u32 value, bool is_game_specific) {
     vblankFrequency.set(value, is_game_specific);
 }
@@ -664,6 +697,10 @@ void setPresentMode(std::string mode, bool is_game_specific) {
     presentMode.set(mode, is_game_specific);
 }
 
+void setMaxFramesInFlight(u32 value, bool is_game_specific) {
+    maxFramesInFlight.set(value, is_game_specific);
+}
+
 void setisTrophyPopupDisabled(bool disable, bool is_game_specific) {
     isTrophyPopupDisabled.set(disable, is_game_specific);
 }
@@ -958,14 +995,17 @@ void load(const std::filesystem::path& path, bool is_game_specific) {
         shouldCopyGPUBuffers.setFromToml(gpu, "copyGPUBuffers", is_game_specific);
         readbacksMode.setFromToml(gpu, "readbacksMode", is_game_specific);
         readbackLinearImagesEnabled.setFromToml(gpu, "readbackLinearImages", is_game_specific);
+        textureContentHashEnabled.setFromToml(gpu, "textureContentHash", is_game_specific);
         directMemoryAccessEnabled.setFromToml(gpu, "directMemoryAccess", is_game_specific);
         skipedHashes.setFromToml(gpu, "skipShaders", is_game_specific);
         shouldDumpShaders.setFromToml(gpu, "dumpShaders", is_game_specific);
         shouldPatchShaders.setFromToml(gpu, "patchShaders", is_game_specific);
         vblankFrequency.setFromToml(gpu, "vblankFrequency", is_game_specific);
+        gpuThreadAffinity.setFromToml(gpu, "gpuThreadAffinity", is_game_specific);
         isFullscreen.setFromToml(gpu, "Fullscreen", is_game_specific);
         fullscreenMode.setFromToml(gpu, "FullscreenMode", is_game_specific);
         presentMode.setFromToml(gpu, "presentMode", is_game_specific);
+        maxFramesInFlight.setFromToml(gpu, "maxFramesInFlight", is_game_specific);
         isHDRAllowed.setFromToml(gpu, "allowHDR", is_game_specific);
         fsrEnabled.setFromToml(gpu, "fsrEnabled", is_game_specific);
         rcasEnabled.setFromToml(gpu, "rcasEnabled", is_game_specific);
@@ -986,6 +1026,7 @@ void load(const std::filesystem::path& path, bool is_game_specific) {
         rdocEnable.setFromToml(vk, "rdocEnable", is_game_specific);
         pipelineCacheEnable.setFromToml(vk, "pipelineCacheEnable", is_game_specific);
         pipelineCacheArchive.setFromToml(vk, "pipelineCacheArchive", is_game_specific);
+        asyncShaderCompilation.setFromToml(vk, "asyncShaderCompilation", is_game_specific);
     }
 
     string current_version = {};
@@ -1135,12 +1176,15 @@ void save(const std::filesystem::path& path, bool is_game_specific) {
     shouldCopyGPUBuffers.setTomlValue(data, "GPU", "copyGPUBuffers", is_game_specific);
     readbacksMode.setTomlValue(data, "GPU", "readbacksMode", is_game_specific);
     readbackLinearImagesEnabled.setTomlValue(data, "GPU", "readbackLinearImages", is_game_specific);
+    textureContentHashEnabled.setTomlValue(data, "GPU", "textureContentHash", is_game_specific);
     skipedHashes.setTomlValue(data, "GPU", "skipShaders", is_game_specific);
     shouldDumpShaders.setTomlValue(data, "GPU", "dumpShaders", is_game_specific);
     vblankFrequency.setTomlValue(data, "GPU", "vblankFrequency", is_game_specific);
+    gpuThreadAffinity.setTomlValue(data, "GPU", "gpuThreadAffinity", is_game_specific);
     isFullscreen.setTomlValue(data, "GPU", "Fullscreen", is_game_specific);
     fullscreenMode.setTomlValue(data, "GPU", "FullscreenMode", is_game_specific);
     presentMode.setTomlValue(data, "GPU", "presentMode", is_game_specific);
+    maxFramesInFlight.setTomlValue(data, "GPU", "maxFramesInFlight", is_game_specific);
     isHDRAllowed.setTomlValue(data, "GPU", "allowHDR", is_game_specific);
     fsrEnabled.setTomlValue(data, "GPU", "fsrEnabled", is_game_specific);
     rcasEnabled.setTomlValue(data, "GPU", "rcasEnabled", is_game_specific);
@@ -1158,6 +1202,8 @@ void save(const std::filesystem::path& path, bool is_game_specific) {
     rdocEnable.setTomlValue(data, "Vulkan", "rdocEnable", is_game_specific);
     pipelineCacheEnable.setTomlValue(data, "Vulkan", "pipelineCacheEnable", is_game_specific);
     pipelineCacheArchive.setTomlValue(data, "Vulkan", "pipelineCacheArchive", is_game_specific);
+    asyncShaderCompilation.setTomlValue(data, "Vulkan", "asyncShaderCompilation",
+                                        is_game_specific);
 
     isDebugDump.setTomlValue(data, "Debug", "DebugDump", is_game_specific);
     isShaderDebug.setTomlValue(data, "Debug", "CollectShader", is_game_specific);
@@ -1275,6 +1321,7 @@ void setDefaultValues(bool is_game_specific) {
     isFullscreen.set(false, is_game_specific);
     fullscreenMode.set("Windowed", is_game_specific);
     presentMode.set("Mailbox", is_game_specific);
+    maxFramesInFlight.set(2, is_game_specific);
     isHDRAllowed.set(false, is_game_specific);
     fsrEnabled.set(true, is_game_specific);
     rcasEnabled.set(true, is_game_specific);
@@ -1292,6 +1339,7 @@ void setDefaultValues(bool is_game_specific) {
     rdocEnable.set(false, is_game_specific);
     pipelineCacheEnable.set(false, is_game_specific);
     pipelineCacheArchive.set(false, is_game_specific);
+    asyncShaderCompilation.set(false, is_game_specific);
 
     // GS - Debug
     isDebugDump.set(false, is_game_specific);
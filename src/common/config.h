@@ -45,6 +45,8 @@ std::string getFullscreenMode();
 void setFullscreenMode(std::string mode, bool is_game_specific = false);
 std::string getPresentMode();
 void setPresentMode(std::string mode, bool is_game_specific = false);
+u32 getMaxFramesInFlight();
+void setMaxFramesInFlight(u32 value, bool is_game_specific = false);
 u32 getWindowWidth();
 u32 getWindowHeight();
 void setWindowWidth(u32 width, bool is_game_specific = false);
@@ -73,6 +75,8 @@ int getReadbacksMode();
 void setReadbacksMode(int mode, bool is_game_specific = false);
 bool readbackLinearImages();
 void setReadbackLinearImages(bool enable, bool is_game_specific = false);
+bool textureContentHash();
+void setTextureContentHash(bool enable, bool is_game_specific = false);
 bool directMemoryAccess();
 void setDirectMemoryAccess(bool enable, bool is_game_specific = false);
 std::vector<u64> hashesToSkip();
@@ -81,6 +85,7 @@ bool dumpShaders();
 void setDumpShaders(bool enable, bool is_game_specific = false);
 u32 vblankFreq();
 void setVblankFreq(u32 value, bool is_game_specific = false);
+u64 gpuThreadAffinityMask();
 bool getisTrophyPopupDisabled();
 void setisTrophyPopupDisabled(bool disable, bool is_game_specific = false);
 s16 getCursorState();
@@ -104,6 +109,8 @@ void setEnableDiscordRPC(bool enable);
 bool isRdocEnabled();
 bool isPipelineCacheEnabled();
 bool isPipelineCacheArchived();
+bool getAsyncShaderCompilation();
+void setAsyncShaderCompilation(bool enable, bool is_game_specific = false);
 void setRdocEnabled(bool enable, bool is_game_specific = false);
 void setPipelineCacheEnabled(bool enable, bool is_game_specific = false);
 void setPipelineCacheArchived(bool enable, bool is_game_specific = false);
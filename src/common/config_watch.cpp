@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "common/config_watch.h"
+#include "common/logging/log.h"
+#include "common/polyfill_thread.h"
+#include "common/thread.h"
+
+namespace Config {
+
+namespace {
+
+struct Subscriber {
+    u64 handle;
+    WatchField field;
+    WatchCallback callback;
+};
+
+/// Values of the watched fields at one point in time, used to diff across a reload.
+struct Snapshot {
+    std::string present_mode;
+    u32 vblank_freq;
+    int readbacks_mode;
+    bool readback_linear_images;
+    bool dump_shaders;
+
+    static Snapshot Capture() {
+        return {
+            .present_mode = getPresentMode(),
+            .vblank_freq = vblankFreq(),
+            .readbacks_mode = getReadbacksMode(),
+            .readback_linear_images = readbackLinearImages(),
+            .dump_shaders = dumpShaders(),
+        };
+    }
+};
+
+std::mutex subscribers_mutex;
+std::vector<Subscriber> subscribers;
+u64 next_handle = 1;
+std::jthread watch_thread;
+
+void Notify(WatchField field) {
+    std::vector<WatchCallback> callbacks;
+    {
+        std::scoped_lock lock{subscribers_mutex};
+        for (const auto& subscriber : subscribers) {
+            if (subscriber.field == field) {
+                callbacks.push_back(subscriber.callback);
+            }
+        }
+    }
+    for (const auto& callback : callbacks) {
+        callback(field);
+    }
+}
+
+void DiffAndNotify(const Snapshot& before, const Snapshot& after) {
+    if (before.present_mode != after.present_mode) {
+        Notify(WatchField::PresentMode);
+    }
+    if (before.vblank_freq != after.vblank_freq) {
+        Notify(WatchField::VblankFreq);
+    }
+    if (before.readbacks_mode != after.readbacks_mode) {
+        Notify(WatchField::ReadbacksMode);
+    }
+    if (before.readback_linear_images != after.readback_linear_images) {
+        Notify(WatchField::ReadbackLinearImages);
+    }
+    if (before.dump_shaders != after.dump_shaders) {
+        Notify(WatchField::DumpShaders);
+    }
+}
+
+} // namespace
+
+u64 Subscribe(WatchField field, WatchCallback callback) {
+    std::scoped_lock lock{subscribers_mutex};
+    const u64 handle = next_handle++;
+    subscribers.push_back({handle, field, std::move(callback)});
+    return handle;
+}
+
+void Unsubscribe(u64 handle) {
+    std::scoped_lock lock{subscribers_mutex};
+    std::erase_if(subscribers,
+                  [handle](const Subscriber& subscriber) { return subscriber.handle == handle; });
+}
+
+void StartWatch(const std::filesystem::path& path, bool is_game_specific) {
+    StopWatch();
+    watch_thread = std::jthread([path, is_game_specific](std::stop_token stop_token) {
+        Common::SetCurrentThreadName("shadPS4:ConfigWatch");
+
+        std::error_code ec;
+        auto last_write = std::filesystem::last_write_time(path, ec);
+        while (Common::StoppableTimedWait(stop_token, std::chrono::seconds(1))) {
+            const auto current_write = std::filesystem::last_write_time(path, ec);
+            if (ec || current_write == last_write) {
+                continue;
+            }
+            last_write = current_write;
+
+            const auto before = Snapshot::Capture();
+            load(path, is_game_specific);
+            LOG_INFO(Config, "Reloaded config from {}", path.string());
+            DiffAndNotify(before, Snapshot::Capture());
+        }
+    });
+}
+
+void StopWatch() {
+    watch_thread = {};
+}
+
+} // namespace Config
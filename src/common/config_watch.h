@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include "common/types.h"
+
+namespace Config {
+
+/// Config fields whose runtime changes are broadcast by the watch service. Most consumers read
+/// Config:: getters on every use and pick up a reload automatically; fields listed here are the
+/// ones cached by subscribers (swapchain present mode, pacing state) that need an explicit nudge.
+enum class WatchField : u32 {
+    PresentMode,
+    VblankFreq,
+    ReadbacksMode,
+    ReadbackLinearImages,
+    DumpShaders,
+};
+
+using WatchCallback = std::function<void(WatchField)>;
+
+/// Registers a callback for changes of one field. The callback runs on the watch thread after the
+/// new values are already visible through the Config:: getters. Returns a handle for Unsubscribe.
+u64 Subscribe(WatchField field, WatchCallback callback);
+void Unsubscribe(u64 handle);
+
+/// Starts polling the given config file and reloading it in place when it changes on disk.
+/// The is_game_specific flag must match the one the file was originally loaded with.
+void StartWatch(const std::filesystem::path& path, bool is_game_specific = false);
+void StopWatch();
+
+} // namespace Config
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <xxhash.h>
+
 #include "common/types.h"
 
 [[nodiscard]] inline u64 HashCombine(const u64 seed, const u64 hash) {
@@ -11,4 +13,21 @@
 
 [[nodiscard]] inline u32 HashCombine(const u32 seed, const u32 hash) {
     return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/// Hashes up to 16 evenly spaced 256-byte chunks of the buffer, trading exactness for speed
+/// on large inputs. Buffers small enough to be covered completely are hashed in full.
+[[nodiscard]] inline u64 SampledHash(const void* data, const size_t size) {
+    constexpr size_t NumChunks = 16;
+    constexpr size_t ChunkSize = 256;
+    if (size <= NumChunks * ChunkSize) {
+        return XXH3_64bits(data, size);
+    }
+    const auto* bytes = static_cast<const u8*>(data);
+    const size_t stride = (size - ChunkSize) / (NumChunks - 1);
+    u64 hash = size;
+    for (size_t chunk = 0; chunk < NumChunks; ++chunk) {
+        hash = HashCombine(hash, XXH3_64bits(bytes + chunk * stride, ChunkSize));
+    }
+    return hash;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <vector>
 
 #include "common/alignment.h"
@@ -17,6 +18,7 @@
 #include <share.h>
 #include <windows.h>
 #else
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -164,6 +166,12 @@ IOFile::IOFile(IOFile&& other) noexcept {
     std::swap(file_access_mode, other.file_access_mode);
     std::swap(file_type, other.file_type);
     std::swap(file, other.file);
+    std::swap(stream_buffer, other.stream_buffer);
+    std::swap(map_view, other.map_view);
+    std::swap(map_view_size, other.map_view_size);
+#ifdef _WIN64
+    std::swap(map_view_handle, other.map_view_handle);
+#endif
 }
 
 IOFile& IOFile::operator=(IOFile&& other) noexcept {
@@ -171,6 +179,12 @@ IOFile& IOFile::operator=(IOFile&& other) noexcept {
     std::swap(file_access_mode, other.file_access_mode);
     std::swap(file_type, other.file_type);
     std::swap(file, other.file);
+    std::swap(stream_buffer, other.stream_buffer);
+    std::swap(map_view, other.map_view);
+    std::swap(map_view_size, other.map_view_size);
+#ifdef _WIN64
+    std::swap(map_view_handle, other.map_view_handle);
+#endif
     return *this;
 }
 
@@ -210,10 +224,15 @@ void IOFile::Close() {
         return;
     }
 
+    ReleaseMapView();
+
     errno = 0;
 
     const auto close_result = std::fclose(file) == 0;
 
+    // The stream buffer must outlive the stream; release it only after fclose.
+    stream_buffer.reset();
+
     if (!close_result) {
         const auto ec = std::error_code{errno, std::generic_category()};
         LOG_ERROR(Common_Filesystem, "Failed to close the file at path={}, ec_message={}",
@@ -281,6 +300,128 @@ uintptr_t IOFile::GetFileMapping() {
 #endif
 }
 
+bool IOFile::SetBufferSize(size_t size) {
+    if (!IsOpen() || size == 0) {
+        return false;
+    }
+
+    auto buffer = std::make_unique<char[]>(size);
+    if (std::setvbuf(file, buffer.get(), _IOFBF, size) != 0) {
+        return false;
+    }
+    stream_buffer = std::move(buffer);
+    return true;
+}
+
+std::span<const u8> IOFile::MapReadOnly() {
+    if (map_view != nullptr) {
+        return {static_cast<const u8*>(map_view), map_view_size};
+    }
+    if (!IsOpen()) {
+        return {};
+    }
+
+    const u64 size = GetSize();
+    if (size == 0) {
+        return {};
+    }
+
+#ifdef _WIN64
+    HANDLE hfile = reinterpret_cast<HANDLE>(_get_osfhandle(fileno(file)));
+    HANDLE mapping = CreateFileMappingW(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to create file mapping for path={}, error={}",
+                  PathToUTF8String(file_path), Common::GetLastErrorMsg());
+        return {};
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to map view of path={}, error={}",
+                  PathToUTF8String(file_path), Common::GetLastErrorMsg());
+        CloseHandle(mapping);
+        return {};
+    }
+    map_view_handle = std::bit_cast<uintptr_t>(mapping);
+    map_view = view;
+#else
+    void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    if (view == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to mmap path={}, error={}",
+                  PathToUTF8String(file_path), Common::GetLastErrorMsg());
+        return {};
+    }
+    map_view = view;
+#endif
+    map_view_size = size;
+    return {static_cast<const u8*>(map_view), map_view_size};
+}
+
+void IOFile::ReleaseMapView() {
+    if (map_view == nullptr) {
+        return;
+    }
+#ifdef _WIN64
+    UnmapViewOfFile(map_view);
+    CloseHandle(std::bit_cast<HANDLE>(map_view_handle));
+    map_view_handle = 0;
+#else
+    munmap(map_view, map_view_size);
+#endif
+    map_view = nullptr;
+    map_view_size = 0;
+}
+
+s64 IOFile::Pread(void* data, u64 size, u64 offset) const {
+    if (!IsOpen()) {
+        return -1;
+    }
+    // Writes may still sit in the stdio buffer; push them to the OS handle so
+    // the direct read observes them.
+    if (file_access_mode != FileAccessMode::Read) {
+        std::fflush(file);
+    }
+
+    u64 total = 0;
+#ifdef _WIN64
+    const HANDLE hfile = reinterpret_cast<HANDLE>(_get_osfhandle(fileno(file)));
+    while (total < size) {
+        const u64 pos = offset + total;
+        const DWORD to_read = static_cast<DWORD>(std::min<u64>(size - total, 0x7fffffffULL));
+        OVERLAPPED ol{};
+        ol.Offset = static_cast<DWORD>(pos);
+        ol.OffsetHigh = static_cast<DWORD>(pos >> 32);
+        DWORD bytes_read = 0;
+        if (!ReadFile(hfile, static_cast<u8*>(data) + total, to_read, &bytes_read, &ol)) {
+            if (GetLastError() == ERROR_HANDLE_EOF) {
+                break;
+            }
+            return total != 0 ? static_cast<s64>(total) : -1;
+        }
+        if (bytes_read == 0) {
+            break;
+        }
+        total += bytes_read;
+    }
+#else
+    const int fd = fileno(file);
+    while (total < size) {
+        const ssize_t ret = ::pread(fd, static_cast<u8*>(data) + total, size - total,
+                                    static_cast<off_t>(offset + total));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return total != 0 ? static_cast<s64>(total) : -1;
+        }
+        if (ret == 0) {
+            break;
+        }
+        total += ret;
+    }
+#endif
+    return static_cast<s64>(total);
+}
+
 std::string IOFile::ReadString(size_t length) const {
     std::vector<char> string_buffer(length);
 
@@ -5,6 +5,7 @@
 
 #include <cstdio>
 #include <filesystem>
+#include <memory>
 #include <span>
 #include <type_traits>
 
@@ -114,6 +115,14 @@ public:
 
     uintptr_t GetFileMapping();
 
+    /// Opt-in buffered mode: replaces the stdio stream buffer with one of the given size.
+    /// Call right after opening, before any I/O; pays off for many small sequential reads.
+    bool SetBufferSize(size_t size);
+
+    /// Opt-in mapped mode: maps the whole file read-only and returns a span over its contents,
+    /// or an empty span on failure. The mapping is cached and stays valid until Close.
+    std::span<const u8> MapReadOnly();
+
     int Open(const std::filesystem::path& path, FileAccessMode mode,
              FileType type = FileType::BinaryFile,
              FileShareFlag flag = FileShareFlag::ShareReadOnly);
@@ -171,6 +180,11 @@ public:
         return std::fread(data, sizeof(T), size, file);
     }
 
+    /// Reads at an explicit offset directly through the OS handle, bypassing the
+    /// stdio stream: no seek round trips, no stream buffer staging, and the
+    /// stream cursor is left untouched. Returns bytes read or -1 on error.
+    s64 Pread(void* data, u64 size, u64 offset) const;
+
     template <typename T>
     size_t WriteSpan(std::span<const T> data) const {
         static_assert(std::is_trivially_copyable_v<T>, "Data type must be trivially copyable.");
@@ -226,11 +240,20 @@ public:
     std::FILE* file = nullptr;
 
 private:
+    void ReleaseMapView();
+
     std::filesystem::path file_path;
     FileAccessMode file_access_mode{};
     FileType file_type{};
 
     uintptr_t file_mapping = 0;
+
+    std::unique_ptr<char[]> stream_buffer;
+    void* map_view = nullptr;
+    size_t map_view_size = 0;
+#ifdef _WIN64
+    uintptr_t map_view_handle = 0;
+#endif
 };
 
 u64 GetDirectorySize(const std::filesystem::path& path);
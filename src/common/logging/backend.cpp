@@ -2,18 +2,21 @@
 // SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <chrono>
 #include <filesystem>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
+#include <fmt/args.h>
 #include <fmt/format.h>
 
 #ifdef _WIN32
 #include <windows.h> // For OutputDebugStringW
 #endif
 
-#include "common/bounded_threadsafe_queue.h"
 #include "common/config.h"
 #include "common/debug.h"
 #include "common/io_file.h"
@@ -119,6 +122,100 @@ public:
 };
 #endif
 
+/**
+ * A log record whose formatting has been deferred to the backend thread. The format arguments
+ * are captured by value so the producer only pays for the copies, not for fmt parsing.
+ */
+struct DeferredEntry {
+    std::chrono::microseconds timestamp;
+    Class log_class{};
+    Level log_level{};
+    const char* filename = nullptr;
+    u32 line_num = 0;
+    const char* function = nullptr;
+    const char* format = nullptr;
+    fmt::dynamic_format_arg_store<fmt::format_context> args;
+    std::string message; ///< Used instead of format/args when an argument could not be captured
+    std::string thread;
+};
+
+/**
+ * Attempts to copy the format arguments of a log call into an owning store so that formatting
+ * can happen on the backend thread. Returns false when an argument uses a custom formatter,
+ * since such values reference the caller's stack and cannot outlive the call.
+ */
+bool TryCaptureArgs(fmt::dynamic_format_arg_store<fmt::format_context>& store,
+                    const fmt::format_args& args) {
+    using Handle = fmt::basic_format_arg<fmt::format_context>::handle;
+    for (int i = 0;; ++i) {
+        const auto arg = args.get(i);
+        if (!arg) {
+            return true;
+        }
+        bool captured = true;
+        fmt::visit_format_arg(
+            [&]<typename T>(const T& value) {
+                if constexpr (std::is_same_v<T, fmt::monostate>) {
+                    // Exhausted positional arguments.
+                } else if constexpr (std::is_same_v<T, Handle>) {
+                    captured = false;
+                } else if constexpr (std::is_same_v<T, fmt::string_view>) {
+                    store.push_back(std::string{value.data(), value.size()});
+                } else if constexpr (std::is_same_v<T, const char*>) {
+                    store.push_back(std::string{value});
+                } else {
+                    store.push_back(value);
+                }
+            },
+            arg);
+        if (!captured) {
+            return false;
+        }
+    }
+}
+
+/**
+ * Bounded single-producer single-consumer ring owned by one logging thread and drained by the
+ * backend thread. Producers never block or take locks: when the ring is full the record is
+ * dropped and counted, and the backend thread reports the count once it catches up.
+ */
+class SpscRing {
+public:
+    /// Must be a power of two.
+    static constexpr std::size_t Capacity = 512;
+
+    bool TryPush(DeferredEntry&& entry) {
+        const std::size_t tail = write_index.load(std::memory_order_relaxed);
+        if (tail - read_index.load(std::memory_order_acquire) == Capacity) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[tail & (Capacity - 1)] = std::move(entry);
+        write_index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(DeferredEntry& entry) {
+        const std::size_t head = read_index.load(std::memory_order_relaxed);
+        if (head == write_index.load(std::memory_order_acquire)) {
+            return false;
+        }
+        entry = std::move(slots[head & (Capacity - 1)]);
+        read_index.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    u64 TakeDropped() {
+        return dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::array<DeferredEntry, Capacity> slots{};
+    std::atomic<std::size_t> read_index{0};
+    std::atomic<std::size_t> write_index{0};
+    std::atomic<u64> dropped{0};
+};
+
 bool initialization_in_progress_suppress_logging = true;
 
 /**
@@ -189,82 +286,44 @@ public:
             return;
         }
 
-        const auto message = fmt::vformat(format, args);
-
-        // Propagate important log messages to the profiler
-        if (IsProfilerConnected()) {
-            const auto& msg_str = fmt::format("[{}] {}", GetLogClassName(log_class), message);
-            switch (log_level) {
-            case Level::Warning:
-                TRACE_WARN(msg_str);
-                break;
-            case Level::Error:
-                TRACE_ERROR(msg_str);
-                break;
-            case Level::Critical:
-                TRACE_CRIT(msg_str);
-                break;
-            default:
-                break;
-            }
-        }
-
         using std::chrono::duration_cast;
         using std::chrono::microseconds;
         using std::chrono::steady_clock;
 
-        if (Config::groupIdenticalLogs()) {
-            std::unique_lock entry_loc(_mutex);
-
-            if (_last_entry.message == message) {
-                ++_last_entry.counter;
-                return;
-            }
-
-            if (_last_entry.counter >= 2) {
-                _last_entry.message += " x" + std::to_string(_last_entry.counter);
-            }
-
-            if (_last_entry.counter >= 1) {
-                if (Config::getLogType() == "async") {
-                    message_queue.EmplaceWait(_last_entry);
-                } else {
-                    ForEachBackend([this](auto& backend) { backend.Write(this->_last_entry); });
-                    std::fflush(stdout);
-                }
-            }
-
-            this->_last_entry = {
-                .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
-                .log_class = log_class,
-                .log_level = log_level,
-                .filename = filename,
-                .line_num = line_num,
-                .function = function,
-                .message = message,
-                .thread = Common::GetCurrentThreadName(),
-                .counter = 1,
-            };
-        } else {
-            const Entry entry = {
+        if (Config::getLogType() == "async") {
+            DeferredEntry record{
                 .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
                 .log_class = log_class,
                 .log_level = log_level,
                 .filename = filename,
                 .line_num = line_num,
                 .function = function,
-                .message = message,
+                .format = format,
                 .thread = Common::GetCurrentThreadName(),
-                .counter = 1,
             };
-
-            if (Config::getLogType() == "async") {
-                message_queue.EmplaceWait(entry);
-            } else {
-                ForEachBackend([&entry](auto& backend) { backend.Write(entry); });
-                std::fflush(stdout);
+            if (!TryCaptureArgs(record.args, args)) {
+                // Arguments with custom formatters reference the caller's stack; format eagerly.
+                record.format = nullptr;
+                record.message = fmt::vformat(format, args);
             }
+            GetThreadRing().TryPush(std::move(record));
+            return;
         }
+
+        const auto message = fmt::vformat(format, args);
+        PropagateToProfiler(log_class, log_level, message);
+
+        ConsumeEntry({
+            .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
+            .log_class = log_class,
+            .log_level = log_level,
+            .filename = filename,
+            .line_num = line_num,
+            .function = function,
+            .message = message,
+            .thread = Common::GetCurrentThreadName(),
+            .counter = 1,
+        });
     }
 
 private:
@@ -276,50 +335,156 @@ private:
     void StartBackendThread() {
         backend_thread = std::jthread([this](std::stop_token stop_token) {
             Common::SetCurrentThreadName("shadPS4:Log");
-            Entry entry;
-            const auto write_logs = [this, &entry]() {
-                ForEachBackend([&entry](auto& backend) { backend.Write(entry); });
-            };
             while (!stop_token.stop_requested()) {
-                message_queue.PopWait(entry, stop_token);
-                if (entry.filename != nullptr) {
-                    write_logs();
+                if (!DrainThreadRings()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
                 }
             }
-            // Drain the logging queue. Only writes out up to MAX_LOGS_TO_WRITE to prevent a
-            // case where a system is repeatedly spamming logs even on close.
-            int max_logs_to_write = filter.IsDebug() ? std::numeric_limits<s32>::max() : 100;
-            while (max_logs_to_write-- && message_queue.TryPop(entry)) {
-                write_logs();
+            // Drain whatever the producers managed to enqueue before the stop request. The
+            // rings are bounded, so this cannot spin forever on a log-spamming system.
+            while (DrainThreadRings()) {
             }
         });
     }
 
     void StopBackendThread() {
+        backend_thread.request_stop();
+        if (backend_thread.joinable()) {
+            backend_thread.join();
+        }
+
         if (Config::groupIdenticalLogs()) {
             // log last message
-            if (_last_entry.counter >= 2) {
-                _last_entry.message += " x" + std::to_string(_last_entry.counter);
+            std::unique_lock entry_lock(_mutex);
+            FlushGroupedEntry();
+        }
+
+        ForEachBackend([](auto& backend) { backend.Flush(); });
+    }
+
+    /// Returns the calling thread's ring, registering it with the backend thread on first use.
+    /// Rings of exited threads stay registered; threads in the emulator are long-lived enough
+    /// that the bounded leak is preferable to synchronizing unregistration with the drain loop.
+    SpscRing& GetThreadRing() {
+        thread_local std::shared_ptr<SpscRing> ring = [this] {
+            auto new_ring = std::make_shared<SpscRing>();
+            std::scoped_lock lock{ring_registry_mutex};
+            ring_registry.push_back(new_ring);
+            return new_ring;
+        }();
+        return *ring;
+    }
+
+    /// Drains every registered ring once. Returns true if any record was written.
+    bool DrainThreadRings() {
+        std::vector<std::shared_ptr<SpscRing>> rings;
+        {
+            std::scoped_lock lock{ring_registry_mutex};
+            rings = ring_registry;
+        }
+
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        using std::chrono::steady_clock;
+
+        bool drained = false;
+        DeferredEntry record;
+        for (const auto& ring : rings) {
+            while (ring->TryPop(record)) {
+                drained = true;
+                ConsumeDeferred(std::move(record));
+            }
+            if (const u64 dropped = ring->TakeDropped()) {
+                ConsumeEntry({
+                    .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
+                    .log_class = Class::Log,
+                    .log_level = Level::Warning,
+                    .filename = "",
+                    .line_num = 0,
+                    .function = "DrainThreadRings",
+                    .message = fmt::format("Dropped {} log entries due to a full ring buffer",
+                                           dropped),
+                    .thread = "shadPS4:Log",
+                    .counter = 1,
+                });
             }
+        }
+        return drained;
+    }
 
-            if (_last_entry.counter >= 1) {
-                if (Config::getLogType() == "async") {
-                    message_queue.EmplaceWait(_last_entry);
-                } else {
-                    ForEachBackend([this](auto& backend) { backend.Write(this->_last_entry); });
-                    std::fflush(stdout);
-                }
+    /// Formats a deferred record on the backend thread and hands it to the backends.
+    void ConsumeDeferred(DeferredEntry&& record) {
+        Entry entry{
+            .timestamp = record.timestamp,
+            .log_class = record.log_class,
+            .log_level = record.log_level,
+            .filename = record.filename,
+            .line_num = record.line_num,
+            .function = record.function,
+            .message = record.format ? fmt::vformat(record.format, record.args)
+                                     : std::move(record.message),
+            .thread = std::move(record.thread),
+            .counter = 1,
+        };
+        PropagateToProfiler(entry.log_class, entry.log_level, entry.message);
+        ConsumeEntry(std::move(entry));
+    }
+
+    /// Propagate important log messages to the profiler
+    void PropagateToProfiler(Class log_class, Level log_level, const std::string& message) {
+        if (!IsProfilerConnected()) {
+            return;
+        }
+        const auto& msg_str = fmt::format("[{}] {}", GetLogClassName(log_class), message);
+        switch (log_level) {
+        case Level::Warning:
+            TRACE_WARN(msg_str);
+            break;
+        case Level::Error:
+            TRACE_ERROR(msg_str);
+            break;
+        case Level::Critical:
+            TRACE_CRIT(msg_str);
+            break;
+        default:
+            break;
+        }
+    }
+
+    /// Applies identical-message grouping before writing an entry to the backends.
+    void ConsumeEntry(Entry&& entry) {
+        if (Config::groupIdenticalLogs()) {
+            std::unique_lock entry_lock(_mutex);
+
+            if (_last_entry.message == entry.message) {
+                ++_last_entry.counter;
+                return;
             }
 
-            this->_last_entry = {};
+            FlushGroupedEntry();
+            _last_entry = std::move(entry);
+            return;
         }
 
-        backend_thread.request_stop();
-        if (backend_thread.joinable()) {
-            backend_thread.join();
+        WriteEntry(entry);
+    }
+
+    /// Writes the held-back grouped entry, if any. Must be called with _mutex held.
+    void FlushGroupedEntry() {
+        if (_last_entry.counter >= 2) {
+            _last_entry.message += " x" + std::to_string(_last_entry.counter);
         }
 
-        ForEachBackend([](auto& backend) { backend.Flush(); });
+        if (_last_entry.counter >= 1) {
+            WriteEntry(_last_entry);
+        }
+
+        _last_entry = {};
+    }
+
+    void WriteEntry(const Entry& entry) {
+        ForEachBackend([&entry](auto& backend) { backend.Write(entry); });
+        std::fflush(stdout);
     }
 
     void ForEachBackend(auto lambda) {
@@ -344,7 +509,8 @@ private:
     ColorConsoleBackend color_console_backend{};
     FileBackend file_backend;
 
-    MPSCQueue<Entry> message_queue{};
+    std::vector<std::shared_ptr<SpscRing>> ring_registry;
+    std::mutex ring_registry_mutex;
     std::chrono::steady_clock::time_point time_origin{std::chrono::steady_clock::now()};
     std::jthread backend_thread;
     Entry _last_entry;
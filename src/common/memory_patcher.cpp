@@ -3,9 +3,11 @@
 
 #include <algorithm>
 #include <codecvt>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
 #include <pugixml.hpp>
 #include "common/config.h"
@@ -382,29 +384,63 @@ static std::vector<int32_t> PatternToByte(const std::string& pattern) {
 }
 
 uintptr_t PatternScan(const std::string& signature) {
+    // Every mask patch walks the eboot image, and community patch sets run into the
+    // hundreds of entries, so the scans dominate module load time. Resolved signatures
+    // are cached for the lifetime of the process - the module does not move after load
+    // and failed scans will not start succeeding later - and the scan itself jumps
+    // between occurrences of the first fixed byte with memchr instead of testing the
+    // whole pattern at every offset.
+    static std::unordered_map<std::string, uintptr_t> resolved_cache;
+    if (const auto it = resolved_cache.find(signature); it != resolved_cache.end()) {
+        return it->second;
+    }
+
     std::vector<int32_t> patternBytes = PatternToByte(signature);
     const auto scanBytes = static_cast<uint8_t*>((void*)g_eboot_address);
 
     const int32_t* sigPtr = patternBytes.data();
     const size_t sigSize = patternBytes.size();
+    if (sigSize == 0 || sigSize > g_eboot_image_size) {
+        return 0;
+    }
 
-    uint32_t foundResults = 0;
-    for (uint32_t i = 0; i < g_eboot_image_size - sigSize; ++i) {
-        bool found = true;
-        for (uint32_t j = 0; j < sigSize; ++j) {
-            if (scanBytes[i + j] != sigPtr[j] && sigPtr[j] != -1) {
-                found = false;
+    // Anchor on the first non-wildcard byte of the pattern.
+    size_t anchor = 0;
+    while (anchor < sigSize && sigPtr[anchor] == -1) {
+        anchor++;
+    }
+
+    uintptr_t result = 0;
+    if (anchor == sigSize) {
+        // The pattern is all wildcards and trivially matches the image start.
+        result = reinterpret_cast<uintptr_t>(scanBytes);
+    } else {
+        const u8 anchor_byte = static_cast<u8>(sigPtr[anchor]);
+        const size_t last_start = g_eboot_image_size - sigSize;
+        size_t i = anchor;
+        while (i <= last_start + anchor) {
+            const void* hit = std::memchr(scanBytes + i, anchor_byte, last_start + anchor - i + 1);
+            if (hit == nullptr) {
                 break;
             }
-        }
-
-        if (found) {
-            foundResults++;
-            return reinterpret_cast<uintptr_t>(&scanBytes[i]);
+            const size_t start = static_cast<const u8*>(hit) - scanBytes - anchor;
+            bool found = true;
+            for (size_t j = 0; j < sigSize; ++j) {
+                if (sigPtr[j] != -1 && scanBytes[start + j] != sigPtr[j]) {
+                    found = false;
+                    break;
+                }
+            }
+            if (found) {
+                result = reinterpret_cast<uintptr_t>(&scanBytes[start]);
+                break;
+            }
+            i = start + anchor + 1;
         }
     }
 
-    return 0;
+    resolved_cache.emplace(signature, result);
+    return result;
 }
 
 } // namespace MemoryPatcher
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -104,4 +106,85 @@ private:
     size_t new_chunk_size{};
 };
 
+/// Bump allocator for trivially destructible objects. Allocation is a pointer
+/// increment within chunked storage and Reset() reclaims the whole scope in one
+/// shot while keeping the backing chunks alive for reuse.
+class LinearArena {
+public:
+    explicit LinearArena(size_t chunk_size = 64 * 1024) : new_chunk_size{chunk_size} {}
+
+    [[nodiscard]] void* Allocate(size_t size, size_t align) {
+        while (true) {
+            if (current < chunks.size()) {
+                Chunk& chunk = chunks[current];
+                const size_t offset = (chunk.used + align - 1) & ~(align - 1);
+                if (offset + size <= chunk.size) {
+                    chunk.used = offset + size;
+                    return chunk.data.get() + offset;
+                }
+                ++current;
+                continue;
+            }
+            const size_t chunk_size = std::max(new_chunk_size, size + align);
+            chunks.emplace_back(std::make_unique<std::byte[]>(chunk_size), chunk_size);
+        }
+    }
+
+    template <typename T, typename... Args>
+        requires std::is_trivially_destructible_v<T> && std::is_constructible_v<T, Args...>
+    [[nodiscard]] T* Create(Args&&... args) {
+        return std::construct_at(static_cast<T*>(Allocate(sizeof(T), alignof(T))),
+                                 std::forward<Args>(args)...);
+    }
+
+    /// Rewinds every chunk without releasing memory. Nothing destructed, hence the
+    /// trivially-destructible requirement on the contents.
+    void Reset() {
+        for (Chunk& chunk : chunks) {
+            chunk.used = 0;
+        }
+        current = 0;
+    }
+
+private:
+    struct Chunk {
+        explicit Chunk(std::unique_ptr<std::byte[]> data_, size_t size_)
+            : data{std::move(data_)}, size{size_} {}
+
+        std::unique_ptr<std::byte[]> data;
+        size_t size{};
+        size_t used{};
+    };
+
+    std::vector<Chunk> chunks;
+    size_t current{};
+    size_t new_chunk_size{};
+};
+
+/// Minimal STL allocator adaptor over LinearArena; deallocate is a no-op and all
+/// storage is reclaimed by LinearArena::Reset().
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(LinearArena& arena_) noexcept : arena{&arena_} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena{other.arena} {}
+
+    [[nodiscard]] T* allocate(size_t n) {
+        return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& rhs) const noexcept {
+        return arena == rhs.arena;
+    }
+
+    LinearArena* arena;
+};
+
 } // namespace Common
@@ -3,53 +3,101 @@
 
 #pragma once
 
-#include <condition_variable>
-#include <mutex>
+#include <atomic>
+#include "common/types.h"
 
 namespace Common {
 
-// Like std::shared_mutex, but reader has priority over writer.
+// Like std::shared_mutex, but reader has priority over writer. The uncontended reader path is
+// a single atomic operation, so read-mostly users such as the guest memory queries do not
+// serialize on an internal mutex; threads only park when they actually have to wait.
+//
+// Writers additionally maintain a sequence counter so that read-only queries over trivially
+// copyable state can run optimistically: BeginOptimisticRead/ValidateOptimisticRead bracket
+// plain loads with no atomic read-modify-write at all, and a racing writer is detected after
+// the fact so the query can be retried. Only state where a torn read can be thrown away and
+// re-attempted (flat words, no pointer chasing into nodes a writer may free) is eligible.
 class SharedFirstMutex {
+    static constexpr u32 WRITER_BIT = 1u << 31;
+
 public:
     void lock() {
-        std::unique_lock<std::mutex> lock(mtx);
-        cv.wait(lock, [this]() { return !writer_active && readers == 0; });
-        writer_active = true;
+        u32 expected = 0;
+        while (!state.compare_exchange_weak(expected, WRITER_BIT, std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+            state.wait(expected);
+            expected = 0;
+        }
+        BeginWrite();
     }
 
     bool try_lock() {
-        std::lock_guard<std::mutex> lock(mtx);
-        if (writer_active || readers > 0) {
+        u32 expected = 0;
+        if (!state.compare_exchange_strong(expected, WRITER_BIT, std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
             return false;
         }
-        writer_active = true;
+        BeginWrite();
         return true;
     }
 
     void unlock() {
-        std::lock_guard<std::mutex> lock(mtx);
-        writer_active = false;
-        cv.notify_all();
+        // Even again: optimistic readers that overlapped this writer now fail validation.
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        state.store(0, std::memory_order_release);
+        state.notify_all();
+    }
+
+    /// Returns a validation token once no writer is in flight. Bracket plain loads of the
+    /// protected state with this and ValidateOptimisticRead, retrying the whole read whenever
+    /// validation fails.
+    u32 BeginOptimisticRead() const {
+        u32 seq = sequence.load(std::memory_order_acquire);
+        while (seq & 1) {
+            seq = sequence.load(std::memory_order_acquire);
+        }
+        return seq;
+    }
+
+    /// True when no writer ran since the matching BeginOptimisticRead, meaning the loads in
+    /// between observed a consistent snapshot.
+    bool ValidateOptimisticRead(u32 token) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence.load(std::memory_order_relaxed) == token;
     }
 
     void lock_shared() {
-        std::unique_lock<std::mutex> lock(mtx);
-        cv.wait(lock, [this]() { return !writer_active; });
-        ++readers;
+        u32 expected = state.load(std::memory_order_relaxed);
+        while (true) {
+            if (expected & WRITER_BIT) {
+                state.wait(expected);
+                expected = state.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (state.compare_exchange_weak(expected, expected + 1, std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+                return;
+            }
+        }
     }
 
     void unlock_shared() {
-        std::lock_guard<std::mutex> lock(mtx);
-        if (--readers == 0) {
-            cv.notify_all();
+        if (state.fetch_sub(1, std::memory_order_release) == 1) {
+            // Wake any writer waiting for the reader count to drain.
+            state.notify_all();
         }
     }
 
 private:
-    std::mutex mtx;
-    std::condition_variable cv;
-    int readers = 0;
-    bool writer_active = false;
+    // Odd sequence values mark a writer in flight. Only the lock holder mutates the counter,
+    // so plain loads of it within BeginWrite/unlock cannot race.
+    void BeginWrite() {
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    std::atomic<u32> state{};
+    std::atomic<u32> sequence{};
 };
 
 } // namespace Common
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <mutex>
+#include "common/slab_heap.h"
+
+namespace Common {
+
+namespace {
+std::mutex stats_registry_mutex;
+std::vector<std::function<SlabHeapStats()>> stats_registry;
+} // namespace
+
+void RegisterSlabHeapStats(std::function<SlabHeapStats()> getter) {
+    std::scoped_lock lock{stats_registry_mutex};
+    stats_registry.push_back(std::move(getter));
+}
+
+std::vector<SlabHeapStats> GetSlabHeapStats() {
+    std::scoped_lock lock{stats_registry_mutex};
+    std::vector<SlabHeapStats> stats;
+    stats.reserve(stats_registry.size());
+    for (const auto& getter : stats_registry) {
+        stats.push_back(getter());
+    }
+    return stats;
+}
+
+} // namespace Common
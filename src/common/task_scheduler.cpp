@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <fmt/format.h>
+
+#include "common/task_scheduler.h"
+#include "common/thread.h"
+
+namespace Common {
+
+namespace {
+/// Set while a worker runs so Submit can recognize recursive submissions and use the fast path.
+thread_local TaskScheduler* current_scheduler = nullptr;
+thread_local u32 current_worker_index = 0;
+} // namespace
+
+/// Chase-Lev work-stealing deque with the memory orderings from Le et al., "Correct and
+/// Efficient Work-Stealing for Weak Memory Models". The owning worker pushes and pops at the
+/// bottom; thieves take from the top. Fixed capacity — the scheduler falls back to an injection
+/// queue when the deque is full.
+class TaskScheduler::WorkStealingDeque {
+public:
+    /// Must be a power of two.
+    static constexpr s64 Capacity = 1024;
+
+    /// Owner thread only.
+    bool Push(Task* task) {
+        const s64 b = bottom.load(std::memory_order_relaxed);
+        const s64 t = top.load(std::memory_order_acquire);
+        if (b - t >= Capacity) {
+            return false;
+        }
+        slots[b & (Capacity - 1)].store(task, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Owner thread only.
+    Task* Pop() {
+        const s64 b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        s64 t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Task* task = slots[b & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (t != b) {
+            return task;
+        }
+        // Popping the last element races with thieves; the CAS decides who gets it.
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            task = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return task;
+    }
+
+    /// Any thread.
+    Task* Steal() {
+        s64 t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const s64 b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        Task* task = slots[t & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return task;
+    }
+
+private:
+    std::array<std::atomic<Task*>, Capacity> slots{};
+    std::atomic<s64> top{0};
+    std::atomic<s64> bottom{0};
+};
+
+TaskScheduler& TaskScheduler::Instance() {
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+TaskScheduler::TaskScheduler(u32 num_workers) {
+    if (num_workers == 0) {
+        // Leave headroom for the dedicated emulator threads (GPU, presenter, guest) so the
+        // pool does not oversubscribe small host CPUs.
+        num_workers = std::max(std::thread::hardware_concurrency() / 2, 2u);
+    }
+    deques.reserve(num_workers);
+    for (u32 i = 0; i < num_workers; i++) {
+        deques.push_back(std::make_unique<WorkStealingDeque>());
+    }
+    workers.reserve(num_workers);
+    for (u32 i = 0; i < num_workers; i++) {
+        workers.emplace_back(
+            [this, i](std::stop_token token) { WorkerLoop(std::move(token), i); });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    for (auto& worker : workers) {
+        worker.request_stop();
+    }
+    wake_cv.notify_all();
+    workers.clear();
+
+    // Free whatever was still queued when the workers stopped.
+    for (u32 i = 0; i < deques.size(); i++) {
+        while (Task* task = deques[i]->Steal()) {
+            delete task;
+        }
+    }
+    for (auto& queue : injection_queues) {
+        Task* task{};
+        while (queue.TryPop(task)) {
+            delete task;
+        }
+    }
+}
+
+void TaskScheduler::Submit(Task task, TaskPriority priority) {
+    auto* queued_task = new Task(std::move(task));
+    num_queued.fetch_add(1, std::memory_order::acq_rel);
+
+    // Tasks spawned by a running task stay on the owning worker's deque so dependent work
+    // keeps cache locality, and idle workers pick it up by stealing.
+    if (current_scheduler != this || !deques[current_worker_index]->Push(queued_task)) {
+        injection_queues[static_cast<u32>(priority)].EmplaceWait(queued_task);
+    }
+    {
+        // Taking the lock orders the counter increment against the predicate check in
+        // WorkerLoop. Notifying without it can slip between a worker's check and its block,
+        // stranding the task until the next submission.
+        std::scoped_lock lk{wake_mutex};
+    }
+    wake_cv.notify_one();
+}
+
+TaskScheduler::Task* TaskScheduler::TryGetTask(u32 index) {
+    if (Task* task = deques[index]->Pop()) {
+        return task;
+    }
+    for (auto& queue : injection_queues) {
+        Task* task{};
+        if (queue.TryPop(task)) {
+            return task;
+        }
+    }
+    for (u32 offset = 1; offset < deques.size(); offset++) {
+        if (Task* task = deques[(index + offset) % deques.size()]->Steal()) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::WorkerLoop(std::stop_token token, u32 index) {
+    SetCurrentThreadName(fmt::format("shadPS4:Task:{}", index).c_str());
+    current_scheduler = this;
+    current_worker_index = index;
+
+    while (!token.stop_requested()) {
+        if (Task* task = TryGetTask(index)) {
+            num_queued.fetch_sub(1, std::memory_order::acq_rel);
+            (*task)();
+            delete task;
+            continue;
+        }
+        std::unique_lock lk{wake_mutex};
+        wake_cv.wait(lk, token,
+                     [this] { return num_queued.load(std::memory_order::acquire) != 0; });
+    }
+}
+
+} // namespace Common
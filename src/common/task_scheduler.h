@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/bounded_threadsafe_queue.h"
+#include "common/types.h"
+#include "common/unique_function.h"
+
+namespace Common {
+
+enum class TaskPriority : u32 {
+    High = 0,   ///< Latency-sensitive work, e.g. pipeline compiles blocking a draw.
+    Normal = 1, ///< Default for finite jobs.
+    Low = 2,    ///< Background work, e.g. cache serialization and prefetch.
+};
+
+/// Shared work-stealing task scheduler used by video_core and the core libraries for finite
+/// jobs. Each worker owns a Chase-Lev deque; tasks submitted from a worker go to its own deque
+/// and are stolen by idle workers, while external submissions land in per-priority injection
+/// queues. Long-running loops (Liverpool command processing, log draining) keep their dedicated
+/// threads — parking them here would starve the pool.
+class TaskScheduler {
+public:
+    using Task = UniqueFunction<void>;
+
+    /// Process-wide pool sized for the host core count.
+    static TaskScheduler& Instance();
+
+    /// Creates the pool with the requested number of workers, or a count derived from the host
+    /// core count when zero is passed.
+    explicit TaskScheduler(u32 num_workers = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /// Schedules a task for execution on one of the worker threads.
+    void Submit(Task task, TaskPriority priority = TaskPriority::Normal);
+
+    u32 NumWorkers() const noexcept {
+        return static_cast<u32>(workers.size());
+    }
+
+private:
+    class WorkStealingDeque;
+
+    void WorkerLoop(std::stop_token token, u32 index);
+    Task* TryGetTask(u32 index);
+
+private:
+    std::array<MPMCQueue<Task*>, 3> injection_queues;
+    std::vector<std::unique_ptr<WorkStealingDeque>> deques;
+    std::atomic<u64> num_queued{};
+    std::mutex wake_mutex;
+    std::condition_variable_any wake_cv;
+    std::vector<std::jthread> workers;
+};
+
+} // namespace Common
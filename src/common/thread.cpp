@@ -80,59 +80,83 @@ void SetCurrentThreadRealtime(const std::chrono::nanoseconds period_ns) {
 
 #endif
 
+// Finish the last stretch of a sleep with a spin. Kernel timer wakeups routinely
+// land 1-2 ms late, which is enough to make a frame-pacing sleep miss the vblank.
+static constexpr std::chrono::nanoseconds SleepSpinThreshold = std::chrono::microseconds(200);
+
 #ifdef _WIN32
 
-void SetCurrentThreadPriority(ThreadPriority new_priority) {
-    auto handle = GetCurrentThread();
-    int windows_priority = 0;
+static int ToHostPriority(ThreadPriority new_priority) {
     switch (new_priority) {
     case ThreadPriority::Low:
-        windows_priority = THREAD_PRIORITY_BELOW_NORMAL;
-        break;
+        return THREAD_PRIORITY_BELOW_NORMAL;
     case ThreadPriority::Normal:
-        windows_priority = THREAD_PRIORITY_NORMAL;
-        break;
+        return THREAD_PRIORITY_NORMAL;
     case ThreadPriority::High:
-        windows_priority = THREAD_PRIORITY_ABOVE_NORMAL;
-        break;
+        return THREAD_PRIORITY_ABOVE_NORMAL;
     case ThreadPriority::VeryHigh:
-        windows_priority = THREAD_PRIORITY_HIGHEST;
-        break;
+        return THREAD_PRIORITY_HIGHEST;
     case ThreadPriority::Critical:
-        windows_priority = THREAD_PRIORITY_TIME_CRITICAL;
-        break;
+        return THREAD_PRIORITY_TIME_CRITICAL;
     default:
-        windows_priority = THREAD_PRIORITY_NORMAL;
-        break;
+        return THREAD_PRIORITY_NORMAL;
     }
-    SetThreadPriority(handle, windows_priority);
+}
+
+void SetCurrentThreadPriority(ThreadPriority new_priority) {
+    ::SetThreadPriority(GetCurrentThread(), ToHostPriority(new_priority));
+}
+
+void SetThreadPriority(void* thread, ThreadPriority new_priority) {
+    ::SetThreadPriority(thread, ToHostPriority(new_priority));
+}
+
+void SetCurrentThreadAffinity(u64 core_mask) {
+    if (core_mask == 0) {
+        return;
+    }
+    SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(core_mask));
 }
 
 bool AccurateSleep(const std::chrono::nanoseconds duration, std::chrono::nanoseconds* remaining,
                    const bool interruptible) {
     const auto begin_sleep = std::chrono::high_resolution_clock::now();
-
-    LARGE_INTEGER interval{
-        .QuadPart = -1 * (duration.count() / 100u),
-    };
-    HANDLE timer = ::CreateWaitableTimer(NULL, TRUE, NULL);
-    SetWaitableTimer(timer, &interval, 0, NULL, NULL, 0);
-    const auto ret = WaitForSingleObjectEx(timer, INFINITE, interruptible);
-    ::CloseHandle(timer);
+    const auto deadline = begin_sleep + duration;
+
+    bool uninterrupted = true;
+    if (const auto timer_wait = duration - SleepSpinThreshold; timer_wait.count() > 0) {
+        LARGE_INTEGER interval{
+            .QuadPart = -1 * (timer_wait.count() / 100u),
+        };
+        // High-resolution waitable timers are exempt from timer coalescing; fall
+        // back to a regular timer on systems that predate them.
+        HANDLE timer = ::CreateWaitableTimerExW(NULL, NULL,
+                                                CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                                TIMER_ALL_ACCESS);
+        if (timer == NULL) {
+            timer = ::CreateWaitableTimer(NULL, TRUE, NULL);
+        }
+        SetWaitableTimer(timer, &interval, 0, NULL, NULL, 0);
+        uninterrupted = WaitForSingleObjectEx(timer, INFINITE, interruptible) == WAIT_OBJECT_0;
+        ::CloseHandle(timer);
+    }
+    if (uninterrupted) {
+        // Burn the remainder; at this range the scheduler cannot wake us in time.
+        while (std::chrono::high_resolution_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
 
     if (remaining) {
-        const auto end_sleep = std::chrono::high_resolution_clock::now();
-        const auto sleep_time = end_sleep - begin_sleep;
-        *remaining = duration > sleep_time ? duration - sleep_time : std::chrono::nanoseconds(0);
+        const auto now = std::chrono::high_resolution_clock::now();
+        *remaining = deadline > now ? deadline - now : std::chrono::nanoseconds(0);
     }
-    return ret == WAIT_OBJECT_0;
+    return uninterrupted;
 }
 
 #else
 
-void SetCurrentThreadPriority(ThreadPriority new_priority) {
-    pthread_t this_thread = pthread_self();
-
+static sched_param ToHostSchedParam(ThreadPriority new_priority) {
     const auto scheduling_type = SCHED_OTHER;
     s32 max_prio = sched_get_priority_max(scheduling_type);
     s32 min_prio = sched_get_priority_min(scheduling_type);
@@ -144,28 +168,68 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
     } else {
         params.sched_priority = min_prio - ((min_prio - max_prio) * level) / 4;
     }
+    return params;
+}
+
+void SetCurrentThreadPriority(ThreadPriority new_priority) {
+    const auto params = ToHostSchedParam(new_priority);
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &params);
+}
+
+void SetThreadPriority(void* thread, ThreadPriority new_priority) {
+    const auto params = ToHostSchedParam(new_priority);
+    pthread_setschedparam(reinterpret_cast<pthread_t>(thread), SCHED_OTHER, &params);
+}
 
-    pthread_setschedparam(this_thread, scheduling_type, &params);
+void SetCurrentThreadAffinity(u64 core_mask) {
+#ifdef __APPLE__
+    // Explicit thread-to-core binding is not exposed on this platform.
+#else
+    if (core_mask == 0) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (u32 core = 0; core < 64; ++core) {
+        if (core_mask & (1ULL << core)) {
+            CPU_SET(core, &cpu_set);
+        }
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#endif
 }
 
 bool AccurateSleep(const std::chrono::nanoseconds duration, std::chrono::nanoseconds* remaining,
                    const bool interruptible) {
-    timespec request = {
-        .tv_sec = duration.count() / 1'000'000'000,
-        .tv_nsec = duration.count() % 1'000'000'000,
-    };
-    timespec remain;
-    int ret;
-    while ((ret = nanosleep(&request, &remain)) < 0 && errno == EINTR) {
-        if (interruptible) {
-            break;
+    const auto begin_sleep = std::chrono::steady_clock::now();
+    const auto deadline = begin_sleep + duration;
+
+    int ret = 0;
+    if (const auto timer_wait = duration - SleepSpinThreshold; timer_wait.count() > 0) {
+        timespec request = {
+            .tv_sec = timer_wait.count() / 1'000'000'000,
+            .tv_nsec = timer_wait.count() % 1'000'000'000,
+        };
+        timespec remain;
+        while ((ret = nanosleep(&request, &remain)) < 0 && errno == EINTR) {
+            if (interruptible) {
+                break;
+            }
+            request = remain;
+        }
+    }
+    const bool uninterrupted = ret == 0 || errno != EINTR;
+    if (uninterrupted) {
+        // Burn the remainder; at this range the scheduler cannot wake us in time.
+        while (std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
         }
-        request = remain;
     }
     if (remaining) {
-        *remaining = std::chrono::nanoseconds(remain.tv_sec * 1'000'000'000 + remain.tv_nsec);
+        const auto now = std::chrono::steady_clock::now();
+        *remaining = deadline > now ? deadline - now : std::chrono::nanoseconds(0);
     }
-    return ret == 0 || errno != EINTR;
+    return uninterrupted;
 }
 
 #endif
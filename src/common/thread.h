@@ -22,6 +22,11 @@ void SetCurrentThreadRealtime(std::chrono::nanoseconds period_ns);
 
 void SetCurrentThreadPriority(ThreadPriority new_priority);
 
+void SetThreadPriority(void* thread, ThreadPriority new_priority);
+
+/// Pins the current thread to the cores set in the mask. A zero mask leaves it unpinned.
+void SetCurrentThreadAffinity(u64 core_mask);
+
 void SetCurrentThreadName(const char* name);
 
 void SetThreadName(void* thread, const char* name);
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "common/trace_profiler.h"
+
+namespace Common::Profiler {
+
+std::atomic_bool enabled{false};
+
+namespace {
+
+struct ZoneEvent {
+    const char* name;
+    u64 start;
+    u64 end;
+};
+
+/// Per-thread ring of completed zones. Only the owning thread writes; the exporter reads
+/// after recording has been stopped.
+struct ThreadZoneRing {
+    static constexpr size_t Capacity = 1 << 16;
+
+    explicit ThreadZoneRing() : thread_name{GetCurrentThreadName()} {
+        events.resize(Capacity);
+    }
+
+    void Record(const char* name, u64 start, u64 end) {
+        events[write_index & (Capacity - 1)] = {name, start, end};
+        ++write_index;
+    }
+
+    std::vector<ZoneEvent> events;
+    size_t write_index = 0;
+    std::string thread_name;
+};
+
+std::mutex ring_registry_mutex;
+std::vector<std::shared_ptr<ThreadZoneRing>> ring_registry;
+
+ThreadZoneRing& GetThreadRing() {
+    thread_local std::shared_ptr<ThreadZoneRing> ring = [] {
+        auto new_ring = std::make_shared<ThreadZoneRing>();
+        std::scoped_lock lock{ring_registry_mutex};
+        ring_registry.push_back(new_ring);
+        return new_ring;
+    }();
+    return *ring;
+}
+
+} // namespace
+
+void SetEnabled(bool enable) {
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+void RecordZone(const char* name, u64 start, u64 end) {
+    GetThreadRing().Record(name, start, end);
+}
+
+bool Export(const std::filesystem::path& path) {
+    // Stop recording so the rings stay still while we read them. A zone finishing right now
+    // may still land mid-export; a single torn event in a profiling trace is acceptable.
+    SetEnabled(false);
+
+    std::vector<std::shared_ptr<ThreadZoneRing>> rings;
+    {
+        std::scoped_lock lock{ring_registry_mutex};
+        rings = ring_registry;
+    }
+
+    static const u64 tsc_frequency = EstimateRDTSCFrequency();
+
+    // Rebase timestamps so the trace starts near zero.
+    u64 first_start = std::numeric_limits<u64>::max();
+    for (const auto& ring : rings) {
+        const size_t count = std::min(ring->write_index, ThreadZoneRing::Capacity);
+        for (size_t i = 0; i < count; i++) {
+            first_start = std::min(first_start, ring->events[i].start);
+        }
+    }
+    if (first_start == std::numeric_limits<u64>::max()) {
+        return false;
+    }
+
+    FS::IOFile file{path, FS::FileAccessMode::Create, FS::FileType::TextFile};
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    const auto to_us = [](u64 ticks) {
+        return static_cast<double>(ticks) * 1e6 / static_cast<double>(tsc_frequency);
+    };
+
+    file.WriteString(std::string_view{"{\"traceEvents\":[\n"});
+    bool first_event = true;
+    u32 tid = 0;
+    for (const auto& ring : rings) {
+        ++tid;
+        file.WriteString(fmt::format(
+            "{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{"
+            "\"name\":\"{}\"}}}}",
+            first_event ? "" : ",\n", tid, ring->thread_name));
+        first_event = false;
+
+        const size_t count = std::min(ring->write_index, ThreadZoneRing::Capacity);
+        for (size_t i = 0; i < count; i++) {
+            const auto& event = ring->events[i];
+            file.WriteString(fmt::format(
+                ",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},"
+                "\"dur\":{:.3f}}}",
+                event.name, tid, to_us(event.start - first_start),
+                to_us(event.end - event.start)));
+        }
+    }
+    file.WriteString(std::string_view{"\n]}\n"});
+
+    LOG_INFO(Common, "Exported profiler trace to {}", path.string());
+    return true;
+}
+
+} // namespace Common::Profiler
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include "common/rdtsc.h"
+#include "common/types.h"
+
+namespace Common::Profiler {
+
+/// Always-compiled scoped profiler for cabinets where a Tracy client cannot attach. Zones are
+/// timestamped with raw TSC reads into per-thread rings and exported on demand as a Chrome
+/// trace-event JSON file, which Perfetto and chrome://tracing load directly. Recording is a
+/// couple of TSC reads and a ring store, so the macros can stay on hot paths permanently.
+
+extern std::atomic_bool enabled;
+
+inline bool IsEnabled() {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+/// Starts or stops zone recording. The rings keep the most recent window per thread.
+void SetEnabled(bool enable);
+
+/// Records a completed zone on the calling thread's ring. Prefer PROFILE_SCOPE.
+void RecordZone(const char* name, u64 start, u64 end);
+
+/// Writes all recorded zones to a Chrome trace-event JSON file. Stops recording first;
+/// returns false if nothing was recorded or the file could not be written.
+bool Export(const std::filesystem::path& path);
+
+class ScopedZone {
+public:
+    explicit ScopedZone(const char* name_) : name{name_} {
+        if (IsEnabled()) {
+            start = FencedRDTSC();
+        }
+    }
+
+    ~ScopedZone() {
+        if (start != 0) {
+            RecordZone(name, start, FencedRDTSC());
+        }
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    const char* name;
+    u64 start = 0;
+};
+
+} // namespace Common::Profiler
+
+#define PROFILE_SCOPE_CAT2(a, b) a##b
+#define PROFILE_SCOPE_CAT(a, b) PROFILE_SCOPE_CAT2(a, b)
+#define PROFILE_SCOPE(name)                                                                        \
+    ::Common::Profiler::ScopedZone PROFILE_SCOPE_CAT(profile_zone_, __LINE__) {                    \
+        name                                                                                       \
+    }
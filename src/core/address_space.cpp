@@ -700,6 +700,11 @@ struct AddressSpace::Impl {
             LOG_CRITICAL(Kernel_Vmm, "mmap failed: {}", strerror(errno));
             throw std::bad_alloc{};
         }
+#ifndef __APPLE__
+        // The dmem backing is shared memory and is not covered by the placeholder advice
+        // above; without this the guest heap stays on 4K TLB entries.
+        madvise(backing_base, BackingSize, MADV_HUGEPAGE);
+#endif
     }
 
     void* Map(VAddr virtual_addr, PAddr phys_addr, u64 size, PosixPageProtection prot,
@@ -711,6 +716,11 @@ struct AddressSpace::Impl {
         void* ret = mmap(reinterpret_cast<void*>(virtual_addr), size, prot, MAP_FIXED | flag,
                          handle, host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+#ifndef __APPLE__
+        // A fixed remap replaces the placeholder VMA and drops its hugepage advice with it,
+        // so the advice has to be re-applied to every guest mapping.
+        madvise(ret, size, MADV_HUGEPAGE);
+#endif
         return ret;
     }
 
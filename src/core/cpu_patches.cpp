@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -82,11 +85,12 @@ static bool FilterTcbAccess(const ZydisDecodedOperand* operands) {
     const auto& dst_op = operands[0];
     const auto& src_op = operands[1];
 
-    // Patch only 'mov (64-bit register), fs:[0]'
+    // Patch 'mov (64-bit register), fs:[disp]' for any displacement; the stack canary
+    // entry listed before this one claims fs:[0x28] first. Base and index registers are
+    // not accepted since the Windows sequence needs the destination as scratch.
     return src_op.type == ZYDIS_OPERAND_TYPE_MEMORY && src_op.mem.segment == ZYDIS_REGISTER_FS &&
            src_op.mem.base == ZYDIS_REGISTER_NONE && src_op.mem.index == ZYDIS_REGISTER_NONE &&
-           src_op.mem.disp.value == 0 && dst_op.reg.value >= ZYDIS_REGISTER_RAX &&
-           dst_op.reg.value <= ZYDIS_REGISTER_R15;
+           dst_op.reg.value >= ZYDIS_REGISTER_RAX && dst_op.reg.value <= ZYDIS_REGISTER_R15;
 }
 
 static void GenerateTcbAccess(void* /* address */, const ZydisDecodedOperand* operands,
@@ -114,6 +118,12 @@ static void GenerateTcbAccess(void* /* address */, const ZydisDecodedOperand* op
         // Load the pointer to our buffer.
         c.mov(dst, qword[dst + tls_index * sizeof(LPVOID)]);
     }
+
+    // The slot holds the TCB base, which doubles as the guest's fs:[0] self pointer.
+    // Any other displacement needs the actual load relative to that base.
+    if (const s64 disp = operands[1].mem.disp.value; disp != 0) {
+        c.mov(dst, qword[dst + static_cast<s32>(disp)]);
+    }
 #else
     const auto src = ZydisToXbyakMemoryOperand(operands[1]);
 
@@ -503,6 +513,14 @@ struct PatchModule {
     /// Tracker for patched code locations.
     std::set<u8*> patched;
 
+    /// Lock-free mirror of `patched`, probed by the signal handlers before taking the
+    /// mutex so faults at already-patched sites do not serialize behind in-flight patches.
+    /// Sites are only ever added; a probe that hits is therefore authoritative, a miss
+    /// falls back to the mutex-protected set.
+    static constexpr size_t PatchedCacheCapacity = 8192; // must be a power of two
+    static constexpr size_t MaxProbes = 16;
+    std::array<std::atomic<u64>, PatchedCacheCapacity> patched_cache{};
+
     /// Code generator for patching the module.
     Xbyak::CodeGenerator patch_gen;
 
@@ -513,6 +531,39 @@ struct PatchModule {
                 const u64 trampoline_size)
         : start(module_ptr), end(module_ptr + module_size), patch_gen(module_size, module_ptr),
           trampoline_gen(trampoline_size, trampoline_ptr) {}
+
+    static size_t CacheSlot(const u64 addr) {
+        // Fibonacci hash, keeping the top bits which mix best.
+        return (addr * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(PatchedCacheCapacity));
+    }
+
+    bool IsCachedPatched(const u8* code) const {
+        const u64 addr = reinterpret_cast<u64>(code);
+        for (size_t probe = 0; probe < MaxProbes; ++probe) {
+            const u64 entry = patched_cache[(CacheSlot(addr) + probe) & (PatchedCacheCapacity - 1)]
+                                  .load(std::memory_order_acquire);
+            if (entry == addr) {
+                return true;
+            }
+            if (entry == 0) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void CachePatched(const u8* code) {
+        const u64 addr = reinterpret_cast<u64>(code);
+        for (size_t probe = 0; probe < MaxProbes; ++probe) {
+            auto& entry = patched_cache[(CacheSlot(addr) + probe) & (PatchedCacheCapacity - 1)];
+            u64 expected = 0;
+            if (entry.compare_exchange_strong(expected, addr, std::memory_order_release) ||
+                expected == addr) {
+                return;
+            }
+        }
+        // This neighborhood is full; the mutex-protected set remains authoritative.
+    }
 };
 static std::map<u64, PatchModule> modules;
 
@@ -579,6 +630,7 @@ static std::pair<bool, u64> TryPatch(u8* code, PatchModule* module) {
                     patch_gen.nop(instruction.length - patch_size);
 
                     module->patched.insert(code);
+                    module->CachePatched(code);
                     LOG_DEBUG(Core, "Patched instruction '{}' at: {}",
                               ZydisMnemonicGetString(instruction.mnemonic), fmt::ptr(code));
                     return std::make_pair(true, instruction.length);
@@ -747,10 +799,16 @@ static bool TryPatchJit(void* code_address) {
         return false;
     }
 
+    // Fast path for sites some thread already finished patching; faults raised just before
+    // the patch bytes landed resolve without serializing behind the module mutex.
+    if (module->IsCachedPatched(code)) {
+        return true;
+    }
+
     std::unique_lock lock{module->mutex};
 
     // Return early if already patched, in case multiple threads signaled at the same time.
-    if (std::ranges::find(module->patched, code) != module->patched.end()) {
+    if (module->patched.contains(code)) {
         return true;
     }
 
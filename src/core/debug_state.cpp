@@ -1,11 +1,17 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+
 #include <imgui.h>
+#include <zlib.h>
 
 #include "common/assert.h"
+#include "common/hash.h"
+#include "common/io_file.h"
 #include "common/native_clock.h"
 #include "common/singleton.h"
+#include "common/task_scheduler.h"
 #include "core/signals.h"
 #include "debug_state.h"
 #include "devtools/widget/common.h"
@@ -207,6 +213,116 @@ void DebugStateImpl::PushRegsDumpCompute(uintptr_t base_addr, uintptr_t header_a
     };
 }
 
+void DebugStateImpl::SetContinuousCapture(bool enabled) {
+    continuous_capture_enabled.store(enabled, std::memory_order_relaxed);
+    if (!enabled) {
+        std::scoped_lock lock{capture_ring_mutex};
+        capture_pending_frame = {};
+        capture_ring.clear();
+        capture_blob_cache.clear();
+    }
+}
+
+void DebugStateImpl::PushCaptureSubmit(QueueType type, u32 submit_num, u32 num2,
+                                       std::span<const u32> data, uintptr_t base_addr) {
+    if (data.empty()) {
+        return;
+    }
+    const u64 hash = XXH3_64bits(data.data(), data.size_bytes());
+
+    std::shared_ptr<CapturedBlob> blob;
+    {
+        std::scoped_lock lock{capture_ring_mutex};
+        if (const auto it = capture_blob_cache.find(hash); it != capture_blob_cache.end()) {
+            blob = it->second.lock();
+        }
+        if (blob) {
+            // Unchanged since an earlier frame; share the existing blob instead of copying.
+            capture_pending_frame.submits.push_back(
+                {type, submit_num, num2, base_addr, hash, std::move(blob)});
+            return;
+        }
+        blob = std::make_shared<CapturedBlob>();
+        capture_blob_cache[hash] = blob;
+        capture_pending_frame.submits.push_back({type, submit_num, num2, base_addr, hash, blob});
+    }
+
+    // The raw copy is the only synchronous cost; deflate runs on a background worker.
+    std::vector<u8> raw(data.size_bytes());
+    std::memcpy(raw.data(), data.data(), data.size_bytes());
+    Common::TaskScheduler::Instance().Submit(
+        [blob = std::move(blob), raw = std::move(raw)]() mutable {
+            const size_t uncompressed_size = raw.size();
+            uLongf compressed_size = compressBound(static_cast<uLong>(raw.size()));
+            std::vector<u8> compressed(compressed_size);
+            if (compress2(compressed.data(), &compressed_size, raw.data(),
+                          static_cast<uLong>(raw.size()), Z_BEST_SPEED) == Z_OK &&
+                compressed_size < raw.size()) {
+                compressed.resize(compressed_size);
+                blob->compressed = std::move(compressed);
+            } else {
+                // Incompressible or deflate failure; store verbatim.
+                blob->compressed = std::move(raw);
+            }
+            blob->uncompressed_size = uncompressed_size;
+            blob->ready.store(true, std::memory_order_release);
+        },
+        Common::TaskPriority::Low);
+}
+
+void DebugStateImpl::RotateCaptureFrame() {
+    std::scoped_lock lock{capture_ring_mutex};
+    if (capture_pending_frame.submits.empty()) {
+        return;
+    }
+    capture_pending_frame.frame_id = gnm_frame_count.load();
+    capture_ring.push_back(std::move(capture_pending_frame));
+    capture_pending_frame = {};
+    while (capture_ring.size() > NumCaptureRingFrames) {
+        capture_ring.pop_front();
+    }
+    // Drop cache entries whose blobs died with the evicted frames.
+    std::erase_if(capture_blob_cache, [](const auto& entry) { return entry.second.expired(); });
+}
+
+bool DebugStateImpl::ExportCaptureRing(const std::filesystem::path& path) {
+    std::scoped_lock lock{capture_ring_mutex};
+    if (capture_ring.empty()) {
+        return false;
+    }
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Create};
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    static constexpr char magic[8] = {'S', 'P', '4', 'C', 'A', 'P', '0', '1'};
+    file.WriteRaw<char>(magic, sizeof(magic));
+    const u32 num_frames = static_cast<u32>(capture_ring.size());
+    file.WriteObject(num_frames);
+    for (const auto& frame : capture_ring) {
+        file.WriteObject(frame.frame_id);
+        file.WriteObject(static_cast<u32>(frame.submits.size()));
+        for (const auto& submit : frame.submits) {
+            file.WriteObject(static_cast<u32>(submit.type));
+            file.WriteObject(submit.submit_num);
+            file.WriteObject(submit.num2);
+            file.WriteObject(static_cast<u64>(submit.base_addr));
+            file.WriteObject(submit.hash);
+            if (submit.blob->ready.load(std::memory_order_acquire)) {
+                file.WriteObject(static_cast<u64>(submit.blob->uncompressed_size));
+                file.WriteObject(static_cast<u64>(submit.blob->compressed.size()));
+                file.WriteRaw<u8>(submit.blob->compressed.data(), submit.blob->compressed.size());
+            } else {
+                // Compression has not caught up; record an empty payload for this submit.
+                file.WriteObject(u64{0});
+                file.WriteObject(u64{0});
+            }
+        }
+    }
+    return true;
+}
+
 void DebugStateImpl::CollectShader(const std::string& name, Shader::LogicalStage l_stage,
                                    vk::ShaderModule module, std::span<const u32> spv,
                                    std::span<const u32> raw_code, std::span<const u32> patch_spv,
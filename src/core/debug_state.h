@@ -3,9 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -30,8 +38,13 @@ using ThreadID = pthread_t;
 namespace Core::Devtools {
 class Layer;
 namespace Widget {
+class CompileProfiler;
+class ComputeStats;
 class FrameGraph;
+class MemopProfiler;
+class GpuProfiler;
 class ShaderList;
+class TextureStats;
 } // namespace Widget
 } // namespace Core::Devtools
 
@@ -81,6 +94,30 @@ struct FrameDump {
     std::unordered_map<uintptr_t, RegDump> regs; // address -> reg dump
 };
 
+/// Compressed payload of one captured command buffer, shared between every frame that
+/// submitted identical data. Filled by a background task; readers must check ready first.
+/// A blob whose compressed size equals its uncompressed size is stored verbatim.
+struct CapturedBlob {
+    std::atomic_bool ready{false};
+    size_t uncompressed_size{};
+    std::vector<u8> compressed;
+};
+
+/// One submit recorded by the continuous frame capture.
+struct CapturedSubmit {
+    QueueType type;
+    u32 submit_num;
+    u32 num2;
+    uintptr_t base_addr;
+    u64 hash;
+    std::shared_ptr<CapturedBlob> blob;
+};
+
+struct CapturedFrame {
+    u32 frame_id;
+    std::vector<CapturedSubmit> submits;
+};
+
 struct ShaderDump {
     std::string name;
     Shader::LogicalStage l_stage;
@@ -130,10 +167,114 @@ struct ShaderDump {
     }
 };
 
+/// Accumulated GPU time of one timing zone kind, fed by the scheduler query profiler.
+struct GpuZoneStat {
+    u32 count{};
+    float total_ms{};
+    float max_ms{};
+    float last_ms{};
+};
+
+/// Per-program compute dispatch activity, for ranking HLE candidates.
+struct ComputeShaderStat {
+    u32 dispatches{};
+    u32 gpu_samples{};
+    float total_ms{};
+    float max_ms{};
+    bool hle{};
+};
+
+/// One texture-cache image touched during the last frame, for the usage heatmap.
+struct TextureFrameStat {
+    u64 guest_address;
+    u64 guest_size;
+    u32 width;
+    u32 height;
+    std::string format;
+    u32 binds;
+    u64 upload_bytes;
+    u64 detile_ns;
+};
+
+/// Aggregated texture-cache activity of the last completed frame.
+struct TextureFrameStats {
+    u32 total_images;
+    u32 evictions;
+    u32 total_binds;
+    u64 total_upload_bytes;
+    u64 total_detile_ns;
+    std::vector<TextureFrameStat> images;
+};
+
+/// Accumulated timing and IR size impact of one recompiler pass across all translations.
+struct PassStat {
+    u32 count{};
+    u32 no_change_runs{}; ///< Runs that left the instruction count unchanged
+    float total_ms{};
+    float max_ms{};
+    s64 inst_delta{};
+};
+
+/// Histogram of guest libc memory-routine sizes with power-of-two byte buckets.
+/// Counters are atomic so guest threads can record without taking a lock.
+struct MemopHistogram {
+    static constexpr u32 NumBuckets = 20;
+    static constexpr u64 FirstBucketBytes = 16;
+
+    std::array<std::atomic<u64>, NumBuckets> buckets{};
+    std::atomic<u64> count{};
+    std::atomic<u64> total_bytes{};
+
+    void Add(u64 bytes) {
+        u32 bucket = 0;
+        for (u64 limit = FirstBucketBytes; bucket < NumBuckets - 1 && bytes > limit; limit *= 2) {
+            ++bucket;
+        }
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void Reset() {
+        for (auto& bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_relaxed);
+        total_bytes.store(0, std::memory_order_relaxed);
+    }
+};
+
+/// Histogram of shader/pipeline compile durations with power-of-two millisecond buckets.
+struct CompileHistogram {
+    static constexpr u32 NumBuckets = 16;
+    static constexpr float FirstBucketMs = 0.125f;
+
+    std::array<u32, NumBuckets> buckets{};
+    u32 count{};
+    float total_ms{};
+    float max_ms{};
+
+    void Add(float ms) {
+        u32 bucket = 0;
+        for (float limit = FirstBucketMs; bucket < NumBuckets - 1 && ms >= limit; limit *= 2.0f) {
+            ++bucket;
+        }
+        ++buckets[bucket];
+        ++count;
+        total_ms += ms;
+        max_ms = std::max(max_ms, ms);
+    }
+};
+
 class DebugStateImpl {
     friend class Core::Devtools::Layer;
+    friend class Core::Devtools::Widget::CompileProfiler;
+    friend class Core::Devtools::Widget::ComputeStats;
     friend class Core::Devtools::Widget::FrameGraph;
+    friend class Core::Devtools::Widget::GpuProfiler;
+    friend class Core::Devtools::Widget::MemopProfiler;
     friend class Core::Devtools::Widget::ShaderList;
+    friend class Core::Devtools::Widget::TextureStats;
 
     std::queue<std::string> debug_message_popup;
 
@@ -154,8 +295,43 @@ class DebugStateImpl {
     std::shared_mutex frame_dump_list_mutex;
     std::vector<FrameDump> frame_dump_list{};
 
+    // Continuous frame capture: ring of the last frames' command streams, deduplicated by
+    // content hash and compressed on the task scheduler
+    std::atomic_bool continuous_capture_enabled = false;
+    std::mutex capture_ring_mutex;
+    CapturedFrame capture_pending_frame{};
+    std::deque<CapturedFrame> capture_ring;
+    std::unordered_map<u64, std::weak_ptr<CapturedBlob>> capture_blob_cache;
+
     std::vector<ShaderDump> shader_dump_list{};
 
+    // Compile telemetry, written by the GPU thread and the pipeline compile workers
+    std::mutex compile_time_mutex;
+    CompileHistogram translate_times{};
+    CompileHistogram ir_pass_times{};
+    CompileHistogram spirv_emit_times{};
+    CompileHistogram pipeline_create_times{};
+    std::map<std::string, PassStat> pass_stats;
+
+    // Guest libc memory-routine telemetry, written by guest threads when enabled
+    std::atomic_bool memop_profiling_enabled = false;
+    MemopHistogram memcpy_sizes{};
+    MemopHistogram memset_sizes{};
+
+    // GPU pass timings, written by the GPU thread when it resolves timestamp queries
+    std::atomic_bool gpu_zone_profiling_enabled = false;
+    std::mutex gpu_zone_mutex;
+    std::map<std::string, GpuZoneStat> gpu_zone_stats;
+
+    // Per-program compute dispatch stats, collected while GPU zone profiling is enabled
+    std::mutex compute_stats_mutex;
+    std::map<u64, ComputeShaderStat> compute_shader_stats;
+
+    // Texture-cache usage heatmap, published once per frame by the GPU thread
+    std::atomic_bool texture_stats_enabled = false;
+    std::mutex texture_stats_mutex;
+    TextureFrameStats texture_stats{};
+
 public:
     float Framerate = 1.0f / 60.0f;
     float FrameDeltaTime;
@@ -194,6 +370,9 @@ public:
     void IncGnmFrameNum() {
         ++gnm_frame_count;
         --gnm_frame_dump_request_count;
+        if (IsContinuousCaptureEnabled()) {
+            RotateCaptureFrame();
+        }
     }
 
     u32 GetFrameNum() const {
@@ -221,10 +400,99 @@ public:
 
     void PushQueueDump(QueueDump dump);
 
+    /// Number of frames the continuous capture ring retains.
+    static constexpr size_t NumCaptureRingFrames = 8;
+
+    bool IsContinuousCaptureEnabled() const {
+        return continuous_capture_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Toggles continuous capture; disabling drops the ring and the blob cache.
+    void SetContinuousCapture(bool enabled);
+
+    /// Records one submitted command buffer into the pending capture frame. Unchanged buffers
+    /// are shared by content hash, new ones are copied once and compressed in the background.
+    void PushCaptureSubmit(QueueType type, u32 submit_num, u32 num2, std::span<const u32> data,
+                           uintptr_t base_addr);
+
+    /// Writes the capture ring to disk so a crash report can carry the last frames.
+    bool ExportCaptureRing(const std::filesystem::path& path);
+
     void PushRegsDump(uintptr_t base_addr, uintptr_t header_addr, const AmdGpu::Regs& regs);
     using CsState = AmdGpu::ComputeProgram;
     void PushRegsDumpCompute(uintptr_t base_addr, uintptr_t header_addr, const CsState& cs_state);
 
+    void RecordShaderCompileTime(float translate_ms, float passes_ms, float emit_ms) {
+        std::scoped_lock lock{compile_time_mutex};
+        translate_times.Add(translate_ms);
+        ir_pass_times.Add(passes_ms);
+        spirv_emit_times.Add(emit_ms);
+    }
+
+    void RecordPassStat(const char* name, float ms, s32 inst_delta) {
+        std::scoped_lock lock{compile_time_mutex};
+        auto& stat = pass_stats[name];
+        ++stat.count;
+        stat.no_change_runs += inst_delta == 0;
+        stat.total_ms += ms;
+        stat.max_ms = std::max(stat.max_ms, ms);
+        stat.inst_delta += inst_delta;
+    }
+
+    void RecordPipelineCompileTime(float ms) {
+        std::scoped_lock lock{compile_time_mutex};
+        pipeline_create_times.Add(ms);
+    }
+
+    bool IsGpuZoneProfilingEnabled() const {
+        return gpu_zone_profiling_enabled;
+    }
+
+    bool IsMemopProfilingEnabled() const {
+        return memop_profiling_enabled.load(std::memory_order_relaxed);
+    }
+
+    void RecordGuestMemcpy(u64 bytes) {
+        memcpy_sizes.Add(bytes);
+    }
+
+    void RecordGuestMemset(u64 bytes) {
+        memset_sizes.Add(bytes);
+    }
+
+    bool IsTextureStatsEnabled() const {
+        return texture_stats_enabled.load(std::memory_order_relaxed);
+    }
+
+    void PublishTextureStats(TextureFrameStats&& stats) {
+        std::scoped_lock lock{texture_stats_mutex};
+        texture_stats = std::move(stats);
+    }
+
+    void RecordGpuZoneTime(const char* name, float ms) {
+        std::scoped_lock lock{gpu_zone_mutex};
+        auto& stat = gpu_zone_stats[name];
+        ++stat.count;
+        stat.total_ms += ms;
+        stat.max_ms = std::max(stat.max_ms, ms);
+        stat.last_ms = ms;
+    }
+
+    void RecordComputeDispatch(u64 pgm_hash, bool hle) {
+        std::scoped_lock lock{compute_stats_mutex};
+        auto& stat = compute_shader_stats[pgm_hash];
+        ++stat.dispatches;
+        stat.hle = hle;
+    }
+
+    void RecordComputeZoneTime(u64 pgm_hash, float ms) {
+        std::scoped_lock lock{compute_stats_mutex};
+        auto& stat = compute_shader_stats[pgm_hash];
+        ++stat.gpu_samples;
+        stat.total_ms += ms;
+        stat.max_ms = std::max(stat.max_ms, ms);
+    }
+
     void CollectShader(const std::string& name, Shader::LogicalStage l_stage,
                        vk::ShaderModule module, std::span<const u32> spv,
                        std::span<const u32> raw_code, std::span<const u32> patch_spv,
@@ -232,6 +500,8 @@ public:
 
 private:
     std::optional<RegDump*> GetRegDump(uintptr_t base_addr, uintptr_t header_addr);
+
+    void RotateCaptureFrame();
 };
 } // namespace DebugStateType
 
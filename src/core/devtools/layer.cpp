@@ -8,7 +8,9 @@
 
 #include "SDL3/SDL_log.h"
 #include "common/config.h"
+#include "common/path_util.h"
 #include "common/singleton.h"
+#include "common/trace_profiler.h"
 #include "common/types.h"
 #include "core/debug_state.h"
 #include "core/emulator_state.h"
@@ -16,11 +18,20 @@
 #include "imgui_internal.h"
 #include "options.h"
 #include "video_core/renderer_vulkan/vk_presenter.h"
+#include "widget/compile_profiler.h"
+#include "widget/compute_stats.h"
+#include "widget/memop_profiler.h"
 #include "widget/frame_dump.h"
 #include "widget/frame_graph.h"
+#include "widget/gpu_profiler.h"
+#include "widget/hle_profiler.h"
 #include "widget/memory_map.h"
 #include "widget/module_list.h"
 #include "widget/shader_list.h"
+#include "widget/lock_stats.h"
+#include "widget/slab_stats.h"
+#include "widget/texture_stats.h"
+#include "widget/video_memory.h"
 
 extern std::unique_ptr<Vulkan::Presenter> presenter;
 
@@ -45,9 +56,18 @@ static float debug_popup_timing = 3.0f;
 
 static bool just_opened_options = false;
 
+static Widget::CompileProfiler compile_profiler;
+static Widget::MemopProfiler memop_profiler;
+static Widget::GpuProfiler gpu_profiler;
+static Widget::ComputeStats compute_stats;
+static Widget::VideoMemory video_memory;
+static Widget::HleProfiler hle_profiler;
 static Widget::MemoryMapViewer memory_map;
 static Widget::ShaderList shader_list;
 static Widget::ModuleList module_list;
+static Widget::SlabStats slab_stats;
+static Widget::LockStats lock_stats;
+static Widget::TextureStats texture_stats;
 
 // clang-format off
 static std::string help_text =
@@ -78,6 +98,25 @@ void L::DrawMenuBar() {
         if (BeginMenu("GPU Tools")) {
             MenuItem("Show frame info", nullptr, &frame_graph.is_open);
             MenuItem("Show loaded shaders", nullptr, &shader_list.open);
+            MenuItem("Show compile times", nullptr, &compile_profiler.open);
+            MenuItem("Show GPU pass times", nullptr, &gpu_profiler.open);
+            MenuItem("Show compute shaders", nullptr, &compute_stats.open);
+            MenuItem("Show texture usage", nullptr, &texture_stats.open);
+            MenuItem("Show video memory", nullptr, &video_memory.open);
+            MenuItem("Show guest memory routines", nullptr, &memop_profiler.open);
+            MenuItem("Show HLE calls", nullptr, &hle_profiler.open);
+            MenuItem("Show slab allocators", nullptr, &slab_stats.open);
+            MenuItem("Show lock contention", nullptr, &lock_stats.open);
+            bool profiler_enabled = Common::Profiler::IsEnabled();
+            if (MenuItem("RDTSC profiler capture", nullptr, &profiler_enabled)) {
+                Common::Profiler::SetEnabled(profiler_enabled);
+            }
+            if (MenuItem("Export RDTSC trace", nullptr, nullptr,
+                         Common::Profiler::IsEnabled())) {
+                Common::Profiler::Export(
+                    Common::FS::GetUserPath(Common::FS::PathType::LogDir) /
+                    "profile_trace.json");
+            }
             if (BeginMenu("Dump frames")) {
                 SliderInt("Count", &dump_frame_count, 1, 5);
                 if (MenuItem("Dump", "Ctrl+Alt+F9", nullptr, !DebugState.DumpingCurrentFrame())) {
@@ -85,6 +124,19 @@ void L::DrawMenuBar() {
                 }
                 ImGui::EndMenu();
             }
+            bool continuous_capture = DebugState.IsContinuousCaptureEnabled();
+            if (MenuItem("Continuous frame capture", nullptr, &continuous_capture)) {
+                DebugState.SetContinuousCapture(continuous_capture);
+            }
+            if (MenuItem("Export capture ring", nullptr, nullptr,
+                         DebugState.IsContinuousCaptureEnabled())) {
+                DebugState.ExportCaptureRing(
+                    Common::FS::GetUserPath(Common::FS::PathType::LogDir) / "capture_ring.bin");
+            }
+            bool video_capture = presenter->IsFrameCaptureEnabled();
+            if (MenuItem("Record video frames", nullptr, &video_capture)) {
+                presenter->SetFrameCapture(video_capture);
+            }
             open_popup_options = MenuItem("Options");
             open_popup_help = MenuItem("Help & Tips");
             ImGui::EndMenu();
@@ -270,9 +322,36 @@ void L::DrawAdvanced() {
     if (shader_list.open) {
         shader_list.Draw();
     }
+    if (compile_profiler.open) {
+        compile_profiler.Draw();
+    }
+    if (gpu_profiler.open) {
+        gpu_profiler.Draw();
+    }
+    if (compute_stats.open) {
+        compute_stats.Draw();
+    }
+    if (video_memory.open) {
+        video_memory.Draw();
+    }
+    if (memop_profiler.open) {
+        memop_profiler.Draw();
+    }
+    if (hle_profiler.open) {
+        hle_profiler.Draw();
+    }
     if (module_list.open) {
         module_list.Draw();
     }
+    if (slab_stats.open) {
+        slab_stats.Draw();
+    }
+    if (lock_stats.open) {
+        lock_stats.Draw();
+    }
+    if (texture_stats.open) {
+        texture_stats.Draw();
+    }
 }
 
 void L::DrawSimple() {
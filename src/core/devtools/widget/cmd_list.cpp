@@ -1172,6 +1172,213 @@ CmdListViewer::CmdListViewer(DebugStateType::FrameDump* _frame_dump,
     if (!events.empty() && std::holds_alternative<BatchBegin>(events.back())) {
         events.pop_back();
     }
+
+    // Build the row index for the virtualized batch list. Labels are formatted once here so
+    // scrolling never has to re-parse packets or re-run snprintf for off-screen rows.
+    for (size_t i = 0; i < events.size(); ++i) {
+        const auto* batch = std::get_if<BatchInfo>(&events[i]);
+        if (batch == nullptr) {
+            continue;
+        }
+        batch_event_indices.push_back(i);
+        char batch_hdr[128]{};
+        if (batch->type != static_cast<PM4ItOpcode>(0xFF)) {
+            if (!batch->marker.empty()) {
+                snprintf(batch_hdr, sizeof(batch_hdr), "%08" PRIXPTR ": batch-%03d %s | %s",
+                         cmdb_addr + batch->start_addr, batch->id,
+                         Gcn::GetOpCodeName(static_cast<u32>(batch->type)), batch->marker.c_str());
+            } else {
+                snprintf(batch_hdr, sizeof(batch_hdr), "%08" PRIXPTR ": batch-%03d %s",
+                         cmdb_addr + batch->start_addr, batch->id,
+                         Gcn::GetOpCodeName(static_cast<u32>(batch->type)));
+            }
+        }
+        batch_row_labels.emplace_back(batch_hdr);
+    }
+}
+
+void CmdListViewer::DrawBatch(const ImGuiContext& ctx, BatchInfo& batch, u32 last_batch_id,
+                              u32& current_highlight_batch, const char* header_label) {
+    auto const* pm4_hdr = reinterpret_cast<PM4Header const*>(cmdb_addr + batch.start_addr);
+
+    bool ignore_header = false;
+    char batch_hdr[128];
+    if (batch.type == static_cast<AmdGpu::PM4ItOpcode>(0xFF)) {
+        ignore_header = true;
+    } else if (header_label == nullptr) {
+        if (!batch.marker.empty()) {
+            snprintf(batch_hdr, sizeof(batch_hdr), "%08" PRIXPTR ": batch-%03d %s | %s",
+                     cmdb_addr + batch.start_addr, batch.id,
+                     Gcn::GetOpCodeName(static_cast<u32>(batch.type)), batch.marker.c_str());
+        } else {
+            snprintf(batch_hdr, sizeof(batch_hdr), "%08" PRIXPTR ": batch-%03d %s",
+                     cmdb_addr + batch.start_addr, batch.id,
+                     Gcn::GetOpCodeName(static_cast<u32>(batch.type)));
+        }
+        header_label = batch_hdr;
+    }
+
+    if (batch.id == batch_bp) { // highlight batch at breakpoint
+        PushStyleColor(ImGuiCol_Header, ImVec4{1.0f, 0.5f, 0.5f, 0.5f});
+    }
+    if (batch.id == highlight_batch && !group_batches) {
+        PushStyleColor(ImGuiCol_Text, ImVec4{1.0f, 0.7f, 0.7f, 1.0f});
+    }
+
+    const auto open_batch_view = [&, this] {
+        if (frame_dump->regs.contains(batch.command_addr)) {
+            auto data = frame_dump->regs.at(batch.command_addr);
+            if (GetIO().KeyShift) {
+                auto& pop = extra_batch_view.emplace_back();
+                pop.SetData(data, name, batch.id);
+                pop.open = true;
+            } else {
+                if (batch_view.open && this->last_selected_batch == static_cast<int>(batch.id)) {
+                    batch_view.open = false;
+                } else {
+                    this->last_selected_batch = static_cast<int>(batch.id);
+                    batch_view.SetData(data, name, batch.id);
+                    if (!batch_view.open || !batch_view.moved) {
+                        batch_view.open = true;
+                        const auto pos = GetItemRectMax() + ImVec2{5.0f, 0.0f};
+                        batch_view.SetPos(pos);
+                    }
+                }
+            }
+        }
+    };
+
+    bool show_batch_content = true;
+
+    if (group_batches && !ignore_header) {
+        show_batch_content = CollapsingHeader(header_label, ImGuiTreeNodeFlags_AllowOverlap);
+        SameLine(GetContentRegionAvail().x - 40.0f);
+        const char* text =
+            last_selected_batch == static_cast<int>(batch.id) && batch_view.open ? "X" : "->";
+        if (Button(text, {40.0f, 0.0f})) {
+            open_batch_view();
+        }
+    }
+
+    if (show_batch_content) {
+        size_t processed_size = 0;
+        auto bb = ctx.LastItemData.Rect;
+        if (group_batches && !ignore_header) {
+            Indent();
+        }
+        auto const batch_sz = batch.end_addr - batch.start_addr;
+
+        while (processed_size < batch_sz) {
+            AmdGpu::PM4ItOpcode op{0xFFu};
+
+            if (pm4_hdr->type == AmdGpu::PM4Type3Header::TYPE) {
+                auto const* pm4_t3 = reinterpret_cast<AmdGpu::PM4Type3Header const*>(pm4_hdr);
+                op = pm4_t3->opcode;
+
+                char header_name[128];
+                snprintf(header_name, sizeof(header_name), "%08" PRIXPTR ": %s",
+                         cmdb_addr + batch.start_addr + processed_size,
+                         Gcn::GetOpCodeName(static_cast<u32>(op)));
+
+                bool open_pm4 = TreeNode(header_name);
+                if (!group_batches) {
+                    if (IsDrawCall(op)) {
+                        SameLine(GetContentRegionAvail().x - 40.0f);
+                        const char* text =
+                            last_selected_batch == static_cast<int>(batch.id) && batch_view.open
+                                ? "X"
+                                : "->";
+                        if (Button(text, {40.0f, 0.0f})) {
+                            open_batch_view();
+                        }
+                    }
+                    if (IsItemHovered() && ctx.IO.KeyShift) {
+                        if (BeginTooltip()) {
+                            Text("Batch %d", batch.id);
+                            EndTooltip();
+                        }
+                    }
+                }
+                if (open_pm4) {
+                    if (IsItemToggledOpen()) {
+                        // Editor
+                        cmdb_view.GotoAddrAndHighlight(
+                            reinterpret_cast<size_t>(pm4_hdr) - cmdb_addr,
+                            reinterpret_cast<size_t>(pm4_hdr) - cmdb_addr +
+                                (pm4_hdr->count + 2) * 4);
+                    }
+
+                    if (BeginTable("split", 1)) {
+                        TableNextColumn();
+                        Text("size: %d", pm4_hdr->count + 1);
+
+                        auto const* it_body = reinterpret_cast<uint32_t const*>(pm4_hdr + 1);
+
+                        switch (op) {
+                        case AmdGpu::PM4ItOpcode::Nop: {
+                            OnNop(pm4_t3, it_body);
+                            break;
+                        }
+                        case AmdGpu::PM4ItOpcode::SetBase: {
+                            OnSetBase(pm4_t3, it_body);
+                            break;
+                        }
+                        case AmdGpu::PM4ItOpcode::SetContextReg: {
+                            OnSetContextReg(pm4_t3, it_body);
+                            break;
+                        }
+                        case AmdGpu::PM4ItOpcode::SetShReg: {
+                            OnSetShReg(pm4_t3, it_body);
+                            break;
+                        }
+                        case AmdGpu::PM4ItOpcode::DispatchDirect: {
+                            OnDispatch(pm4_t3, it_body);
+                            break;
+                        }
+                        default: {
+                            auto const* payload = &it_body[0];
+                            for (unsigned i = 0; i < pm4_hdr->count + 1; ++i) {
+                                Text("%02X: %08X", i, payload[i]);
+                            }
+                        }
+                        }
+
+                        EndTable();
+                    }
+                    TreePop();
+                }
+
+            } else {
+                Text("<UNK PACKET>");
+            }
+
+            auto const* next_pm4_hdr = GetNext(pm4_hdr, 1);
+            auto const processed_len = reinterpret_cast<uintptr_t>(next_pm4_hdr) -
+                                       reinterpret_cast<uintptr_t>(pm4_hdr);
+            pm4_hdr = next_pm4_hdr;
+            processed_size += processed_len;
+        }
+
+        if (group_batches && !ignore_header) {
+            Unindent();
+        };
+        bb = {{0.0f, bb.Max.y}, ctx.LastItemData.Rect.Max};
+        if (bb.Contains(ctx.IO.MousePos)) {
+            current_highlight_batch = batch.id;
+        }
+    }
+
+    if (batch.id == highlight_batch && !group_batches) {
+        PopStyleColor();
+    }
+
+    if (batch.id == batch_bp) {
+        PopStyleColor();
+    }
+
+    if (batch.id == last_batch_id) {
+        Separator();
+    }
 }
 
 void CmdListViewer::Draw(bool only_batches_view, CmdListFilter& filter) {
@@ -1242,271 +1449,103 @@ void CmdListViewer::Draw(bool only_batches_view, CmdListFilter& filter) {
                 last_batch_id = std::get<BatchInfo>(events.back()).id;
             }
 
-            u32 batch_id = ~0u;
             u32 current_highlight_batch = ~0u;
 
-            int id = 0;
-            PushID(0);
-            for (const auto& event : events) {
-                PopID();
-                PushID(id++);
-
-                if (std::holds_alternative<BatchBegin>(event)) {
-                    batch_id = std::get<BatchBegin>(event).id;
-                }
-
-                if (show_markers) {
-                    if (std::holds_alternative<PushMarker>(event)) {
-                        if (tree_depth_show >= tree_depth) {
-                            auto& marker = std::get<PushMarker>(event);
-                            bool show = TreeNode(&event, "%s", marker.name.c_str());
-                            if (show) {
-                                tree_depth_show++;
-                            }
-                        }
-                        tree_depth++;
-                        continue;
-                    }
-                    if (std::holds_alternative<PopMarker>(event)) {
-                        if (tree_depth_show >= tree_depth) {
-                            tree_depth_show--;
-                            TreePop();
-                        }
-                        tree_depth--;
-                        continue;
+            if (group_batches && !show_markers && filter.shader_name[0] == '\0') {
+                // Fast path: every visible row is a batch header of uniform height, so
+                // only the rows inside the scroll window need to be drawn. Labels were
+                // pre-formatted once when the capture was parsed.
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(batch_event_indices.size()));
+                while (clipper.Step()) {
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                        const auto event_idx = batch_event_indices[row];
+                        // Use the event index as ID to match the full walk below, so
+                        // open headers stay open when switching between the two paths.
+                        PushID(static_cast<int>(event_idx));
+                        auto& batch = std::get<BatchInfo>(events[event_idx]);
+                        DrawBatch(ctx, batch, last_batch_id, current_highlight_batch,
+                                  batch_row_labels[row].c_str());
+                        PopID();
                     }
-                    if (tree_depth_show < tree_depth) {
-                        continue;
-                    }
-                }
-
-                if (!std::holds_alternative<BatchInfo>(event)) {
-                    continue;
                 }
-
-                auto& batch = std::get<BatchInfo>(event);
-
-                // filtering
-                {
-                    bool remove = false;
-
-                    if (filter.shader_name[0] != '\0') {
-                        remove = true;
-                        std::string_view shader_name{filter.shader_name};
-                        const auto& data = frame_dump->regs.find(batch.command_addr);
-                        if (data != frame_dump->regs.end()) {
-                            DebugStateType::RegDump& dump = data->second;
-                            if (dump.is_compute) {
-                                if (dump.cs_data.name.contains(shader_name)) {
-                                    remove = false;
-                                    break;
-                                }
-                            } else {
-                                for (int i = 0; i < DebugStateType::RegDump::MaxShaderStages; ++i) {
-                                    if (dump.regs.stage_enable.IsStageEnabled(i)) {
-                                        auto& stage = dump.stages[i];
-                                        if (stage.name.contains(shader_name)) {
-                                            remove = false;
-                                            break;
-                                        }
-                                    }
+            } else {
+                int id = 0;
+                PushID(0);
+                for (const auto& event : events) {
+                    PopID();
+                    PushID(id++);
+
+                    if (show_markers) {
+                        if (std::holds_alternative<PushMarker>(event)) {
+                            if (tree_depth_show >= tree_depth) {
+                                auto& marker = std::get<PushMarker>(event);
+                                bool show = TreeNode(&event, "%s", marker.name.c_str());
+                                if (show) {
+                                    tree_depth_show++;
                                 }
                             }
+                            tree_depth++;
+                            continue;
                         }
-                    }
-
-                    if (remove) {
-                        continue;
-                    }
-                }
-
-                auto const* pm4_hdr =
-                    reinterpret_cast<PM4Header const*>(cmdb_addr + batch.start_addr);
-
-                bool ignore_header = false;
-                char batch_hdr[128];
-                if (batch.type == static_cast<AmdGpu::PM4ItOpcode>(0xFF)) {
-                    ignore_header = true;
-                } else if (!batch.marker.empty()) {
-                    snprintf(batch_hdr, sizeof(batch_hdr), "%08" PRIXPTR ": batch-%03d %s | %s",
-                             cmdb_addr + batch.start_addr, batch.id,
-                             Gcn::GetOpCodeName(static_cast<u32>(batch.type)),
-                             batch.marker.c_str());
-                } else {
-                    snprintf(batch_hdr, sizeof(batch_hdr), "%08" PRIXPTR ": batch-%03d %s",
-                             cmdb_addr + batch.start_addr, batch.id,
-                             Gcn::GetOpCodeName(static_cast<u32>(batch.type)));
-                }
-
-                if (batch.id == batch_bp) { // highlight batch at breakpoint
-                    PushStyleColor(ImGuiCol_Header, ImVec4{1.0f, 0.5f, 0.5f, 0.5f});
-                }
-                if (batch.id == highlight_batch && !group_batches) {
-                    PushStyleColor(ImGuiCol_Text, ImVec4{1.0f, 0.7f, 0.7f, 1.0f});
-                }
-
-                const auto open_batch_view = [&, this] {
-                    if (frame_dump->regs.contains(batch.command_addr)) {
-                        auto data = frame_dump->regs.at(batch.command_addr);
-                        if (GetIO().KeyShift) {
-                            auto& pop = extra_batch_view.emplace_back();
-                            pop.SetData(data, name, batch_id);
-                            pop.open = true;
-                        } else {
-                            if (batch_view.open &&
-                                this->last_selected_batch == static_cast<int>(batch_id)) {
-                                batch_view.open = false;
-                            } else {
-                                this->last_selected_batch = static_cast<int>(batch_id);
-                                batch_view.SetData(data, name, batch_id);
-                                if (!batch_view.open || !batch_view.moved) {
-                                    batch_view.open = true;
-                                    const auto pos = GetItemRectMax() + ImVec2{5.0f, 0.0f};
-                                    batch_view.SetPos(pos);
-                                }
+                        if (std::holds_alternative<PopMarker>(event)) {
+                            if (tree_depth_show >= tree_depth) {
+                                tree_depth_show--;
+                                TreePop();
                             }
+                            tree_depth--;
+                            continue;
+                        }
+                        if (tree_depth_show < tree_depth) {
+                            continue;
                         }
                     }
-                };
-
-                bool show_batch_content = true;
-
-                if (group_batches && !ignore_header) {
-                    show_batch_content =
-                        CollapsingHeader(batch_hdr, ImGuiTreeNodeFlags_AllowOverlap);
-                    SameLine(GetContentRegionAvail().x - 40.0f);
-                    const char* text =
-                        last_selected_batch == static_cast<int>(batch_id) && batch_view.open ? "X"
-                                                                                             : "->";
-                    if (Button(text, {40.0f, 0.0f})) {
-                        open_batch_view();
-                    }
-                }
 
-                if (show_batch_content) {
-                    size_t processed_size = 0;
-                    auto bb = ctx.LastItemData.Rect;
-                    if (group_batches && !ignore_header) {
-                        Indent();
+                    if (!std::holds_alternative<BatchInfo>(event)) {
+                        continue;
                     }
-                    auto const batch_sz = batch.end_addr - batch.start_addr;
-
-                    while (processed_size < batch_sz) {
-                        AmdGpu::PM4ItOpcode op{0xFFu};
-
-                        if (pm4_hdr->type == AmdGpu::PM4Type3Header::TYPE) {
-                            auto const* pm4_t3 =
-                                reinterpret_cast<AmdGpu::PM4Type3Header const*>(pm4_hdr);
-                            op = pm4_t3->opcode;
-
-                            char header_name[128];
-                            snprintf(header_name, sizeof(header_name), "%08" PRIXPTR ": %s",
-                                     cmdb_addr + batch.start_addr + processed_size,
-                                     Gcn::GetOpCodeName(static_cast<u32>(op)));
-
-                            bool open_pm4 = TreeNode(header_name);
-                            if (!group_batches) {
-                                if (IsDrawCall(op)) {
-                                    SameLine(GetContentRegionAvail().x - 40.0f);
-                                    const char* text =
-                                        last_selected_batch == static_cast<int>(batch_id) &&
-                                                batch_view.open
-                                            ? "X"
-                                            : "->";
-                                    if (Button(text, {40.0f, 0.0f})) {
-                                        open_batch_view();
-                                    }
-                                }
-                                if (IsItemHovered() && ctx.IO.KeyShift) {
-                                    if (BeginTooltip()) {
-                                        Text("Batch %d", batch_id);
-                                        EndTooltip();
-                                    }
-                                }
-                            }
-                            if (open_pm4) {
-                                if (IsItemToggledOpen()) {
-                                    // Editor
-                                    cmdb_view.GotoAddrAndHighlight(
-                                        reinterpret_cast<size_t>(pm4_hdr) - cmdb_addr,
-                                        reinterpret_cast<size_t>(pm4_hdr) - cmdb_addr +
-                                            (pm4_hdr->count + 2) * 4);
-                                }
 
-                                if (BeginTable("split", 1)) {
-                                    TableNextColumn();
-                                    Text("size: %d", pm4_hdr->count + 1);
-
-                                    auto const* it_body =
-                                        reinterpret_cast<uint32_t const*>(pm4_hdr + 1);
-
-                                    switch (op) {
-                                    case AmdGpu::PM4ItOpcode::Nop: {
-                                        OnNop(pm4_t3, it_body);
-                                        break;
-                                    }
-                                    case AmdGpu::PM4ItOpcode::SetBase: {
-                                        OnSetBase(pm4_t3, it_body);
-                                        break;
-                                    }
-                                    case AmdGpu::PM4ItOpcode::SetContextReg: {
-                                        OnSetContextReg(pm4_t3, it_body);
-                                        break;
-                                    }
-                                    case AmdGpu::PM4ItOpcode::SetShReg: {
-                                        OnSetShReg(pm4_t3, it_body);
+                    auto& batch = std::get<BatchInfo>(event);
+
+                    // filtering
+                    {
+                        bool remove = false;
+
+                        if (filter.shader_name[0] != '\0') {
+                            remove = true;
+                            std::string_view shader_name{filter.shader_name};
+                            const auto& data = frame_dump->regs.find(batch.command_addr);
+                            if (data != frame_dump->regs.end()) {
+                                DebugStateType::RegDump& dump = data->second;
+                                if (dump.is_compute) {
+                                    if (dump.cs_data.name.contains(shader_name)) {
+                                        remove = false;
                                         break;
                                     }
-                                    case AmdGpu::PM4ItOpcode::DispatchDirect: {
-                                        OnDispatch(pm4_t3, it_body);
-                                        break;
-                                    }
-                                    default: {
-                                        auto const* payload = &it_body[0];
-                                        for (unsigned i = 0; i < pm4_hdr->count + 1; ++i) {
-                                            Text("%02X: %08X", i, payload[i]);
+                                } else {
+                                    for (int i = 0; i < DebugStateType::RegDump::MaxShaderStages;
+                                         ++i) {
+                                        if (dump.regs.stage_enable.IsStageEnabled(i)) {
+                                            auto& stage = dump.stages[i];
+                                            if (stage.name.contains(shader_name)) {
+                                                remove = false;
+                                                break;
+                                            }
                                         }
                                     }
-                                    }
-
-                                    EndTable();
                                 }
-                                TreePop();
                             }
-
-                        } else {
-                            Text("<UNK PACKET>");
                         }
 
-                        auto const* next_pm4_hdr = GetNext(pm4_hdr, 1);
-                        auto const processed_len = reinterpret_cast<uintptr_t>(next_pm4_hdr) -
-                                                   reinterpret_cast<uintptr_t>(pm4_hdr);
-                        pm4_hdr = next_pm4_hdr;
-                        processed_size += processed_len;
-                    }
-
-                    if (group_batches && !ignore_header) {
-                        Unindent();
-                    };
-                    bb = {{0.0f, bb.Max.y}, ctx.LastItemData.Rect.Max};
-                    if (bb.Contains(ctx.IO.MousePos)) {
-                        current_highlight_batch = batch.id;
+                        if (remove) {
+                            continue;
+                        }
                     }
-                }
-
-                if (batch.id == highlight_batch && !group_batches) {
-                    PopStyleColor();
-                }
 
-                if (batch.id == batch_bp) {
-                    PopStyleColor();
-                }
-
-                if (batch.id == last_batch_id) {
-                    Separator();
+                    DrawBatch(ctx, batch, last_batch_id, current_highlight_batch, nullptr);
                 }
+                PopID();
             }
-            PopID();
 
             highlight_batch = current_highlight_batch;
         }
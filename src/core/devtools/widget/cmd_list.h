@@ -45,6 +45,10 @@ class CmdListViewer {
     uintptr_t base_addr;
     std::string name;
     std::vector<GPUEvent> events{};
+    // Index of every BatchInfo event plus its pre-formatted header label, so the
+    // virtualized list can address and draw rows without walking or re-parsing events.
+    std::vector<size_t> batch_event_indices{};
+    std::vector<std::string> batch_row_labels{};
     uintptr_t cmdb_addr;
     size_t cmdb_size;
 
@@ -60,6 +64,9 @@ class CmdListViewer {
 
     std::vector<RegView> extra_batch_view;
 
+    void DrawBatch(const ImGuiContext& ctx, BatchInfo& batch, u32 last_batch_id,
+                   u32& current_highlight_batch, const char* header_label);
+
     static void OnNop(AmdGpu::PM4Type3Header const* header, u32 const* body);
     static void OnSetBase(AmdGpu::PM4Type3Header const* header, u32 const* body);
     static void OnSetContextReg(AmdGpu::PM4Type3Header const* header, u32 const* body);
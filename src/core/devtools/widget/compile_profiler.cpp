@@ -0,0 +1,100 @@
+//  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+
+#include <fmt/format.h>
+#include <imgui.h>
+
+#include "compile_profiler.h"
+#include "core/debug_state.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+static void DrawHistogram(const char* label, const DebugStateType::CompileHistogram& histogram) {
+    std::array<float, DebugStateType::CompileHistogram::NumBuckets> values;
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(histogram.buckets[i]);
+    }
+    const float avg_ms = histogram.count > 0 ? histogram.total_ms / histogram.count : 0.0f;
+    const auto overlay =
+        fmt::format("{} | n={} avg={:.2f}ms max={:.2f}ms", label, histogram.count, avg_ms,
+                    histogram.max_ms);
+    PlotHistogram(fmt::format("##{}", label).c_str(), values.data(),
+                  static_cast<int>(values.size()), 0, overlay.c_str(), FLT_MAX, FLT_MAX,
+                  {0.0f, 60.0f});
+    if (IsItemHovered()) {
+        SetTooltip("Buckets are powers of two starting at %.3f ms",
+                   DebugStateType::CompileHistogram::FirstBucketMs);
+    }
+}
+
+void CompileProfiler::Draw() {
+    SetNextWindowSize({450.0f, 380.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Compile times", &open)) {
+        End();
+        return;
+    }
+
+    DebugStateType::CompileHistogram translate;
+    DebugStateType::CompileHistogram ir_passes;
+    DebugStateType::CompileHistogram spirv_emit;
+    DebugStateType::CompileHistogram pipeline_create;
+    std::map<std::string, DebugStateType::PassStat> pass_stats;
+    {
+        std::scoped_lock lock{DebugState.compile_time_mutex};
+        translate = DebugState.translate_times;
+        ir_passes = DebugState.ir_pass_times;
+        spirv_emit = DebugState.spirv_emit_times;
+        pipeline_create = DebugState.pipeline_create_times;
+        pass_stats = DebugState.pass_stats;
+    }
+
+    TextUnformatted("Recompiler");
+    DrawHistogram("GCN translate", translate);
+    DrawHistogram("IR passes", ir_passes);
+    DrawHistogram("SPIR-V emit", spirv_emit);
+    Separator();
+    TextUnformatted("Driver");
+    DrawHistogram("vkCreate*Pipelines", pipeline_create);
+    Separator();
+    TextUnformatted("IR pass breakdown");
+    if (BeginTable("ir_pass_stats", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Pass");
+        TableSetupColumn("Runs");
+        TableSetupColumn("Avg (ms)");
+        TableSetupColumn("Insts");
+        TableSetupColumn("No-op %");
+        TableHeadersRow();
+        for (const auto& [name, stat] : pass_stats) {
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(name.c_str());
+            TableNextColumn();
+            Text("%u", stat.count);
+            TableNextColumn();
+            Text("%.3f", stat.count > 0 ? stat.total_ms / stat.count : 0.0f);
+            TableNextColumn();
+            Text("%+lld", static_cast<long long>(stat.inst_delta));
+            TableNextColumn();
+            Text("%.0f", stat.count > 0 ? 100.0f * stat.no_change_runs / stat.count : 0.0f);
+        }
+        EndTable();
+    }
+
+    if (Button("Reset")) {
+        std::scoped_lock lock{DebugState.compile_time_mutex};
+        DebugState.translate_times = {};
+        DebugState.ir_pass_times = {};
+        DebugState.spirv_emit_times = {};
+        DebugState.pipeline_create_times = {};
+        DebugState.pass_stats.clear();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
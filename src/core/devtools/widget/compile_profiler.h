@@ -0,0 +1,15 @@
+//  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace Core::Devtools::Widget {
+
+class CompileProfiler {
+public:
+    bool open = false;
+
+    void Draw();
+};
+
+} // namespace Core::Devtools::Widget
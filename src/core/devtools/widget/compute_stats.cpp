@@ -0,0 +1,81 @@
+//  SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <imgui.h>
+
+#include "compute_stats.h"
+#include "core/debug_state.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+void ComputeStats::Draw() {
+    SetNextWindowSize({520.0f, 320.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Compute shaders", &open)) {
+        End();
+        return;
+    }
+
+    bool enabled = DebugState.gpu_zone_profiling_enabled;
+    if (Checkbox("Enable timestamp collection", &enabled)) {
+        DebugState.gpu_zone_profiling_enabled = enabled;
+    }
+    if (IsItemHovered()) {
+        SetTooltip("Records every compute dispatch per program hash; programs without an\n"
+                   "HLE implementation that accumulate the most GPU time are the best\n"
+                   "candidates for a hand-written one");
+    }
+
+    std::vector<std::pair<u64, DebugStateType::ComputeShaderStat>> stats;
+    {
+        std::scoped_lock lock{DebugState.compute_stats_mutex};
+        stats.assign(DebugState.compute_shader_stats.begin(),
+                     DebugState.compute_shader_stats.end());
+    }
+    std::ranges::stable_sort(stats, [](const auto& lhs, const auto& rhs) {
+        if (lhs.second.total_ms != rhs.second.total_ms) {
+            return lhs.second.total_ms > rhs.second.total_ms;
+        }
+        return lhs.second.dispatches > rhs.second.dispatches;
+    });
+
+    if (BeginTable("compute_shaders", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Program");
+        TableSetupColumn("HLE");
+        TableSetupColumn("Dispatches");
+        TableSetupColumn("GPU total (ms)");
+        TableSetupColumn("Avg (ms)");
+        TableSetupColumn("Max (ms)");
+        TableHeadersRow();
+        for (const auto& [hash, stat] : stats) {
+            TableNextRow();
+            TableNextColumn();
+            Text("%#018llx", static_cast<unsigned long long>(hash));
+            TableNextColumn();
+            TextUnformatted(stat.hle ? "yes" : "-");
+            TableNextColumn();
+            Text("%u", stat.dispatches);
+            TableNextColumn();
+            Text("%.3f", stat.total_ms);
+            TableNextColumn();
+            Text("%.3f", stat.gpu_samples > 0 ? stat.total_ms / stat.gpu_samples : 0.0f);
+            TableNextColumn();
+            Text("%.3f", stat.max_ms);
+        }
+        EndTable();
+    }
+
+    if (Button("Reset")) {
+        std::scoped_lock lock{DebugState.compute_stats_mutex};
+        DebugState.compute_shader_stats.clear();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
@@ -0,0 +1,15 @@
+//  SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace Core::Devtools::Widget {
+
+class ComputeStats {
+public:
+    bool open = false;
+
+    void Draw();
+};
+
+} // namespace Core::Devtools::Widget
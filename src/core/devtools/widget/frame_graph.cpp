@@ -1,9 +1,17 @@
 //  SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 //  SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
 #include "frame_graph.h"
 
 #include "common/config.h"
+#include "common/elf_info.h"
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "common/path_util.h"
 #include "common/singleton.h"
 #include "core/debug_state.h"
 #include "imgui.h"
@@ -18,6 +26,84 @@ constexpr float BAR_HEIGHT_MULT = 1.25f;
 constexpr float FRAME_GRAPH_PADDING_Y = 3.0f;
 constexpr static float FRAME_GRAPH_HEIGHT = 50.0f;
 
+// A session regresses when its rolling p99 or 1%-low exceeds the baseline by this factor.
+constexpr float REGRESSION_THRESHOLD = 1.10f;
+
+static std::filesystem::path BaselinePath() {
+    return Common::FS::GetUserPath(Common::FS::PathType::MetaDataDir) /
+           Common::ElfInfo::Instance().GameSerial() / "frame_baseline.txt";
+}
+
+void FrameGraph::LoadBaseline() {
+    Common::FS::IOFile file{BaselinePath(), Common::FS::FileAccessMode::Read};
+    if (!file.IsOpen()) {
+        return;
+    }
+    const auto text = file.ReadString(file.GetSize());
+    has_baseline = std::sscanf(text.c_str(), "%f %f %f %f", &baseline.p50, &baseline.p95,
+                               &baseline.p99, &baseline.low1) == 4;
+}
+
+void FrameGraph::SaveBaseline() {
+    const auto path = BaselinePath();
+    std::filesystem::create_directories(path.parent_path());
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Create};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Core, "Unable to write frame baseline to {}", path.string());
+        return;
+    }
+    const auto text = fmt::format("{:.3f} {:.3f} {:.3f} {:.3f}\n", session.p50, session.p95,
+                                  session.p99, session.low1);
+    file.WriteString(text);
+    baseline = session;
+    has_baseline = true;
+    regressed = false;
+}
+
+void FrameGraph::UpdateStats() {
+    const u32 frame = DebugState.GetFrameNum();
+    if (frame - last_stats_frame < 64) {
+        return;
+    }
+    last_stats_frame = frame;
+
+    std::array<float, FRAME_BUFFER_SIZE> deltas;
+    size_t num = 0;
+    for (const auto& info : frame_list) {
+        if (info.delta > 0.0f) {
+            deltas[num++] = info.delta * 1000.0f;
+        }
+    }
+    // Wait until the ring has enough history for the tail percentiles to mean anything.
+    if (num < FRAME_BUFFER_SIZE / 2) {
+        return;
+    }
+    std::sort(deltas.begin(), deltas.begin() + num);
+    const auto at = [&](float q) { return deltas[std::min(num - 1, size_t(q * num))]; };
+    session.p50 = at(0.50f);
+    session.p95 = at(0.95f);
+    session.p99 = at(0.99f);
+    const size_t num_worst = std::max<size_t>(1, num / 100);
+    float sum = 0.0f;
+    for (size_t i = num - num_worst; i < num; ++i) {
+        sum += deltas[i];
+    }
+    session.low1 = sum / num_worst;
+    has_session_stats = true;
+
+    if (has_baseline) {
+        const bool over = session.p99 > baseline.p99 * REGRESSION_THRESHOLD ||
+                          session.low1 > baseline.low1 * REGRESSION_THRESHOLD;
+        if (over && !regressed) {
+            LOG_WARNING(Core,
+                        "Frame time regression: p99 {:.2f} ms / 1%-low {:.2f} ms vs baseline "
+                        "{:.2f} / {:.2f} ms",
+                        session.p99, session.low1, baseline.p99, baseline.low1);
+        }
+        regressed = over;
+    }
+}
+
 void FrameGraph::DrawFrameGraph() {
     // Frame graph - inspired by
     // https://asawicki.info/news_1758_an_idea_for_visualization_of_frame_times
@@ -85,11 +171,41 @@ void FrameGraph::Draw() {
         if (!isSystemPaused) {
             deltaTime = DebugState.FrameDeltaTime * 1000.0f;
             frameRate = 1000.0f / deltaTime;
+            if (!baseline_checked) {
+                baseline_checked = true;
+                LoadBaseline();
+            }
+            UpdateStats();
         }
 
         SeparatorText("Frame graph");
         DrawFrameGraph();
 
+        SeparatorText("Frame time percentiles");
+        if (has_session_stats) {
+            Text("p50: %.2f  p95: %.2f  p99: %.2f  1%%-low: %.2f ms", session.p50, session.p95,
+                 session.p99, session.low1);
+        } else {
+            TextUnformatted("Collecting...");
+        }
+        if (has_baseline) {
+            Text("Baseline p99: %.2f  1%%-low: %.2f ms", baseline.p99, baseline.low1);
+            if (regressed) {
+                // Flash so a regression is visible from across the room on a cabinet.
+                const float pulse = 0.6f + 0.4f * std::sin((float)GetTime() * 8.0f);
+                TextColored({1.0f, pulse * 0.3f, pulse * 0.3f, 1.0f},
+                            "REGRESSION vs baseline (>%d%%)",
+                            (int)((REGRESSION_THRESHOLD - 1.0f) * 100.0f + 0.5f));
+                draw_list.AddRect(window.Pos, window.Pos + window.Size,
+                                  IM_COL32(0xFF, 0x20, 0x20, (int)(pulse * 0xFF)), 0.0f, 0, 3.0f);
+            }
+        } else {
+            TextUnformatted("No baseline for this title yet");
+        }
+        if (has_session_stats && Button("Save as baseline")) {
+            SaveBaseline();
+        }
+
         SeparatorText("Renderer info");
 
         Text("Frame time: %.3f ms (%.1f FPS)", deltaTime, frameRate);
@@ -19,8 +19,29 @@ class FrameGraph {
     float deltaTime{};
     float frameRate{};
 
+    /// Rolling frame-time distribution in milliseconds; low1 is the average of the
+    /// slowest 1% of frames.
+    struct Percentiles {
+        float p50;
+        float p95;
+        float p99;
+        float low1;
+    };
+
+    Percentiles session{};
+    Percentiles baseline{};
+    bool has_session_stats = false;
+    bool has_baseline = false;
+    bool baseline_checked = false;
+    bool regressed = false;
+    u32 last_stats_frame = 0;
+
     void DrawFrameGraph();
 
+    void UpdateStats();
+    void LoadBaseline();
+    void SaveBaseline();
+
 public:
     bool is_open = true;
 
@@ -0,0 +1,68 @@
+//  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+
+#include <imgui.h>
+
+#include "core/debug_state.h"
+#include "gpu_profiler.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+void GpuProfiler::Draw() {
+    SetNextWindowSize({450.0f, 300.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("GPU pass times", &open)) {
+        End();
+        return;
+    }
+
+    bool enabled = DebugState.gpu_zone_profiling_enabled;
+    if (Checkbox("Enable timestamp collection", &enabled)) {
+        DebugState.gpu_zone_profiling_enabled = enabled;
+    }
+    if (IsItemHovered()) {
+        SetTooltip("Writes two GPU timestamps around every render pass and dispatch");
+    }
+
+    std::map<std::string, DebugStateType::GpuZoneStat> stats;
+    {
+        std::scoped_lock lock{DebugState.gpu_zone_mutex};
+        stats = DebugState.gpu_zone_stats;
+    }
+
+    if (BeginTable("gpu_zones", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Pass");
+        TableSetupColumn("Count");
+        TableSetupColumn("Last (ms)");
+        TableSetupColumn("Avg (ms)");
+        TableSetupColumn("Max (ms)");
+        TableHeadersRow();
+        for (const auto& [name, stat] : stats) {
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(name.c_str());
+            TableNextColumn();
+            Text("%u", stat.count);
+            TableNextColumn();
+            Text("%.3f", stat.last_ms);
+            TableNextColumn();
+            Text("%.3f", stat.count > 0 ? stat.total_ms / stat.count : 0.0f);
+            TableNextColumn();
+            Text("%.3f", stat.max_ms);
+        }
+        EndTable();
+    }
+
+    if (Button("Reset")) {
+        std::scoped_lock lock{DebugState.gpu_zone_mutex};
+        DebugState.gpu_zone_stats.clear();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
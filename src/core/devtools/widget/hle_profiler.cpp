@@ -0,0 +1,127 @@
+//  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <imgui.h>
+
+#include "common/native_clock.h"
+#include "common/singleton.h"
+#include "common/string_util.h"
+#include "core/aerolib/aerolib.h"
+#include "core/hle_trace.h"
+#include "core/linker.h"
+#include "hle_profiler.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+// Symbol names keyed by wrapper address, rebuilt when modules register more
+// HLE symbols. The symbol table stores composite "nid#lib#..." names, so the
+// pretty name comes from aerolib like SymbolsResolver::DebugDump does.
+static std::unordered_map<u64, std::string> symbol_names;
+static size_t known_symbol_count = 0;
+
+static const std::string& ResolveName(const void* func) {
+    const auto& resolver = Common::Singleton<Core::Linker>::Instance()->GetHLESymbols();
+    if (resolver.GetSize() != known_symbol_count) {
+        known_symbol_count = resolver.GetSize();
+        symbol_names.clear();
+        for (const auto& symbol : resolver.GetSymbols()) {
+            const auto ids = Common::SplitString(symbol.name, '#');
+            const auto aeronid = AeroLib::FindByNid(ids.at(0).c_str());
+            symbol_names[symbol.virtual_address] = aeronid ? aeronid->name : ids.at(0);
+        }
+    }
+    const auto it = symbol_names.find(reinterpret_cast<u64>(func));
+    static const std::string unknown = "UNK";
+    return it != symbol_names.end() ? it->second : unknown;
+}
+
+struct FuncStat {
+    u64 count{};
+    u64 total_tsc{};
+    u64 max_tsc{};
+};
+
+static void DrawThreadRing(const HleTrace::ThreadRing& ring) {
+    static Common::NativeClock clock;
+    const double tsc_to_us = 1e6 / static_cast<double>(clock.GetTscFrequency());
+
+    const u64 head = ring.head.load(std::memory_order_acquire);
+    const u64 available = std::min<u64>(head, HleTrace::RingSize);
+
+    std::unordered_map<const void*, FuncStat> stats;
+    for (u64 i = head - available; i != head; ++i) {
+        const auto& record = ring.records[i & (HleTrace::RingSize - 1)];
+        if (record.tsc_out < record.tsc_in) {
+            continue; // Torn read of a slot being overwritten.
+        }
+        auto& stat = stats[record.func];
+        const u64 elapsed = record.tsc_out - record.tsc_in;
+        stat.count++;
+        stat.total_tsc += elapsed;
+        stat.max_tsc = std::max(stat.max_tsc, elapsed);
+    }
+
+    std::vector<std::pair<const void*, FuncStat>> sorted{stats.begin(), stats.end()};
+    std::ranges::sort(sorted,
+                      [](const auto& a, const auto& b) { return a.second.total_tsc > b.second.total_tsc; });
+
+    const auto table_id = fmt::format("hle_stats_{}", ring.tid);
+    if (BeginTable(table_id.c_str(), 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Function", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Calls");
+        TableSetupColumn("Total (ms)");
+        TableSetupColumn("Avg (us)");
+        TableSetupColumn("Max (us)");
+        TableHeadersRow();
+        for (const auto& [func, stat] : sorted) {
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(ResolveName(func).c_str());
+            TableNextColumn();
+            Text("%llu", static_cast<unsigned long long>(stat.count));
+            TableNextColumn();
+            Text("%.3f", stat.total_tsc * tsc_to_us / 1000.0);
+            TableNextColumn();
+            Text("%.1f", stat.total_tsc * tsc_to_us / stat.count);
+            TableNextColumn();
+            Text("%.1f", stat.max_tsc * tsc_to_us);
+        }
+        EndTable();
+    }
+}
+
+void HleProfiler::Draw() {
+    SetNextWindowSize({550.0f, 420.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("HLE calls", &open)) {
+        End();
+        return;
+    }
+
+    bool enabled = HleTrace::enabled.load(std::memory_order_relaxed);
+    if (Checkbox("Trace calls", &enabled)) {
+        HleTrace::enabled.store(enabled, std::memory_order_relaxed);
+    }
+    SameLine();
+    TextDisabled("(last %zu calls per thread)", HleTrace::RingSize);
+
+    for (const auto* ring : HleTrace::GetRings()) {
+        const auto header =
+            fmt::format("{} ({})###hle_ring_{}", ring->name.empty() ? "unnamed" : ring->name,
+                        ring->tid, ring->tid);
+        if (CollapsingHeader(header.c_str())) {
+            DrawThreadRing(*ring);
+        }
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
@@ -0,0 +1,54 @@
+//  SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <imgui.h>
+
+#include "common/adaptive_mutex.h"
+#include "lock_stats.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+void LockStats::Draw() {
+    SetNextWindowSize({450.0f, 200.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Lock contention", &open)) {
+        End();
+        return;
+    }
+
+    int spin_budget = static_cast<int>(Common::GetAdaptiveSpinBudget());
+    if (SliderInt("Spin budget", &spin_budget, 0, 8192)) {
+        Common::SetAdaptiveSpinBudget(static_cast<u32>(spin_budget));
+    }
+
+    if (BeginTable("lock_stats", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Lock");
+        TableSetupColumn("Acquisitions");
+        TableSetupColumn("Contended %");
+        TableSetupColumn("Parked %");
+        TableHeadersRow();
+
+        for (const auto& stats : Common::GetMutexStats()) {
+            const auto percent_of = [&](u64 value) {
+                return stats.acquisitions > 0
+                           ? 100.0 * static_cast<double>(value) / stats.acquisitions
+                           : 0.0;
+            };
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(stats.name);
+            TableNextColumn();
+            Text("%llu", static_cast<unsigned long long>(stats.acquisitions));
+            TableNextColumn();
+            Text("%.2f", percent_of(stats.contended));
+            TableNextColumn();
+            Text("%.2f", percent_of(stats.parked));
+        }
+        EndTable();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
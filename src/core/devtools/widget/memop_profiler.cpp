@@ -0,0 +1,69 @@
+//  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <fmt/format.h>
+#include <imgui.h>
+
+#include "core/debug_state.h"
+#include "memop_profiler.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+static const char* FormatBytes(u64 bytes, char* buf, size_t buf_size) {
+    if (bytes >= 1_MB) {
+        snprintf(buf, buf_size, "%lluM", static_cast<unsigned long long>(bytes >> 20));
+    } else if (bytes >= 1_KB) {
+        snprintf(buf, buf_size, "%lluK", static_cast<unsigned long long>(bytes >> 10));
+    } else {
+        snprintf(buf, buf_size, "%llu", static_cast<unsigned long long>(bytes));
+    }
+    return buf;
+}
+
+static void DrawHistogram(const char* label, const DebugStateType::MemopHistogram& histogram) {
+    std::array<float, DebugStateType::MemopHistogram::NumBuckets> values;
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(histogram.buckets[i].load(std::memory_order_relaxed));
+    }
+    const u64 count = histogram.count.load(std::memory_order_relaxed);
+    const u64 total = histogram.total_bytes.load(std::memory_order_relaxed);
+    const u64 avg = count > 0 ? total / count : 0;
+    char avg_buf[16];
+    const auto overlay = fmt::format("{} | n={} avg={}B total={}MB", label, count,
+                                     FormatBytes(avg, avg_buf, sizeof(avg_buf)), total >> 20);
+    PlotHistogram(fmt::format("##{}", label).c_str(), values.data(),
+                  static_cast<int>(values.size()), 0, overlay.c_str(), FLT_MAX, FLT_MAX,
+                  {0.0f, 60.0f});
+    if (IsItemHovered()) {
+        SetTooltip("Buckets are powers of two starting at %llu bytes",
+                   static_cast<unsigned long long>(
+                       DebugStateType::MemopHistogram::FirstBucketBytes));
+    }
+}
+
+void MemopProfiler::Draw() {
+    SetNextWindowSize({450.0f, 280.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Guest memory routines", &open)) {
+        End();
+        return;
+    }
+
+    bool enabled = DebugState.memop_profiling_enabled.load(std::memory_order_relaxed);
+    if (Checkbox("Collect sizes", &enabled)) {
+        DebugState.memop_profiling_enabled.store(enabled, std::memory_order_relaxed);
+    }
+    SameLine();
+    if (Button("Reset")) {
+        DebugState.memcpy_sizes.Reset();
+        DebugState.memset_sizes.Reset();
+    }
+
+    DrawHistogram("memcpy", DebugState.memcpy_sizes);
+    DrawHistogram("memset", DebugState.memset_sizes);
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
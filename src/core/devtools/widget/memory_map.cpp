@@ -1,7 +1,11 @@
 //  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 //  SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cfloat>
 #include <cinttypes>
+#include <vector>
+
 #include <imgui.h>
 #include <magic_enum/magic_enum.hpp>
 
@@ -62,6 +66,93 @@ bool MemoryMapViewer::Iterator::DrawLine() {
     return true;
 }
 
+void MemoryMapViewer::DrawEvents() {
+    auto mem = Memory::Instance();
+
+    // Copy the ring oldest-first so the plots and the table work on a stable snapshot.
+    std::vector<MemoryManager::MemoryEvent> events;
+    {
+        std::scoped_lock lk{mem->event_mutex};
+        const u64 count = mem->memory_event_count;
+        const u64 num = std::min<u64>(count, MemoryManager::NumMemoryEvents);
+        events.reserve(num);
+        for (u64 i = 0; i < num; ++i) {
+            events.push_back(
+                mem->memory_events[(count - num + i) % MemoryManager::NumMemoryEvents]);
+        }
+    }
+
+    // Direct memory fragmentation summary; a shrinking largest free block with plenty of
+    // total free memory is the precursor of late-session allocation failures.
+    u64 free_total = 0;
+    u64 free_largest = 0;
+    u32 free_areas = 0;
+    {
+        std::shared_lock lk{mem->mutex};
+        for (const auto& [base, area] : mem->dmem_map) {
+            if (area.dma_type == PhysicalMemoryType::Free) {
+                free_total += area.size;
+                free_largest = std::max(free_largest, area.size);
+                ++free_areas;
+            }
+        }
+    }
+    Text("Direct memory free: %.1f MB in %u areas, largest block %.1f MB",
+         free_total / (1024.0 * 1024.0), free_areas, free_largest / (1024.0 * 1024.0));
+
+    constexpr int NumBuckets = 60;
+    std::array<float, NumBuckets> map_rate{};
+    std::array<float, NumBuckets> unmap_rate{};
+    if (!events.empty()) {
+        const u64 now_us = events.back().time_us;
+        for (const auto& e : events) {
+            const u64 age_s = (now_us - e.time_us) / 1'000'000;
+            if (age_s >= NumBuckets) {
+                continue;
+            }
+            auto& rate = e.is_map ? map_rate : unmap_rate;
+            rate[NumBuckets - 1 - age_s] += e.size / (1024.0f * 1024.0f);
+        }
+    }
+    PlotHistogram("Map MB/s", map_rate.data(), NumBuckets, 0, nullptr, 0.0f, FLT_MAX,
+                  {0.0f, 60.0f});
+    PlotHistogram("Unmap MB/s", unmap_rate.data(), NumBuckets, 0, nullptr, 0.0f, FLT_MAX,
+                  {0.0f, 60.0f});
+
+    if (BeginTable("memory_events_table", 5,
+                   ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg |
+                       ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY)) {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Time (s)");
+        TableSetupColumn("Op");
+        TableSetupColumn("Type");
+        TableSetupColumn("Address");
+        TableSetupColumn("Size");
+        TableHeadersRow();
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(events.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                // Newest events first.
+                const auto& e = events[events.size() - 1 - i];
+                TableNextRow();
+                TableNextColumn();
+                Text("%.3f", e.time_us / 1'000'000.0);
+                TableNextColumn();
+                TextUnformatted(e.is_map ? "map" : "unmap");
+                TableNextColumn();
+                Text("%s", magic_enum::enum_name(e.type).data());
+                TableNextColumn();
+                Text("%" PRIXPTR, e.addr);
+                TableNextColumn();
+                Text("%" PRIX64, e.size);
+            }
+        }
+        EndTable();
+    }
+}
+
 void MemoryMapViewer::Draw() {
     SetNextWindowSize({600.0f, 500.0f}, ImGuiCond_FirstUseEver);
     if (!Begin("Memory map", &open)) {
@@ -69,32 +160,33 @@ void MemoryMapViewer::Draw() {
         return;
     }
 
-    auto mem = Memory::Instance();
-    std::scoped_lock lck{mem->mutex};
-
-    {
-        bool next_showing_vma = showing_vma;
-        if (showing_vma) {
+    const auto view_button = [this](const char* label, View target) {
+        const bool active = view == target;
+        if (active) {
             PushStyleColor(ImGuiCol_Button, ImVec4{1.0f, 0.7f, 0.7f, 1.0f});
         }
-        if (Button("VMem")) {
-            next_showing_vma = true;
+        if (Button(label)) {
+            view = target;
         }
-        if (showing_vma) {
+        if (active) {
             PopStyleColor();
         }
-        SameLine();
-        if (!showing_vma) {
-            PushStyleColor(ImGuiCol_Button, ImVec4{1.0f, 0.7f, 0.7f, 1.0f});
-        }
-        if (Button("DMem")) {
-            next_showing_vma = false;
-        }
-        if (!showing_vma) {
-            PopStyleColor();
-        }
-        showing_vma = next_showing_vma;
+    };
+    view_button("VMem", View::VMem);
+    SameLine();
+    view_button("DMem", View::DMem);
+    SameLine();
+    view_button("Events", View::Events);
+
+    if (view == View::Events) {
+        DrawEvents();
+        End();
+        return;
     }
+    const bool showing_vma = view == View::VMem;
+
+    auto mem = Memory::Instance();
+    std::scoped_lock lck{mem->mutex};
 
     Iterator it{};
     if (showing_vma) {
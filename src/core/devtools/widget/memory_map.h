@@ -22,7 +22,15 @@ class MemoryMapViewer {
         bool DrawLine();
     };
 
-    bool showing_vma = true;
+    enum class View {
+        VMem,
+        DMem,
+        Events,
+    };
+
+    View view = View::VMem;
+
+    void DrawEvents();
 
 public:
     bool open = false;
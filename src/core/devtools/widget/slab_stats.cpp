@@ -0,0 +1,54 @@
+//  SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <imgui.h>
+
+#include "common/slab_heap.h"
+#include "slab_stats.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+void SlabStats::Draw() {
+    SetNextWindowSize({450.0f, 200.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Slab allocators", &open)) {
+        End();
+        return;
+    }
+
+    if (BeginTable("slab_stats", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Heap");
+        TableSetupColumn("Objects");
+        TableSetupColumn("Allocs");
+        TableSetupColumn("Magazine hit %");
+        TableSetupColumn("Frees");
+        TableSetupColumn("Flushes");
+        TableHeadersRow();
+
+        for (const auto& stats : Common::GetSlabHeapStats()) {
+            const double hit_rate =
+                stats.allocations > 0
+                    ? 100.0 * static_cast<double>(stats.magazine_hits) / stats.allocations
+                    : 0.0;
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(stats.name);
+            TableNextColumn();
+            Text("%zu", stats.total_objects);
+            TableNextColumn();
+            Text("%llu", static_cast<unsigned long long>(stats.allocations));
+            TableNextColumn();
+            Text("%.1f", hit_rate);
+            TableNextColumn();
+            Text("%llu", static_cast<unsigned long long>(stats.frees));
+            TableNextColumn();
+            Text("%llu", static_cast<unsigned long long>(stats.magazine_flushes));
+        }
+        EndTable();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
@@ -1078,15 +1078,22 @@ void TextEditor::Render(const char* aTitle, const ImVec2& aSize, bool aBorder) {
 
 void TextEditor::SetText(const std::string& aText) {
     mLines.clear();
-    mLines.emplace_back(Line());
-    for (auto chr : aText) {
-        if (chr == '\r') {
-            // ignore the carriage return character
-        } else if (chr == '\n')
-            mLines.emplace_back(Line());
-        else {
-            mLines.back().emplace_back(Glyph(chr, PaletteIndex::Default));
+    // Build line by line with reserved capacity; appending glyphs one at a time makes
+    // loading multi-MB shader dumps dominated by vector reallocation.
+    mLines.reserve(std::count(aText.begin(), aText.end(), '\n') + 1);
+    size_t lineStart = 0;
+    while (lineStart <= aText.size()) {
+        size_t lineEnd = aText.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+            lineEnd = aText.size();
+
+        auto& line = mLines.emplace_back();
+        line.reserve(lineEnd - lineStart);
+        for (size_t i = lineStart; i < lineEnd; ++i) {
+            if (aText[i] != '\r') // ignore the carriage return character
+                line.emplace_back(Glyph(aText[i], PaletteIndex::Default));
         }
+        lineStart = lineEnd + 1;
     }
 
     mTextChanged = true;
@@ -2027,18 +2034,28 @@ void TextEditor::ColorizeInternal() {
         return;
 
     if (mCheckComments) {
-        auto endLine = mLines.size();
-        auto endIndex = 0;
-        auto commentStartLine = endLine;
-        auto commentStartIndex = endIndex;
-        auto withinString = false;
-        auto withinSingleLineComment = false;
-        auto withinPreproc = false;
-        auto firstChar = true;    // there is no other non-whitespace characters in the line before
-        auto concatenate = false; // '\' on the very end of the line
-        auto currentLine = 0;
-        auto currentIndex = 0;
-        while (currentLine < endLine || currentIndex < endIndex) {
+        // Restart the resumable scan from the top of the document.
+        mCommentScan = CommentScan{};
+        mCheckComments = false;
+    }
+
+    // Scan at most this many lines per frame; a multi-MB dump becomes ready over a few
+    // frames instead of stalling the first one.
+    constexpr int CommentScanLinesPerFrame = 10000;
+    const int endLine = (int)mLines.size();
+    if (mCommentScan.mCurrentLine < endLine) {
+        auto& scan = mCommentScan;
+        auto& commentStartLine = scan.mCommentStartLine;
+        auto& commentStartIndex = scan.mCommentStartIndex;
+        auto& withinString = scan.mWithinString;
+        auto& withinSingleLineComment = scan.mWithinSingleLineComment;
+        auto& withinPreproc = scan.mWithinPreproc;
+        auto& firstChar = scan.mFirstChar; // no other non-whitespace characters before in the line
+        auto& concatenate = scan.mConcatenate; // '\' on the very end of the line
+        auto& currentLine = scan.mCurrentLine;
+        auto& currentIndex = scan.mCurrentIndex;
+        const int scanEndLine = std::min(endLine, currentLine + CommentScanLinesPerFrame);
+        while (currentLine < scanEndLine) {
             auto& line = mLines[currentLine];
 
             if (currentIndex == 0 && !concatenate) {
@@ -2049,7 +2066,7 @@ void TextEditor::ColorizeInternal() {
 
             concatenate = false;
 
-            if (!line.empty()) {
+            if (!line.empty() && currentIndex < (int)line.size()) {
                 auto& g = line[currentIndex];
                 auto c = g.mChar;
 
@@ -2105,7 +2122,7 @@ void TextEditor::ColorizeInternal() {
                             commentStartIndex = currentIndex;
                         }
 
-                        inComment = inComment =
+                        inComment =
                             (commentStartLine < currentLine || (commentStartLine == currentLine &&
                                                                 commentStartIndex <= currentIndex));
 
@@ -2116,8 +2133,8 @@ void TextEditor::ColorizeInternal() {
                         if (currentIndex + 1 >= (int)endStr.size() &&
                             equals(endStr.begin(), endStr.end(), from + 1 - endStr.size(), from + 1,
                                    pred)) {
-                            commentStartIndex = endIndex;
-                            commentStartLine = endLine;
+                            commentStartIndex = 0;
+                            commentStartLine = std::numeric_limits<int>::max();
                         }
                     }
                 }
@@ -2132,7 +2149,6 @@ void TextEditor::ColorizeInternal() {
                 ++currentLine;
             }
         }
-        mCheckComments = false;
     }
 
     if (mColorRangeMin < mColorRangeMax) {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <array>
+#include <limits>
 #include <map>
 #include <memory>
 #include <regex>
@@ -396,6 +397,20 @@ private:
     RegexList mRegexList;
 
     bool mCheckComments;
+    // Resumable state of the comment/preprocessor scan, so multi-MB documents are
+    // processed over several frames instead of stalling on the first one.
+    struct CommentScan {
+        int mCurrentLine = 0;
+        int mCurrentIndex = 0;
+        int mCommentStartLine = std::numeric_limits<int>::max();
+        int mCommentStartIndex = 0;
+        bool mWithinString = false;
+        bool mWithinSingleLineComment = false;
+        bool mWithinPreproc = false;
+        bool mFirstChar = true;
+        bool mConcatenate = false;
+    };
+    CommentScan mCommentScan;
     Breakpoints mBreakpoints;
     ErrorMarkers mErrorMarkers;
     ImVec2 mCharAdvance;
@@ -0,0 +1,126 @@
+//  SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include <imgui.h>
+
+#include "core/debug_state.h"
+#include "texture_stats.h"
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+enum TextureStatsColumn : ImGuiID {
+    Column_Address,
+    Column_Size,
+    Column_Extent,
+    Column_Format,
+    Column_Binds,
+    Column_Upload,
+    Column_Detile,
+};
+
+static void SortImages(std::vector<DebugStateType::TextureFrameStat>& images,
+                       const ImGuiTableSortSpecs* specs) {
+    if (specs == nullptr || specs->SpecsCount == 0) {
+        return;
+    }
+    const auto& spec = specs->Specs[0];
+    std::stable_sort(images.begin(), images.end(), [&spec](const auto& lhs, const auto& rhs) {
+        const auto cmp = [&spec](auto a, auto b) {
+            return spec.SortDirection == ImGuiSortDirection_Ascending ? a < b : b < a;
+        };
+        switch (spec.ColumnUserID) {
+        case Column_Size:
+            return cmp(lhs.guest_size, rhs.guest_size);
+        case Column_Extent:
+            return cmp(u64(lhs.width) * lhs.height, u64(rhs.width) * rhs.height);
+        case Column_Format:
+            return spec.SortDirection == ImGuiSortDirection_Ascending ? lhs.format < rhs.format
+                                                                      : rhs.format < lhs.format;
+        case Column_Binds:
+            return cmp(lhs.binds, rhs.binds);
+        case Column_Upload:
+            return cmp(lhs.upload_bytes, rhs.upload_bytes);
+        case Column_Detile:
+            return cmp(lhs.detile_ns, rhs.detile_ns);
+        case Column_Address:
+        default:
+            return cmp(lhs.guest_address, rhs.guest_address);
+        }
+    });
+}
+
+void TextureStats::Draw() {
+    SetNextWindowSize({700.0f, 400.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Texture usage", &open)) {
+        End();
+        return;
+    }
+
+    bool enabled = DebugState.texture_stats_enabled;
+    if (Checkbox("Enable collection", &enabled)) {
+        DebugState.texture_stats_enabled = enabled;
+    }
+    if (IsItemHovered()) {
+        SetTooltip("Counts binds, uploads and detile time per cached image every frame");
+    }
+
+    DebugStateType::TextureFrameStats stats;
+    {
+        std::scoped_lock lock{DebugState.texture_stats_mutex};
+        stats = DebugState.texture_stats;
+    }
+
+    Text("Images touched: %u  Binds: %u  Evictions: %u", stats.total_images, stats.total_binds,
+         stats.evictions);
+    Text("Upload: %.2f MB/frame  Detile: %.3f ms/frame",
+         stats.total_upload_bytes / (1024.0 * 1024.0), stats.total_detile_ns / 1'000'000.0);
+
+    constexpr auto table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                                 ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+    if (BeginTable("texture_stats", 7, table_flags)) {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Address", ImGuiTableColumnFlags_DefaultSort, 0.0f, Column_Address);
+        TableSetupColumn("Size", 0, 0.0f, Column_Size);
+        TableSetupColumn("Extent", 0, 0.0f, Column_Extent);
+        TableSetupColumn("Format", 0, 0.0f, Column_Format);
+        TableSetupColumn("Binds", 0, 0.0f, Column_Binds);
+        TableSetupColumn("Upload (KB)", 0, 0.0f, Column_Upload);
+        TableSetupColumn("Detile (us)", 0, 0.0f, Column_Detile);
+        TableHeadersRow();
+
+        SortImages(stats.images, TableGetSortSpecs());
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(stats.images.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                const auto& image = stats.images[i];
+                TableNextRow();
+                TableNextColumn();
+                Text("%08llx", static_cast<unsigned long long>(image.guest_address));
+                TableNextColumn();
+                Text("%.1f KB", image.guest_size / 1024.0);
+                TableNextColumn();
+                Text("%ux%u", image.width, image.height);
+                TableNextColumn();
+                TextUnformatted(image.format.c_str());
+                TableNextColumn();
+                Text("%u", image.binds);
+                TableNextColumn();
+                Text("%.1f", image.upload_bytes / 1024.0);
+                TableNextColumn();
+                Text("%.1f", image.detile_ns / 1000.0);
+            }
+        }
+        EndTable();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
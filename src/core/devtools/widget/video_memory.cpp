@@ -0,0 +1,87 @@
+//  SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+//  SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <memory>
+
+#include <imgui.h>
+#include <vk_mem_alloc.h>
+
+#include "common/types.h"
+#include "video_core/renderer_vulkan/vk_presenter.h"
+#include "video_memory.h"
+
+extern std::unique_ptr<Vulkan::Presenter> presenter;
+
+using namespace ImGui;
+
+namespace Core::Devtools::Widget {
+
+constexpr float MB = 1024.0f * 1024.0f;
+
+void VideoMemory::Draw() {
+    SetNextWindowSize({680.0f, 280.0f}, ImGuiCond_FirstUseEver);
+    if (!Begin("Video memory", &open)) {
+        End();
+        return;
+    }
+
+    const auto& instance = presenter->GetInstance();
+    const auto allocator = instance.GetAllocator();
+    const auto mem_props = instance.GetPhysicalDevice().getMemoryProperties();
+
+    std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+    vmaGetHeapBudgets(allocator, budgets.data());
+
+    // Walks every block of every memory type, but that is acceptable at widget refresh rate.
+    VmaTotalStatistics stats{};
+    vmaCalculateStatistics(allocator, &stats);
+
+    const auto& total = stats.total.statistics;
+    Text("Driver allocations: %u blocks holding %u suballocations", total.blockCount,
+         total.allocationCount);
+    Text("Used %.1f MB of %.1f MB reserved, %.1f MB free across %u ranges",
+         total.allocationBytes / MB, total.blockBytes / MB,
+         (total.blockBytes - total.allocationBytes) / MB, stats.total.unusedRangeCount);
+    if (IsItemHovered()) {
+        SetTooltip("Free bytes spread over many small ranges indicate fragmentation\n"
+                   "inside the allocator's memory blocks");
+    }
+
+    if (BeginTable("vma_heaps", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        TableSetupColumn("Heap");
+        TableSetupColumn("Blocks");
+        TableSetupColumn("Suballocations");
+        TableSetupColumn("Used (MB)");
+        TableSetupColumn("Reserved (MB)");
+        TableSetupColumn("Process usage (MB)");
+        TableSetupColumn("Budget (MB)");
+        TableHeadersRow();
+        for (u32 heap = 0; heap < mem_props.memoryHeapCount; ++heap) {
+            const auto& heap_stats = stats.memoryHeap[heap].statistics;
+            const auto& budget = budgets[heap];
+            const bool device_local =
+                bool(mem_props.memoryHeaps[heap].flags & vk::MemoryHeapFlagBits::eDeviceLocal);
+            TableNextRow();
+            TableNextColumn();
+            Text("%u%s", heap, device_local ? " (device)" : "");
+            TableNextColumn();
+            Text("%u", heap_stats.blockCount);
+            TableNextColumn();
+            Text("%u", heap_stats.allocationCount);
+            TableNextColumn();
+            Text("%.1f", heap_stats.allocationBytes / MB);
+            TableNextColumn();
+            Text("%.1f", heap_stats.blockBytes / MB);
+            TableNextColumn();
+            Text("%.1f", budget.usage / MB);
+            TableNextColumn();
+            Text("%.1f", budget.budget / MB);
+        }
+        EndTable();
+    }
+
+    End();
+}
+
+} // namespace Core::Devtools::Widget
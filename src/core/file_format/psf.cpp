@@ -37,6 +37,12 @@ bool PSF::Open(const std::filesystem::path& filepath) {
 
     const u64 psfSize = file.GetSize();
     ASSERT_MSG(psfSize != 0, "SFO file at {} is empty!", filepath.string());
+
+    // Parse straight out of a read-only mapping; the tables are copied into the maps anyway.
+    if (const auto mapped = file.MapReadOnly(); !mapped.empty()) {
+        return Open(mapped);
+    }
+
     std::vector<u8> psf(psfSize);
     file.Seek(0);
     file.Read(psf);
@@ -44,7 +50,7 @@ bool PSF::Open(const std::filesystem::path& filepath) {
     return Open(psf);
 }
 
-bool PSF::Open(const std::vector<u8>& psf_buffer) {
+bool PSF::Open(std::span<const u8> psf_buffer) {
     const u8* psf_data = psf_buffer.data();
 
     entry_list.clear();
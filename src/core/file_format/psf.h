@@ -57,7 +57,7 @@ public:
     PSF& operator=(PSF&& other) noexcept = default;
 
     bool Open(const std::filesystem::path& filepath);
-    bool Open(const std::vector<u8>& psf_buffer);
+    bool Open(std::span<const u8> psf_buffer);
 
     [[nodiscard]] std::vector<u8> Encode() const;
     void Encode(std::vector<u8>& buf) const;
@@ -43,34 +43,49 @@ static void hexToBytes(const char* hex, unsigned char* dst) {
     }
 }
 
-bool TRP::Extract(const std::filesystem::path& trophyPath, const std::string titleId) {
+bool TRP::Extract(const std::filesystem::path& trophyPath, const std::string titleId,
+                  bool extract_icons) {
+    return ExtractEntries(trophyPath, titleId, extract_icons, true);
+}
+
+bool TRP::ExtractIcons(const std::filesystem::path& trophyPath, const std::string titleId) {
+    return ExtractEntries(trophyPath, titleId, true, false);
+}
+
+bool TRP::ExtractEntries(const std::filesystem::path& trophyPath, const std::string& titleId,
+                         bool extract_icons, bool extract_xml) {
     std::filesystem::path gameSysDir = trophyPath / "sce_sys/trophy/";
     if (!std::filesystem::exists(gameSysDir)) {
         LOG_WARNING(Common_Filesystem, "Game trophy directory doesn't exist");
         return false;
     }
 
-    const auto& user_key_vec =
-        KeyManager::GetInstance()->GetAllKeys().TrophyKeySet.ReleaseTrophyKey;
-
-    if (user_key_vec.size() != 16) {
-        LOG_INFO(Common_Filesystem, "Trophy decryption key is not specified");
-        return false;
-    }
-
     std::array<u8, 16> user_key{};
-    std::copy(user_key_vec.begin(), user_key_vec.end(), user_key.begin());
+    std::vector<std::string> npCommIds;
+    if (extract_xml) {
+        // Only the ESFM entries are encrypted; icon-only passes don't need the
+        // key or the NPComm IDs.
+        const auto& user_key_vec =
+            KeyManager::GetInstance()->GetAllKeys().TrophyKeySet.ReleaseTrophyKey;
+
+        if (user_key_vec.size() != 16) {
+            LOG_INFO(Common_Filesystem, "Trophy decryption key is not specified");
+            return false;
+        }
 
-    // Load npbind.dat using the new class
-    std::filesystem::path npbindPath = trophyPath / "sce_sys/npbind.dat";
-    NPBindFile npbind;
-    if (!npbind.Load(npbindPath.string())) {
-        LOG_WARNING(Common_Filesystem, "Failed to load npbind.dat file");
-    }
+        std::copy(user_key_vec.begin(), user_key_vec.end(), user_key.begin());
+
+        // Load npbind.dat using the new class
+        std::filesystem::path npbindPath = trophyPath / "sce_sys/npbind.dat";
+        NPBindFile npbind;
+        if (!npbind.Load(npbindPath.string())) {
+            LOG_WARNING(Common_Filesystem, "Failed to load npbind.dat file");
+        }
 
-    auto npCommIds = npbind.GetNpCommIds();
-    if (npCommIds.empty()) {
-        LOG_WARNING(Common_Filesystem, "No NPComm IDs found in npbind.dat");
+        npCommIds = npbind.GetNpCommIds();
+        if (npCommIds.empty()) {
+            LOG_WARNING(Common_Filesystem, "No NPComm IDs found in npbind.dat");
+        }
     }
 
     bool success = true;
@@ -100,6 +115,8 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, const std::string tit
                 success = false;
                 continue;
             }
+            // The entry table is walked with many small sequential reads.
+            file.SetBufferSize(64_KB);
 
             TrpHeader header;
             if (!file.Read(header)) {
@@ -120,9 +137,12 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, const std::string tit
                 Common::FS::GetUserPath(Common::FS::PathType::MetaDataDir) / titleId /
                 "TrophyFiles" / it.path().stem());
 
-            // Create output directories
-            if (!std::filesystem::create_directories(trpFilesPath / "Icons") ||
-                !std::filesystem::create_directories(trpFilesPath / "Xml")) {
+            // Create output directories (they already exist when backfilling
+            // icons after an index-only extraction)
+            std::filesystem::create_directories(trpFilesPath / "Icons");
+            std::filesystem::create_directories(trpFilesPath / "Xml");
+            if (!std::filesystem::is_directory(trpFilesPath / "Icons") ||
+                !std::filesystem::is_directory(trpFilesPath / "Xml")) {
                 LOG_ERROR(Common_Filesystem, "Failed to create output directories for {}", titleId);
                 success = false;
                 continue;
@@ -147,11 +167,17 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, const std::string tit
                 std::string_view name(entry.entry_name);
 
                 if (entry.flag == ENTRY_FLAG_PNG) {
+                    if (!extract_icons) {
+                        continue; // Backfilled later by ExtractIcons()
+                    }
                     if (!ProcessPngEntry(file, entry, trpFilesPath, name)) {
                         success = false;
                         // Continue with next entry
                     }
                 } else if (entry.flag == ENTRY_FLAG_ENCRYPTED_XML) {
+                    if (!extract_xml) {
+                        continue;
+                    }
                     // Check if we have a valid NPCommID for decryption
                     if (npCommId.size() >= 12 && npCommId[0] == 'N' && npCommId[1] == 'P') {
                         if (!ProcessEncryptedXmlEntry(file, entry, trpFilesPath, name, user_key,
@@ -190,6 +216,10 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, const std::string tit
 
 bool TRP::ProcessPngEntry(Common::FS::IOFile& file, const TrpEntry& entry,
                           const std::filesystem::path& outputPath, std::string_view name) {
+    if (std::filesystem::exists(outputPath / "Icons" / name)) {
+        return true; // Already extracted on a previous pass
+    }
+
     if (!file.Seek(entry.entry_pos)) {
         LOG_ERROR(Common_Filesystem, "Failed to seek to PNG entry offset");
         return false;
@@ -36,9 +36,17 @@ class TRP {
 public:
     TRP();
     ~TRP();
-    bool Extract(const std::filesystem::path& trophyPath, const std::string titleId);
+    // Extracts the trophy definitions, and the icons too unless extract_icons
+    // is false (they are by far the bulk of the archive and only needed once
+    // something actually displays one).
+    bool Extract(const std::filesystem::path& trophyPath, const std::string titleId,
+                 bool extract_icons = true);
+    // Backfills just the PNG entries after an index-only extraction.
+    bool ExtractIcons(const std::filesystem::path& trophyPath, const std::string titleId);
 
 private:
+    bool ExtractEntries(const std::filesystem::path& trophyPath, const std::string& titleId,
+                        bool extract_icons, bool extract_xml);
     bool ProcessPngEntry(Common::FS::IOFile& file, const TrpEntry& entry,
                          const std::filesystem::path& outputPath, std::string_view name);
     bool ProcessEncryptedXmlEntry(Common::FS::IOFile& file, const TrpEntry& entry,
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include "common/assert.h"
 #include "common/config.h"
 #include "common/string_util.h"
 #include "core/file_sys/devices/logger.h"
@@ -193,45 +194,55 @@ void MntPoints::IterateDirectory(std::string_view guest_directory,
     }
 }
 
+HandleTable::HandleTable() {
+    m_file_heap_memory = std::make_unique<u8[]>(FileHeapObjects * sizeof(File));
+    m_file_heap.Initialize("File", m_file_heap_memory.get(), FileHeapObjects * sizeof(File));
+}
+
 int HandleTable::CreateHandle() {
     std::scoped_lock lock{m_mutex};
 
-    auto* file = new File{};
+    auto* file = m_file_heap.Allocate();
+    if (file == nullptr) {
+        return -1;
+    }
     file->is_opened = false;
 
-    int existingFilesNum = m_files.size();
-
-    for (int index = 0; index < existingFilesNum; index++) {
-        if (m_files.at(index) == nullptr) {
-            m_files[index] = file;
+    for (int index = 0; index < MaxFiles; index++) {
+        if (m_files[index].load(std::memory_order_relaxed) == nullptr) {
+            // Release pairs with the acquire in GetFile so readers observe the
+            // fully constructed File.
+            m_files[index].store(file, std::memory_order_release);
             return index;
         }
     }
 
-    m_files.push_back(file);
-    return m_files.size() - 1;
+    std::destroy_at(file);
+    m_file_heap.Free(file);
+    return -1;
 }
 
 void HandleTable::DeleteHandle(int d) {
     std::scoped_lock lock{m_mutex};
-    delete m_files.at(d);
-    m_files[d] = nullptr;
+    if (d < 0 || d >= MaxFiles) {
+        return;
+    }
+    if (auto* file = m_files[d].exchange(nullptr)) {
+        // The slab only recycles memory; run the destructor so the host file closes.
+        std::destroy_at(file);
+        m_file_heap.Free(file);
+    }
 }
 
 File* HandleTable::GetFile(int d) {
-    std::scoped_lock lock{m_mutex};
-    if (d < 0 || d >= m_files.size()) {
+    if (d < 0 || d >= MaxFiles) {
         return nullptr;
     }
-    return m_files.at(d);
+    return m_files[d].load(std::memory_order_acquire);
 }
 
 File* HandleTable::GetSocket(int d) {
-    std::scoped_lock lock{m_mutex};
-    if (d < 0 || d >= m_files.size()) {
-        return nullptr;
-    }
-    auto file = m_files.at(d);
+    auto* file = GetFile(d);
     if (!file) {
         return nullptr;
     }
@@ -242,11 +253,10 @@ File* HandleTable::GetSocket(int d) {
 }
 
 File* HandleTable::GetEpoll(int d) {
-    std::scoped_lock lock{m_mutex};
-    if (d < 0 || d >= m_files.size()) {
+    auto* file = GetFile(d);
+    if (!file) {
         return nullptr;
     }
-    auto file = m_files.at(d);
     if (file->type != Core::FileSys::FileType::Epoll) {
         return nullptr;
     }
@@ -254,11 +264,10 @@ File* HandleTable::GetEpoll(int d) {
 }
 
 File* HandleTable::GetResolver(int d) {
-    std::scoped_lock lock{m_mutex};
-    if (d < 0 || d >= m_files.size()) {
+    auto* file = GetFile(d);
+    if (!file) {
         return nullptr;
     }
-    auto file = m_files.at(d);
     if (file->type != Core::FileSys::FileType::Resolver) {
         return nullptr;
     }
@@ -266,7 +275,9 @@ File* HandleTable::GetResolver(int d) {
 }
 
 File* HandleTable::GetFile(const std::filesystem::path& host_name) {
-    for (auto* file : m_files) {
+    std::scoped_lock lock{m_mutex};
+    for (auto& slot : m_files) {
+        auto* file = slot.load(std::memory_order_acquire);
         if (file != nullptr && file->m_host_name == host_name) {
             return file;
         }
@@ -277,6 +288,7 @@ File* HandleTable::GetFile(const std::filesystem::path& host_name) {
 void HandleTable::CreateStdHandles() {
     auto setup = [this](const char* path, auto* device) {
         int fd = CreateHandle();
+        ASSERT_MSG(fd >= 0, "Out of file descriptors while creating std handles");
         auto* file = GetFile(fd);
         file->is_opened = true;
         file->type = FileType::Device;
@@ -292,10 +304,10 @@ void HandleTable::CreateStdHandles() {
 
 int HandleTable::GetFileDescriptor(File* file) {
     std::scoped_lock lock{m_mutex};
-    auto it = std::find(m_files.begin(), m_files.end(), file);
-
-    if (it != m_files.end()) {
-        return std::distance(m_files.begin(), it);
+    for (int index = 0; index < MaxFiles; index++) {
+        if (m_files[index].load(std::memory_order_relaxed) == file) {
+            return index;
+        }
     }
     return 0;
 }
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -11,6 +13,7 @@
 #include <tsl/robin_map.h>
 #include "common/io_file.h"
 #include "common/logging/formatter.h"
+#include "common/slab_heap.h"
 #include "core/file_sys/devices/base_device.h"
 #include "core/file_sys/directories/base_directory.h"
 
@@ -89,12 +92,35 @@ enum class FileType {
     Equeue
 };
 
+// Sequential read-ahead state for regular files, guarded by the owning File's
+// mutex. Small reads that continue where the previous one ended are served from
+// a larger buffered chunk, so streaming patterns issue a few large host reads
+// instead of many tiny ones; see ReadFile in kernel/file_system.cpp.
+struct ReadAhead {
+    static constexpr u64 ChunkSize = 256_KB;
+    /// Requests larger than this already amortize host latency on their own.
+    static constexpr u64 MaxRequestSize = 64_KB;
+    /// Consecutive sequential reads required before read-ahead kicks in.
+    static constexpr u32 SequentialThreshold = 4;
+
+    std::vector<u8> buffer;
+    u64 buffer_offset{}; ///< File offset the buffer was filled from
+    u64 buffer_size{};   ///< Valid bytes in the buffer
+    u64 expected_offset{};
+    u32 sequential_hits{};
+
+    void Invalidate() {
+        buffer_size = 0;
+    }
+};
+
 struct File {
     std::atomic_bool is_opened{};
     std::atomic<FileType> type{FileType::Regular};
     std::filesystem::path m_host_name;
     std::string m_guest_name;
     Common::FS::IOFile f;
+    ReadAhead read_ahead;
     std::mutex m_mutex;
     std::shared_ptr<Directories::BaseDirectory> directory; // only valid for type == Directory
     std::shared_ptr<Devices::BaseDevice> device;           // only valid for type == Device
@@ -105,7 +131,7 @@ struct File {
 
 class HandleTable {
 public:
-    HandleTable() = default;
+    HandleTable();
     virtual ~HandleTable() = default;
 
     int CreateHandle();
@@ -120,8 +146,21 @@ public:
     void CreateStdHandles();
 
 private:
-    std::vector<File*> m_files;
+    /// Orbis caps open descriptors well below this.
+    static constexpr int MaxFiles = 1024;
+
+    // Slots are atomic so descriptor resolution on the read path is a bounds
+    // check plus a load; the mutex only serializes creation, deletion and the
+    // rarely used scans.
+    std::array<std::atomic<File*>, MaxFiles> m_files{};
     std::mutex m_mutex;
+
+    // File objects are recycled through a magazine-cached slab instead of the host heap, since
+    // some titles churn descriptors hard enough to show up as malloc contention. The slab has
+    // headroom over MaxFiles because freed objects can linger in per-thread magazines.
+    static constexpr size_t FileHeapObjects = MaxFiles + 256;
+    std::unique_ptr<u8[]> m_file_heap_memory;
+    Common::CachedSlabHeap<File> m_file_heap;
 };
 
 } // namespace Core::FileSys
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <mutex>
+
+#include "common/thread.h"
+#include "core/hle_trace.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+namespace Core::HleTrace {
+
+std::atomic_bool enabled{false};
+
+static std::mutex rings_mutex;
+static std::vector<std::unique_ptr<ThreadRing>> rings;
+
+ThreadRing* GetThreadRing() {
+    thread_local ThreadRing* ring = [] {
+        auto new_ring = std::make_unique<ThreadRing>();
+#ifdef _WIN32
+        new_ring->tid = GetCurrentThreadId();
+#else
+        new_ring->tid = reinterpret_cast<u64>(pthread_self());
+#endif
+        new_ring->name = Common::GetCurrentThreadName();
+        std::scoped_lock lock{rings_mutex};
+        rings.push_back(std::move(new_ring));
+        return rings.back().get();
+    }();
+    return ring;
+}
+
+std::vector<ThreadRing*> GetRings() {
+    std::scoped_lock lock{rings_mutex};
+    std::vector<ThreadRing*> result;
+    result.reserve(rings.size());
+    for (const auto& ring : rings) {
+        result.push_back(ring.get());
+    }
+    return result;
+}
+
+} // namespace Core::HleTrace
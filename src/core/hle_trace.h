@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "common/types.h"
+
+namespace Core::HleTrace {
+
+/// One HLE call: the host wrapper that ran and its raw rdtsc entry/exit stamps.
+struct Record {
+    const void* func;
+    u64 tsc_in;
+    u64 tsc_out;
+};
+
+/// Records kept per thread; must be a power of two.
+static constexpr size_t RingSize = 4096;
+
+/// Fixed-size per-thread call ring. The owning thread writes lock-free and
+/// never allocates; the devtools drain reads racily and tolerates tearing on
+/// the oldest entries about to be overwritten.
+struct ThreadRing {
+    u64 tid{};
+    std::string name;
+    std::atomic<u64> head{};
+    std::array<Record, RingSize> records{};
+};
+
+/// Toggled from the devtools HLE profiler. While off, tracing costs one
+/// relaxed load and a predicted branch per HLE call.
+extern std::atomic_bool enabled;
+
+/// Returns the calling thread's ring, registering it on first use.
+ThreadRing* GetThreadRing();
+
+inline void Push(const void* func, u64 tsc_in, u64 tsc_out) {
+    ThreadRing* ring = GetThreadRing();
+    const u64 slot = ring->head.load(std::memory_order_relaxed);
+    ring->records[slot & (RingSize - 1)] = {func, tsc_in, tsc_out};
+    ring->head.store(slot + 1, std::memory_order_release);
+}
+
+/// Snapshot of all per-thread rings for the devtools drain. Rings are never
+/// freed, so the pointers stay valid for the lifetime of the process.
+std::vector<ThreadRing*> GetRings();
+
+} // namespace Core::HleTrace
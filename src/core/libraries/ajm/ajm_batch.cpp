@@ -206,6 +206,8 @@ AjmJob AjmJobFromBatchBuffer(u32 instance_id, AjmBatchBuffer batch_buffer) {
     AjmJob job;
     job.instance_id = instance_id;
 
+    boost::container::small_vector<std::span<u8>, 8> input_buffers;
+
     // Read parameters of a job
     while (!batch_buffer.IsEmpty()) {
         auto& header = batch_buffer.Peek<AjmChunkHeader>();
@@ -213,7 +215,9 @@ AjmJob AjmJobFromBatchBuffer(u32 instance_id, AjmBatchBuffer batch_buffer) {
         case Identifier::AjmIdentInputRunBuf: {
             auto& buffer = batch_buffer.Consume<AjmChunkBuffer>();
             u8* p_begin = reinterpret_cast<u8*>(buffer.p_address);
-            job.input.buffer.insert(job.input.buffer.end(), p_begin, p_begin + buffer.size);
+            if (p_begin != nullptr && buffer.size != 0) {
+                input_buffers.emplace_back(p_begin, buffer.size);
+            }
             break;
         }
         case Identifier::AjmIdentInputControlBuf: {
@@ -264,6 +268,22 @@ AjmJob AjmJobFromBatchBuffer(u32 instance_id, AjmBatchBuffer batch_buffer) {
     ASSERT(job_flags.has_value());
     job.flags = job_flags.value();
 
+    // Decode straight out of the guest buffer when the input is a single
+    // chunk; only split inputs need gathering into contiguous storage.
+    if (input_buffers.size() == 1) {
+        job.input.buffer = input_buffers.front();
+    } else if (!input_buffers.empty()) {
+        size_t total_size = 0;
+        for (const auto& buffer : input_buffers) {
+            total_size += buffer.size();
+        }
+        job.input.gather.reserve(total_size);
+        for (const auto& buffer : input_buffers) {
+            job.input.gather.insert(job.input.gather.end(), buffer.begin(), buffer.end());
+        }
+        job.input.buffer = job.input.gather;
+    }
+
     // Initialize sideband input parameters
     if (input_control_buffer.has_value()) {
         AjmBatchBuffer input_batch(input_control_buffer.value());
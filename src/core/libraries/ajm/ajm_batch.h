@@ -26,7 +26,12 @@ struct AjmJob {
         std::optional<AjmSidebandStatisticsEngineParameters> statistics_engine_parameters;
         std::optional<AjmSidebandFormat> format;
         std::optional<AjmSidebandGaplessDecode> gapless_decode;
-        std::vector<u8> buffer;
+        // Points directly at guest memory for the common single run-buffer
+        // case; the batch buffer stays alive until BatchWait destroys the
+        // batch. Jobs with several input chunks are gathered into `gather`
+        // and `buffer` spans it instead.
+        std::span<u8> buffer;
+        std::vector<u8> gather;
     };
 
     struct Output {
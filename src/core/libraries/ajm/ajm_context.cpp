@@ -13,6 +13,7 @@
 #include "core/libraries/ajm/ajm_mp3.h"
 #include "core/libraries/error_codes.h"
 
+#include <algorithm>
 #include <span>
 #include <utility>
 
@@ -23,6 +24,9 @@ constexpr int INSTANCE_ID_MASK = 0x3FFF;
 
 AjmContext::AjmContext() {
     worker_thread = std::jthread([this](std::stop_token stop) { this->WorkerThread(stop); });
+    for (auto& worker : decode_workers) {
+        worker = std::jthread([this](std::stop_token stop) { this->DecodeWorkerThread(stop); });
+    }
 }
 
 bool AjmContext::IsRegistered(AjmCodecType type) const {
@@ -63,35 +67,94 @@ s32 AjmContext::ModuleRegister(AjmCodecType type) {
 void AjmContext::WorkerThread(std::stop_token stop) {
     Common::SetCurrentThreadName("shadPS4:AjmWorker");
     while (!stop.stop_requested()) {
-        auto batch = batch_queue.PopWait(stop);
-        if (batch != nullptr && !batch->canceled) {
-            bool expected = false;
-            batch->processed.compare_exchange_strong(expected, true);
-            ProcessBatch(batch->id, batch->jobs);
-            batch->finished.release();
+        // Drain everything queued with one ticket claim; titles submitting one batch
+        // per voice per tick otherwise pay a queue round trip for each of them.
+        std::array<std::shared_ptr<AjmBatch>, 8> pending{};
+        pending[0] = batch_queue.PopWait(stop);
+        const size_t num_pending = 1 + batch_queue.TryPopBatch(std::span{pending}.subspan(1));
+        for (size_t i = 0; i < num_pending; ++i) {
+            auto& batch = pending[i];
+            if (batch != nullptr && !batch->canceled) {
+                bool expected = false;
+                batch->processed.compare_exchange_strong(expected, true);
+                ProcessBatch(batch->id, batch->jobs);
+                batch->finished.release();
+            }
+        }
+    }
+}
+
+void AjmContext::DecodeWorkerThread(std::stop_token stop) {
+    Common::SetCurrentThreadName("shadPS4:AjmDecode");
+    while (!stop.stop_requested()) {
+        auto group = decode_queue.PopWait(stop);
+        if (group.done == nullptr) {
+            continue;
+        }
+        for (auto* job : group.jobs) {
+            ExecuteJob(group.batch_id, *job);
         }
+        group.done->release();
+    }
+}
+
+void AjmContext::ExecuteJob(u32 batch_id, AjmJob& job) {
+    LOG_TRACE(Lib_Ajm, "Processing job {} for instance {}. flags = {:#x}", batch_id,
+              job.instance_id, job.flags.raw);
+
+    if (job.instance_id == AJM_INSTANCE_STATISTICS) {
+        AjmInstanceStatistics::Getinstance().ExecuteJob(job);
+    } else {
+        std::shared_ptr<AjmInstance> instance;
+        {
+            std::shared_lock lock(instances_mutex);
+            auto* p_instance = instances.Get(job.instance_id & INSTANCE_ID_MASK);
+            ASSERT_MSG(p_instance != nullptr, "Attempting to execute job on null instance");
+            instance = *p_instance;
+        }
+
+        instance->ExecuteJob(job);
     }
 }
 
 void AjmContext::ProcessBatch(u32 id, std::span<AjmJob> jobs) {
-    // Perform operation requested by control flags.
+    // Group the batch by instance. Codec state makes jobs targeting the same
+    // instance sequential, but distinct instances are independent; titles
+    // queue a dozen or more voice decodes per batch, so fan the groups out
+    // across the decode workers instead of serializing them.
+    boost::container::small_vector<JobGroup, 8> groups;
     for (auto& job : jobs) {
-        LOG_TRACE(Lib_Ajm, "Processing job {} for instance {}. flags = {:#x}", id, job.instance_id,
-                  job.flags.raw);
-
-        if (job.instance_id == AJM_INSTANCE_STATISTICS) {
-            AjmInstanceStatistics::Getinstance().ExecuteJob(job);
+        const auto it = std::ranges::find_if(groups, [&](const JobGroup& group) {
+            return group.jobs.front()->instance_id == job.instance_id;
+        });
+        if (it != groups.end()) {
+            it->jobs.push_back(&job);
         } else {
-            std::shared_ptr<AjmInstance> instance;
-            {
-                std::shared_lock lock(instances_mutex);
-                auto* p_instance = instances.Get(job.instance_id & INSTANCE_ID_MASK);
-                ASSERT_MSG(p_instance != nullptr, "Attempting to execute job on null instance");
-                instance = *p_instance;
-            }
+            groups.emplace_back(JobGroup{.batch_id = id, .jobs = {&job}});
+        }
+    }
 
-            instance->ExecuteJob(job);
+    if (groups.size() <= 1) {
+        for (auto& job : jobs) {
+            ExecuteJob(id, job);
         }
+        return;
+    }
+
+    // Fan all but the first group out to the pool and process the first one
+    // here, so the batch worker contributes instead of just waiting.
+    std::counting_semaphore<> done{0};
+    for (size_t i = 1; i < groups.size(); ++i) {
+        groups[i].done = &done;
+    }
+    // One ticket claim and one wakeup for the whole fan-out instead of a queue round
+    // trip per group.
+    decode_queue.PushBatchWait(std::span{groups.data() + 1, groups.size() - 1});
+    for (auto* job : groups.front().jobs) {
+        ExecuteJob(id, *job);
+    }
+    for (size_t i = 1; i < groups.size(); ++i) {
+        done.acquire();
     }
 }
 
@@ -12,11 +12,14 @@
 
 #include <array>
 #include <memory>
+#include <semaphore>
 #include <shared_mutex>
 #include <span>
 #include <thread>
 #include <utility>
 
+#include <boost/container/small_vector.hpp>
+
 namespace Libraries::Ajm {
 
 class AjmContext {
@@ -33,12 +36,25 @@ public:
                          AjmBatchError* p_batch_error, u32* p_batch_id);
 
     void WorkerThread(std::stop_token stop);
+    void DecodeWorkerThread(std::stop_token stop);
     void ProcessBatch(u32 id, std::span<AjmJob> jobs);
 
 private:
     static constexpr u32 MaxInstances = 0x2fff;
     static constexpr u32 MaxBatches = 0x0400;
     static constexpr u32 NumAjmCodecs = std::to_underlying(AjmCodecType::Max);
+    static constexpr u32 NumDecodeWorkers = 3;
+
+    /// Jobs from one batch that target the same instance. Codec state makes
+    /// jobs within a group sequential, but distinct groups are independent
+    /// and fan out across the decode workers.
+    struct JobGroup {
+        u32 batch_id{};
+        boost::container::small_vector<AjmJob*, 8> jobs;
+        std::counting_semaphore<>* done{};
+    };
+
+    void ExecuteJob(u32 batch_id, AjmJob& job);
 
     [[nodiscard]] bool IsRegistered(AjmCodecType type) const;
 
@@ -51,7 +67,10 @@ private:
     Common::SlotArray<u32, std::shared_ptr<AjmBatch>, MaxBatches, 1> batches;
 
     std::jthread worker_thread{};
-    Common::MPSCQueue<std::shared_ptr<AjmBatch>> batch_queue;
+    Common::MPMCQueue<std::shared_ptr<AjmBatch>, 1024> batch_queue;
+
+    std::array<std::jthread, NumDecodeWorkers> decode_workers{};
+    Common::MPMCQueue<JobGroup, 64> decode_queue;
 };
 
 } // namespace Libraries::Ajm
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cmath>
+#include <cstring>
+#include <map>
 
 #include "app_content.h"
 #include "common/assert.h"
@@ -20,6 +22,7 @@ struct AddContInfo {
     char entitlement_label[ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE];
     OrbisAppContentAddcontDownloadStatus status;
     OrbisAppContentGetEntitlementKey key;
+    std::filesystem::path path;
 };
 
 static std::array<AddContInfo, ORBIS_APP_CONTENT_INFO_LIST_MAX_SIZE> addcont_info = {{
@@ -32,6 +35,19 @@ static std::array<AddContInfo, ORBIS_APP_CONTENT_INFO_LIST_MAX_SIZE> addcont_inf
 static s32 addcont_count = 0;
 static std::string title_id;
 
+// Entitlement label to addcont_info slot, built while sceAppContentInitialize scans the
+// addon directory. The lookup APIs get called in loading loops, so resolve labels here
+// instead of strncmp-ing across all the info slots per call.
+static std::map<std::string, s32, std::less<>> addcont_index;
+
+static s32 FindAddcontIndex(const OrbisNpUnifiedEntitlementLabel* entitlement_label) {
+    const std::string_view label{
+        entitlement_label->data,
+        strnlen(entitlement_label->data, ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE - 1)};
+    const auto it = addcont_index.find(label);
+    return it != addcont_index.end() ? it->second : -1;
+}
+
 int PS4_SYSV_ABI _Z5dummyv() {
     LOG_ERROR(Lib_AppContent, "(STUBBED) called");
     return ORBIS_OK;
@@ -57,62 +73,19 @@ int PS4_SYSV_ABI sceAppContentAddcontMount(u32 service_label,
                                            OrbisAppContentMountPoint* mount_point) {
     LOG_INFO(Lib_AppContent, "called");
 
-    const auto& addon_path = Config::getAddonInstallDir() / title_id;
-    auto* mnt = Common::Singleton<Core::FileSys::MntPoints>::Instance();
-
-    // Determine which loaded additional content this entitlement label is for.
-    s32 i = 0;
-    while (i < addcont_count) {
-        if (strncmp(entitlement_label->data, addcont_info[i].entitlement_label,
-                    ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE - 1) == 0) {
-            snprintf(mount_point->data, ORBIS_APP_CONTENT_MOUNTPOINT_DATA_MAXSIZE, "/addcont%d", i);
-            break;
-        }
-        ++i;
-    }
-
-    if (i == addcont_count) {
+    // Determine which loaded additional content this entitlement label is for. The
+    // folder was already located and validated during the initialize scan, so there is
+    // no need to walk the addon directory and re-parse every param.sfo per mount.
+    const s32 i = FindAddcontIndex(entitlement_label);
+    if (i < 0) {
         // None of the loaded additional content match the entitlement label requested.
         return ORBIS_APP_CONTENT_ERROR_NOT_FOUND;
     }
 
-    // Find which directory corresponds to this entitlement
-    for (const auto& entry : std::filesystem::directory_iterator(addon_path)) {
-        if (!entry.is_directory()) {
-            continue;
-        }
-
-        // Open the param.sfo in this folder
-        PSF* dlc_params = new PSF();
-        const auto& param_sfo_path = entry.path() / "sce_sys/param.sfo";
-        if (!std::filesystem::exists(param_sfo_path)) {
-            // This folder doesn't have a param.sfo
-            continue;
-        }
-        dlc_params->Open(param_sfo_path);
-
-        // Validate the available params
-        auto category = dlc_params->GetString("CATEGORY");
-        auto content_id = dlc_params->GetString("CONTENT_ID");
-        if (!category.has_value() || strncmp(category.value().data(), "ac", 2) != 0 ||
-            !content_id.has_value() ||
-            content_id.value().length() <= ORBIS_APP_CONTENT_ENTITLEMENT_LABEL_OFFSET) {
-            // This folder fails the error checks performed in sceAppContentInitialize.
-            continue;
-        }
-
-        auto entitlement_id = content_id.value().substr(ORBIS_APP_CONTENT_ENTITLEMENT_LABEL_OFFSET);
-        if (strncmp(entitlement_id.data(), entitlement_label->data, entitlement_id.length()) == 0) {
-            // We've located the correct folder.
-            mnt->Mount(entry.path(), mount_point->data);
-            return ORBIS_OK;
-        }
-    }
-
-    // Hitting this shouldn't be possible, as it would mean the entitlement was loaded,
-    // but the folder it was loaded from doesn't exist.
-    UNREACHABLE_MSG("Folder for loaded entitlement label {} doesn't exist.",
-                    entitlement_label->data);
+    snprintf(mount_point->data, ORBIS_APP_CONTENT_MOUNTPOINT_DATA_MAXSIZE, "/addcont%d", i);
+    auto* mnt = Common::Singleton<Core::FileSys::MntPoints>::Instance();
+    mnt->Mount(addcont_info[i].path, mount_point->data);
+    return ORBIS_OK;
 }
 
 int PS4_SYSV_ABI sceAppContentAddcontShrink() {
@@ -205,21 +178,17 @@ int PS4_SYSV_ABI sceAppContentGetAddcontInfo(u32 service_label,
         return ORBIS_APP_CONTENT_ERROR_PARAMETER;
     }
 
-    for (auto i = 0; i < addcont_count; i++) {
-        if (strncmp(entitlementLabel->data, addcont_info[i].entitlement_label,
-                    ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE - 1) != 0) {
-            continue;
-        }
-
-        LOG_INFO(Lib_AppContent, "found DLC {}", entitlementLabel->data);
-
-        strncpy(info->entitlement_label.data, addcont_info[i].entitlement_label,
-                ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE);
-        info->status = addcont_info[i].status;
-        return ORBIS_OK;
+    const s32 i = FindAddcontIndex(entitlementLabel);
+    if (i < 0) {
+        return ORBIS_APP_CONTENT_ERROR_DRM_NO_ENTITLEMENT;
     }
 
-    return ORBIS_APP_CONTENT_ERROR_DRM_NO_ENTITLEMENT;
+    LOG_INFO(Lib_AppContent, "found DLC {}", entitlementLabel->data);
+
+    strncpy(info->entitlement_label.data, addcont_info[i].entitlement_label,
+            ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE);
+    info->status = addcont_info[i].status;
+    return ORBIS_OK;
 }
 
 int PS4_SYSV_ABI sceAppContentGetAddcontInfoList(u32 service_label,
@@ -259,17 +228,13 @@ int PS4_SYSV_ABI sceAppContentGetEntitlementKey(
         return ORBIS_APP_CONTENT_ERROR_PARAMETER;
     }
 
-    for (int i = 0; i < addcont_count; i++) {
-        if (strncmp(entitlement_label->data, addcont_info[i].entitlement_label,
-                    ORBIS_NP_UNIFIED_ENTITLEMENT_LABEL_SIZE - 1) != 0) {
-            continue;
-        }
-
-        memcpy(key->data, addcont_info[i].key.data, ORBIS_APP_CONTENT_ENTITLEMENT_KEY_SIZE);
-        return ORBIS_OK;
+    const s32 i = FindAddcontIndex(entitlement_label);
+    if (i < 0) {
+        return ORBIS_APP_CONTENT_ERROR_DRM_NO_ENTITLEMENT;
     }
 
-    return ORBIS_APP_CONTENT_ERROR_DRM_NO_ENTITLEMENT;
+    memcpy(key->data, addcont_info[i].key.data, ORBIS_APP_CONTENT_ENTITLEMENT_KEY_SIZE);
+    return ORBIS_OK;
 }
 
 int PS4_SYSV_ABI sceAppContentGetRegion() {
@@ -330,10 +295,14 @@ int PS4_SYSV_ABI sceAppContentInitialize(const OrbisAppContentInitParam* initPar
                     content_id.value().substr(ORBIS_APP_CONTENT_ENTITLEMENT_LABEL_OFFSET);
                 LOG_INFO(Lib_AppContent, "Entitlement {} found", entitlement_id);
 
-                // Save the additional content info in addcont_info.
-                auto& info = addcont_info[addcont_count++];
+                // Save the additional content info in addcont_info and index it by
+                // entitlement label for the lookup and mount APIs.
+                auto& info = addcont_info[addcont_count];
                 entitlement_id.copy(info.entitlement_label, entitlement_id.length());
                 info.status = OrbisAppContentAddcontDownloadStatus::Installed;
+                info.path = entry.path();
+                addcont_index.emplace(entitlement_id, addcont_count);
+                ++addcont_count;
             } else {
                 LOG_WARNING(Lib_AppContent, "Additonal content folder {} is not additional content",
                             entry.path().filename().string());
@@ -176,17 +176,22 @@ static void AudioOutputThread(std::shared_ptr<PortOut> port, const std::stop_tok
             if (!port->impl || stop.stop_requested()) {
                 break;
             }
+        }
 
-            if (port->output_ready) {
-                port->impl->Output(port->output_buffer);
-                port->output_ready = false;
+        // Convert and push outside the port mutex so producers queueing the
+        // next period never serialize behind the backend.
+        const u32 read = port->ring_read.load(std::memory_order_relaxed);
+        if (port->ring_write.load(std::memory_order_acquire) != read) {
+            port->impl->Output(port->RingSlot(read));
+            port->ring_read.store(read + 1, std::memory_order_release);
+            {
+                std::unique_lock lock{port->mutex};
                 port->last_output_time =
                     Kernel::sceKernelGetProcessTime(); // moved from sceAudioOutOutput TOOD recheck
             }
+            port->output_cv.notify_one();
         }
 
-        port->output_cv.notify_one();
-
         if (stop.stop_requested()) {
             break;
         }
@@ -319,11 +324,9 @@ s32 PS4_SYSV_ABI sceAudioOutOpen(UserService::OrbisUserServiceUserId user_id,
             throw std::runtime_error("Failed to create audio backend");
         }
 
-        // Allocate buffer
-        port->output_buffer = std::malloc(port->BufferSize());
-        if (!port->output_buffer) {
-            throw std::bad_alloc();
-        }
+        // Allocate the output ring
+        port->output_ring =
+            std::make_unique<u8[]>(size_t(port->BufferSize()) * PortOut::NumOutputBuffers);
 
         // Start output thread - pass shared_ptr by value to keep port alive
         port->output_thread.Run(
@@ -393,8 +396,6 @@ s32 PS4_SYSV_ABI sceAudioOutClose(s32 handle) {
     // Stop the output thread
     port->output_thread.Stop();
 
-    std::free(port->output_buffer);
-
     LOG_DEBUG(Lib_AudioOut, "Closed audio port {}", port_id);
     return ORBIS_OK;
 }
@@ -543,15 +544,18 @@ s32 PS4_SYSV_ABI sceAudioOutOutput(s32 handle, void* ptr) {
     }
 
     s32 samples_sent = 0;
-    {
+    if (ptr != nullptr) {
         std::unique_lock lock{port->mutex};
-        port->output_cv.wait(lock, [&] { return !port->output_ready; });
+        port->output_cv.wait(lock, [&] { return !port->RingFull(); });
 
-        if (ptr != nullptr) {
-            std::memcpy(port->output_buffer, ptr, port->BufferSize());
-            port->output_ready = true;
-            samples_sent = port->buffer_frames * port->format_info.num_channels;
-        }
+        const u32 write = port->ring_write.load(std::memory_order_relaxed);
+        std::memcpy(port->RingSlot(write), ptr, port->BufferSize());
+        port->ring_write.store(write + 1, std::memory_order_release);
+        samples_sent = port->buffer_frames * port->format_info.num_channels;
+    } else {
+        // A null pointer waits until every queued buffer has been output.
+        std::unique_lock lock{port->mutex};
+        port->output_cv.wait(lock, [&] { return port->RingEmpty(); });
     }
 
     return samples_sent;
@@ -640,16 +644,17 @@ s32 PS4_SYSV_ABI sceAudioOutOutputs(OrbisAudioOutOutputParam* param, u32 num) {
         }
     }
 
-    // Wait for all ports to be ready
+    // Wait for all ports to have a free ring slot
     for (u32 i = 0; i < num; i++) {
-        ports[i]->output_cv.wait(locks[i], [&] { return !ports[i]->output_ready; });
+        ports[i]->output_cv.wait(locks[i], [&] { return !ports[i]->RingFull(); });
     }
 
     // Copy data to all ports
     for (u32 i = 0; i < num; i++) {
         if (param[i].ptr != nullptr) {
-            std::memcpy(ports[i]->output_buffer, param[i].ptr, ports[i]->BufferSize());
-            ports[i]->output_ready = true;
+            const u32 write = ports[i]->ring_write.load(std::memory_order_relaxed);
+            std::memcpy(ports[i]->RingSlot(write), param[i].ptr, ports[i]->BufferSize());
+            ports[i]->ring_write.store(write + 1, std::memory_order_release);
         }
     }
 
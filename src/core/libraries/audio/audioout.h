@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -118,12 +119,23 @@ struct AudioFormatInfo {
 };
 
 struct PortOut {
+    /// Guest audio periods queued ahead of the output thread. Two periods
+    /// deep: the title copies the next period while the backend converts and
+    /// pushes the current one, so output only ever blocks on cadence, never
+    /// on the backend conversion or the device push.
+    static constexpr u32 NumOutputBuffers = 2;
+
     std::mutex mutex;
     std::unique_ptr<PortBackend> impl{};
 
-    void* output_buffer = nullptr;
+    /// Lock-free SPSC ring between the guest-facing output call (producer)
+    /// and the output thread (consumer). The mutex only guards producers
+    /// against each other and backs the condition variable; the consumer
+    /// never holds it while converting or pushing to the device.
+    std::unique_ptr<u8[]> output_ring{};
+    std::atomic<u32> ring_write{};
+    std::atomic<u32> ring_read{};
     std::condition_variable_any output_cv;
-    bool output_ready = false;
     Kernel::Thread output_thread{};
 
     OrbisAudioOutPort type;
@@ -140,6 +152,21 @@ struct PortOut {
     [[nodiscard]] u32 BufferSize() const {
         return buffer_frames * format_info.FrameSize();
     }
+
+    [[nodiscard]] u8* RingSlot(u32 index) {
+        return output_ring.get() + (index % NumOutputBuffers) * BufferSize();
+    }
+
+    [[nodiscard]] bool RingFull() const {
+        return ring_write.load(std::memory_order_relaxed) -
+                   ring_read.load(std::memory_order_acquire) ==
+               NumOutputBuffers;
+    }
+
+    [[nodiscard]] bool RingEmpty() const {
+        return ring_write.load(std::memory_order_relaxed) ==
+               ring_read.load(std::memory_order_acquire);
+    }
 };
 
 s32 PS4_SYSV_ABI sceAudioOutDeviceIdOpen();
@@ -386,7 +386,11 @@ private:
                 convert = &ConvertF32Stereo;
                 break;
             case 8:
+#if defined(HAS_SSE2)
+                convert = is_std ? &ConvertF32Std8CH_SIMD : &ConvertF32_8CH;
+#else
                 convert = is_std ? &ConvertF32Std8CH : &ConvertF32_8CH;
+#endif
                 break;
             default:
                 LOG_ERROR(Lib_AudioOut, "Unsupported float channel count: {}", num_channels);
@@ -395,7 +399,11 @@ private:
         } else {
             switch (num_channels) {
             case 1:
+#if defined(HAS_SSE2)
+                convert = &ConvertS16MonoSIMD;
+#else
                 convert = &ConvertS16Mono;
+#endif
                 break;
             case 2:
 #if defined(HAS_SSE2)
@@ -451,6 +459,31 @@ private:
         }
     }
 
+#ifdef HAS_SSE2
+    static void ConvertS16MonoSIMD(const void* src, void* dst, u32 frames, const float*) {
+        const s16* s = static_cast<const s16*>(src);
+        float* d = static_cast<float*>(dst);
+
+        const __m128 scale = _mm_set1_ps(INV_VOLUME_0DB);
+        u32 i = 0;
+
+        // Process 8 samples at a time
+        for (; i + 8 <= frames; i += 8) {
+            __m128i s16_vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s[i]));
+            __m128i s32_lo = _mm_cvtepi16_epi32(s16_vals);
+            __m128i s32_hi = _mm_cvtepi16_epi32(_mm_srli_si128(s16_vals, 8));
+            __m128 f_lo = _mm_mul_ps(_mm_cvtepi32_ps(s32_lo), scale);
+            __m128 f_hi = _mm_mul_ps(_mm_cvtepi32_ps(s32_hi), scale);
+            _mm_storeu_ps(&d[i], f_lo);
+            _mm_storeu_ps(&d[i + 4], f_hi);
+        }
+
+        for (; i < frames; i++) {
+            d[i] = s[i] * INV_VOLUME_0DB;
+        }
+    }
+#endif
+
     static void ConvertS16Stereo(const void* src, void* dst, u32 frames, const float*) {
         const s16* s = static_cast<const s16*>(src);
         float* d = static_cast<float*>(dst);
@@ -562,6 +595,24 @@ private:
         }
     }
 
+#ifdef HAS_SSE2
+    static void ConvertF32Std8CH_SIMD(const void* src, void* dst, u32 frames, const float*) {
+        const float* s = static_cast<const float*>(src);
+        float* d = static_cast<float*>(dst);
+
+        // FL/FR/FC/LF pass through; the upper four channels swap pairs
+        // (SL/SR <-> BL/BR), which is a single lane shuffle per frame.
+        for (u32 i = 0; i < frames; i++) {
+            const u32 offset = i << 3; // * 8
+
+            const __m128 front = _mm_loadu_ps(&s[offset]);
+            const __m128 rear = _mm_loadu_ps(&s[offset + 4]);
+            _mm_storeu_ps(&d[offset], front);
+            _mm_storeu_ps(&d[offset + 4], _mm_shuffle_ps(rear, rear, _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+    }
+#endif
+
     // Audio format parameters
     const u32 frame_size;
     const u32 guest_buffer_size;
@@ -2,9 +2,15 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cmath>
 #include <vector>
 #include <magic_enum/magic_enum.hpp>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define HAS_SSE2
+#endif
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/libraries/audio/audioout.h"
@@ -97,6 +103,47 @@ s32 PS4_SYSV_ABI sceAudio3dAudioOutOutputs(AudioOut::OrbisAudioOutOutputParam* p
     return AudioOut::sceAudioOutOutputs(param, num);
 }
 
+// Derives constant-power stereo gains for an object from its persistent GAIN
+// and POSITION attributes. Positions are listener-relative; the pan law is
+// normalized so a centered object keeps unity gain, with 1/distance
+// attenuation beyond one unit. Objects without a position keep the legacy
+// flat (unpanned) gain.
+static void ComputeObjectGains(const ObjectState& obj, float& gain_l, float& gain_r) {
+    float gain = 0.0f;
+    const auto gain_key = static_cast<u32>(OrbisAudio3dAttributeId::ORBIS_AUDIO3D_ATTRIBUTE_GAIN);
+    if (const auto it = obj.persistent_attributes.find(gain_key);
+        it != obj.persistent_attributes.end() && it->second.size() >= sizeof(float)) {
+        std::memcpy(&gain, it->second.data(), sizeof(float));
+    }
+
+    gain_l = gain;
+    gain_r = gain;
+
+    const auto pos_key =
+        static_cast<u32>(OrbisAudio3dAttributeId::ORBIS_AUDIO3D_ATTRIBUTE_POSITION);
+    const auto it = obj.persistent_attributes.find(pos_key);
+    if (it == obj.persistent_attributes.end() ||
+        it->second.size() < sizeof(OrbisAudio3dPosition)) {
+        return;
+    }
+
+    OrbisAudio3dPosition pos;
+    std::memcpy(&pos, it->second.data(), sizeof(pos));
+
+    const float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z);
+    const float attenuation = 1.0f / std::max(1.0f, distance);
+
+    // Lateral direction in the horizontal plane, -1 (full left) .. 1 (full right).
+    const float planar = std::sqrt(pos.x * pos.x + pos.z * pos.z);
+    const float lateral = planar > 1e-6f ? std::clamp(pos.x / planar, -1.0f, 1.0f) : 0.0f;
+
+    constexpr float quarter_pi = 0.78539816339f;
+    constexpr float sqrt2 = 1.41421356237f;
+    const float angle = (lateral + 1.0f) * quarter_pi;
+    gain_l = gain * attenuation * std::cos(angle) * sqrt2;
+    gain_r = gain * attenuation * std::sin(angle) * sqrt2;
+}
+
 static s32 ConvertAndEnqueue(std::deque<AudioData>& queue, const OrbisAudio3dPcm& pcm,
                              const u32 num_channels, const u32 granularity) {
     if (!pcm.sample_buffer || !pcm.num_samples) {
@@ -474,25 +521,23 @@ s32 PS4_SYSV_ABI sceAudio3dPortAdvance(const OrbisAudio3dPortId port_id) {
     const u32 out_samples = granularity * AUDIO3D_OUTPUT_NUM_CHANNELS;
 
     // ---- FLOAT MIX BUFFER ----
-    float* mix_float = static_cast<float*>(std::calloc(out_samples, sizeof(float)));
-    if (!mix_float)
-        return ORBIS_AUDIO3D_ERROR_OUT_OF_MEMORY;
+    // Reused across grains; assign() zeroes it without reallocating.
+    port.mix_scratch.assign(out_samples, 0.0f);
+    float* mix_float = port.mix_scratch.data();
 
-    auto mix_in = [&](std::deque<AudioData>& queue, const float gain) {
+    auto mix_in = [&](std::deque<AudioData>& queue, const float gain_l, const float gain_r) {
         if (queue.empty())
             return;
 
+        AudioData data = queue.front();
+        queue.pop_front();
+
         // default gain is 0.0 — objects with no GAIN set are silent.
-        if (gain == 0.0f) {
-            AudioData data = queue.front();
-            queue.pop_front();
+        if (gain_l == 0.0f && gain_r == 0.0f) {
             std::free(data.sample_buffer);
             return;
         }
 
-        AudioData data = queue.front();
-        queue.pop_front();
-
         const u32 frames = std::min(granularity, data.num_samples);
         const u32 channels = data.num_channels;
 
@@ -512,13 +557,31 @@ s32 PS4_SYSV_ABI sceAudio3dPortAdvance(const OrbisAudio3dPortId port_id) {
                     right = src[i * channels + 1] / 32768.0f;
                 }
 
-                mix_float[i * 2 + 0] += left * gain;
-                mix_float[i * 2 + 1] += right * gain;
+                mix_float[i * 2 + 0] += left * gain_l;
+                mix_float[i * 2 + 1] += right * gain_r;
             }
         } else { // FLOAT input
             const float* src = reinterpret_cast<const float*>(data.sample_buffer);
+            u32 i = 0;
+
+#ifdef HAS_SSE2
+            // Mono float is the common object format; pan four frames at a time.
+            if (channels == 1) {
+                const __m128 gl = _mm_set1_ps(gain_l);
+                const __m128 gr = _mm_set1_ps(gain_r);
+                for (; i + 4 <= frames; i += 4) {
+                    const __m128 v = _mm_loadu_ps(&src[i]);
+                    const __m128 left = _mm_mul_ps(v, gl);
+                    const __m128 right = _mm_mul_ps(v, gr);
+                    float* dst = &mix_float[i * 2];
+                    _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_unpacklo_ps(left, right)));
+                    _mm_storeu_ps(dst + 4,
+                                  _mm_add_ps(_mm_loadu_ps(dst + 4), _mm_unpackhi_ps(left, right)));
+                }
+            }
+#endif
 
-            for (u32 i = 0; i < frames; i++) {
+            for (; i < frames; i++) {
                 float left = 0.0f;
                 float right = 0.0f;
 
@@ -530,44 +593,53 @@ s32 PS4_SYSV_ABI sceAudio3dPortAdvance(const OrbisAudio3dPortId port_id) {
                     right = src[i * channels + 1];
                 }
 
-                mix_float[i * 2 + 0] += left * gain;
-                mix_float[i * 2 + 1] += right * gain;
+                mix_float[i * 2 + 0] += left * gain_l;
+                mix_float[i * 2 + 1] += right * gain_r;
             }
         }
 
         std::free(data.sample_buffer);
     };
 
-    // Bed is mixed at full gain (1.0).
-    mix_in(port.bed_queue, 1.0f);
+    // Bed is mixed at full gain (1.0), without panning.
+    mix_in(port.bed_queue, 1.0f, 1.0f);
 
-    // Mix all object PCM queues, applying each object's GAIN persistent attribute.
+    // Mix all object PCM queues, panned and attenuated from each object's
+    // persistent GAIN/POSITION attributes.
     for (auto& [obj_id, obj] : port.objects) {
-        float gain = 0.0f;
-        const auto gain_key =
-            static_cast<u32>(OrbisAudio3dAttributeId::ORBIS_AUDIO3D_ATTRIBUTE_GAIN);
-        if (obj.persistent_attributes.contains(gain_key)) {
-            const auto& blob = obj.persistent_attributes.at(gain_key);
-            if (blob.size() >= sizeof(float)) {
-                std::memcpy(&gain, blob.data(), sizeof(float));
-            }
-        }
-        mix_in(obj.pcm_queue, gain);
+        float gain_l = 0.0f;
+        float gain_r = 0.0f;
+        ComputeObjectGains(obj, gain_l, gain_r);
+        mix_in(obj.pcm_queue, gain_l, gain_r);
     }
 
     s16* mix_s16 = static_cast<s16*>(std::malloc(out_samples * sizeof(s16)));
     if (!mix_s16) {
-        std::free(mix_float);
         return ORBIS_AUDIO3D_ERROR_OUT_OF_MEMORY;
     }
 
-    for (u32 i = 0; i < out_samples; i++) {
+    u32 i = 0;
+
+#ifdef HAS_SSE2
+    {
+        const __m128 scale = _mm_set1_ps(32767.0f);
+        const __m128 lo = _mm_set1_ps(-1.0f);
+        const __m128 hi = _mm_set1_ps(1.0f);
+        for (; i + 8 <= out_samples; i += 8) {
+            const __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&mix_float[i]), lo), hi);
+            const __m128 b = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&mix_float[i + 4]), lo), hi);
+            const __m128i ia = _mm_cvtps_epi32(_mm_mul_ps(a, scale));
+            const __m128i ib = _mm_cvtps_epi32(_mm_mul_ps(b, scale));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&mix_s16[i]), _mm_packs_epi32(ia, ib));
+        }
+    }
+#endif
+
+    for (; i < out_samples; i++) {
         float v = std::clamp(mix_float[i], -1.0f, 1.0f);
         mix_s16[i] = static_cast<s16>(v * 32767.0f);
     }
 
-    std::free(mix_float);
-
     port.mixed_queue.push_back(AudioData{.sample_buffer = reinterpret_cast<u8*>(mix_s16),
                                          .num_samples = granularity,
                                          .num_channels = AUDIO3D_OUTPUT_NUM_CHANNELS,
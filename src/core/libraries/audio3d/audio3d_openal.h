@@ -87,6 +87,13 @@ struct OrbisAudio3dAttribute {
     u64 value_size;
 };
 
+/// Listener-relative object position (x right, y up, z behind the listener).
+struct OrbisAudio3dPosition {
+    float x;
+    float y;
+    float z;
+};
+
 struct AudioData {
     u8* sample_buffer;
     u32 num_samples;
@@ -114,6 +121,9 @@ struct Port {
     std::deque<AudioData> bed_queue;
     // Mixed stereo frames ready to be consumed by sceAudio3dPortPush.
     std::deque<AudioData> mixed_queue;
+    // Reused float mix buffer for sceAudio3dPortAdvance, so mixing does not
+    // allocate per grain.
+    std::vector<float> mix_scratch;
 };
 
 struct Audio3dState {
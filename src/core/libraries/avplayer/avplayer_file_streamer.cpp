@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm> // std::max, std::min
+#include <cstring>
 #include <magic_enum/magic_enum.hpp>
+#include "common/thread.h"
 #include "core/libraries/avplayer/avplayer_file_streamer.h"
 
 extern "C" {
@@ -18,6 +20,7 @@ AvPlayerFileStreamer::AvPlayerFileStreamer(const AvPlayerFileReplacement& file_r
     : m_file_replacement(file_replacement) {}
 
 AvPlayerFileStreamer::~AvPlayerFileStreamer() {
+    m_prefetch_thread.Stop();
     if (m_avio_context != nullptr) {
         avio_context_free(&m_avio_context);
     }
@@ -40,6 +43,8 @@ bool AvPlayerFileStreamer::Init(std::string_view path) {
     m_avio_context =
         avio_alloc_context(avio_buffer, AVPLAYER_AVIO_BUFFER_SIZE, 0, this,
                            &AvPlayerFileStreamer::ReadPacket, nullptr, &AvPlayerFileStreamer::Seek);
+    m_prefetch_buffer = std::make_unique<u8[]>(PrefetchBufferSize);
+    m_prefetch_thread.Run([this](std::stop_token stop) { this->PrefetchThread(stop); });
     return true;
 }
 
@@ -47,6 +52,52 @@ void AvPlayerFileStreamer::Reset() {
     m_position = 0;
 }
 
+s32 AvPlayerFileStreamer::DirectRead(u8* buffer, u64 position, s32 size) {
+    const auto read_offset = m_file_replacement.read_offset;
+    const auto ptr = m_file_replacement.object_ptr;
+    return read_offset(ptr, buffer, position, size);
+}
+
+void AvPlayerFileStreamer::PrefetchThread(std::stop_token stop) {
+    Common::SetCurrentThreadName("shadPS4:AvPrefetch");
+
+    std::unique_lock lock(m_prefetch_mutex);
+    while (!stop.stop_requested()) {
+        const auto next_offset = m_window_start + m_window_size;
+        if (next_offset >= m_file_size || m_window_size + PrefetchChunkSize > PrefetchBufferSize) {
+            // Window full or at EOF; wait until the demuxer consumes or seeks.
+            m_prefetch_cv.wait(lock, stop, [&] {
+                const auto next = m_window_start + m_window_size;
+                return next < m_file_size && m_window_size + PrefetchChunkSize <= PrefetchBufferSize;
+            });
+            continue;
+        }
+
+        // Cap the chunk so it stays contiguous in the ring.
+        const auto ring_offset = next_offset % PrefetchBufferSize;
+        const auto size = std::min({PrefetchChunkSize, m_file_size - next_offset,
+                                    PrefetchBufferSize - ring_offset});
+        const auto generation = m_generation;
+
+        // The region being filled is not part of the valid window yet, so the
+        // guest read can run unlocked; a concurrent seek bumps the generation
+        // and the result is discarded.
+        lock.unlock();
+        const auto bytes_read = DirectRead(&m_prefetch_buffer[ring_offset], next_offset, s32(size));
+        lock.lock();
+
+        if (generation != m_generation) {
+            continue;
+        }
+        if (bytes_read <= 0) {
+            // Transient or EOF-ish failure; wait for a seek to retry.
+            m_prefetch_cv.wait(lock, stop, [&] { return generation != m_generation; });
+            continue;
+        }
+        m_window_size += bytes_read;
+    }
+}
+
 s32 AvPlayerFileStreamer::ReadPacket(void* opaque, u8* buffer, s32 size) {
     const auto self = reinterpret_cast<AvPlayerFileStreamer*>(opaque);
     if (self->m_position >= self->m_file_size) {
@@ -55,13 +106,49 @@ s32 AvPlayerFileStreamer::ReadPacket(void* opaque, u8* buffer, s32 size) {
     if (self->m_position + size > self->m_file_size) {
         size = self->m_file_size - self->m_position;
     }
-    const auto read_offset = self->m_file_replacement.read_offset;
-    const auto ptr = self->m_file_replacement.object_ptr;
-    const auto bytes_read = read_offset(ptr, buffer, self->m_position, size);
+
+    {
+        std::unique_lock lock(self->m_prefetch_mutex);
+        const auto window_end = self->m_window_start + self->m_window_size;
+        if (self->m_position >= self->m_window_start && self->m_position < window_end) {
+            // Drop bytes the demuxer skipped over, then serve what is valid;
+            // avio is fine with short reads.
+            const auto skipped = self->m_position - self->m_window_start;
+            self->m_window_start = self->m_position;
+            self->m_window_size -= skipped;
+
+            const auto available = std::min(u64(size), self->m_window_size);
+            const auto ring_offset = self->m_position % PrefetchBufferSize;
+            const auto contiguous = std::min(available, PrefetchBufferSize - ring_offset);
+            std::memcpy(buffer, &self->m_prefetch_buffer[ring_offset], contiguous);
+            if (contiguous < available) {
+                std::memcpy(buffer + contiguous, &self->m_prefetch_buffer[0],
+                            available - contiguous);
+            }
+            self->m_window_start += available;
+            self->m_window_size -= available;
+            self->m_position += available;
+            self->m_prefetch_cv.notify_all();
+            if (available != 0) {
+                return s32(available);
+            }
+        }
+    }
+
+    // Window miss (seek or cold start): read synchronously and restart the
+    // prefetcher right after this request.
+    const auto bytes_read = self->DirectRead(buffer, self->m_position, size);
     if (bytes_read == 0 && size != 0) {
         return AVERROR_EOF;
     }
     self->m_position += bytes_read;
+    {
+        std::unique_lock lock(self->m_prefetch_mutex);
+        self->m_window_start = self->m_position;
+        self->m_window_size = 0;
+        ++self->m_generation;
+        self->m_prefetch_cv.notify_all();
+    }
     return bytes_read;
 }
 
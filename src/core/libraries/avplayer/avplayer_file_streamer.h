@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string_view>
 #include "core/libraries/avplayer/avplayer.h"
 #include "core/libraries/avplayer/avplayer_data_streamer.h"
+#include "core/libraries/kernel/threads.h"
 
 struct AVIOContext;
 
@@ -27,12 +31,31 @@ private:
     static s32 ReadPacket(void* opaque, u8* buffer, s32 size);
     static s64 Seek(void* opaque, s64 buffer, int whence);
 
+    void PrefetchThread(std::stop_token stop);
+    s32 DirectRead(u8* buffer, u64 position, s32 size);
+
     AvPlayerFileReplacement m_file_replacement;
 
     int m_fd = -1;
     u64 m_position{};
     u64 m_file_size{};
     AVIOContext* m_avio_context{};
+
+    // Read-ahead ring. The prefetch thread keeps a contiguous window of
+    // compressed data ahead of the demuxer; a byte at file offset `off` lives
+    // at `off % PrefetchBufferSize`, so sequential consumption just advances
+    // the window start. It has to be a guest-capable thread because the read
+    // callbacks are title code.
+    static constexpr u64 PrefetchBufferSize = u64(4) << 20;
+    static constexpr u64 PrefetchChunkSize = u64(256) << 10;
+
+    std::unique_ptr<u8[]> m_prefetch_buffer;
+    std::mutex m_prefetch_mutex;
+    std::condition_variable_any m_prefetch_cv;
+    u64 m_window_start{};
+    u64 m_window_size{};
+    u64 m_generation{};
+    Kernel::Thread m_prefetch_thread{};
 };
 
 } // namespace Libraries::AvPlayer
@@ -15,6 +15,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavformat/avio.h>
+#include <libavutil/hwcontext.h>
 #include <libswresample/swresample.h>
 #include <libswscale/swscale.h>
 }
@@ -28,6 +29,22 @@ AvPlayerSource::AvPlayerSource(AvPlayerStateCallback& state, bool use_vdec2)
 
 AvPlayerSource::~AvPlayerSource() {
     Stop();
+    if (m_hw_device_ctx != nullptr) {
+        av_buffer_unref(&m_hw_device_ctx);
+    }
+}
+
+// Picks the negotiated hardware pixel format when the decoder offers it;
+// FFmpeg falls back to a software format (and software decoding) otherwise.
+static AVPixelFormat GetHWFormat(AVCodecContext* context, const AVPixelFormat* formats) {
+    const auto hw_format = *reinterpret_cast<const int*>(context->opaque);
+    for (const AVPixelFormat* p = formats; *p != AV_PIX_FMT_NONE; ++p) {
+        if (*p == AVPixelFormat(hw_format)) {
+            return *p;
+        }
+    }
+    LOG_WARNING(Lib_AvPlayer, "Hardware pixel format unavailable, decoding in software");
+    return avcodec_default_get_format(context, formats);
 }
 
 bool AvPlayerSource::Init(const AvPlayerInitData& init_data, std::string_view path) {
@@ -214,6 +231,7 @@ bool AvPlayerSource::Start() {
                       m_video_stream_index.value());
             return false;
         }
+        TrySetupHWDecoding(decoder);
         if (avcodec_open2(m_video_codec_context.get(), decoder, nullptr) < 0) {
             LOG_ERROR(Lib_AvPlayer, "Could not open avcodec for video stream {}.",
                       m_video_stream_index.value());
@@ -512,35 +530,59 @@ void AvPlayerSource::DemuxerThread(std::stop_token stop) {
     LOG_INFO(Lib_AvPlayer, "Demuxer Thread exited normally");
 }
 
-AvPlayerSource::AVFramePtr AvPlayerSource::ConvertVideoFrame(const AVFrame& frame) {
-    auto nv12_frame = AVFramePtr{av_frame_alloc(), &ReleaseAVFrame};
-    nv12_frame->pts = frame.pts;
-    nv12_frame->pkt_dts = frame.pkt_dts < 0 ? 0 : frame.pkt_dts;
-    nv12_frame->format = AV_PIX_FMT_NV12;
-    nv12_frame->width = frame.width;
-    nv12_frame->height = frame.height;
-    nv12_frame->sample_aspect_ratio = frame.sample_aspect_ratio;
-    nv12_frame->crop_top = frame.crop_top;
-    nv12_frame->crop_bottom = frame.crop_bottom;
-    nv12_frame->crop_left = frame.crop_left;
-    nv12_frame->crop_right = frame.crop_right;
+void AvPlayerSource::TrySetupHWDecoding(const AVCodec* decoder) {
+    for (int i = 0;; ++i) {
+        const auto config = avcodec_get_hw_config(decoder, i);
+        if (config == nullptr) {
+            // No usable hardware configuration; stay on software decoding.
+            return;
+        }
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0) {
+            continue;
+        }
+        AVBufferRef* device_ctx = nullptr;
+        if (av_hwdevice_ctx_create(&device_ctx, config->device_type, nullptr, nullptr, 0) < 0) {
+            continue;
+        }
+        m_hw_device_ctx = device_ctx;
+        m_hw_pix_fmt = config->pix_fmt;
+        m_video_codec_context->hw_device_ctx = av_buffer_ref(device_ctx);
+        m_video_codec_context->opaque = &m_hw_pix_fmt;
+        m_video_codec_context->get_format = &GetHWFormat;
+        LOG_INFO(Lib_AvPlayer, "Hardware video decoding enabled via {}",
+                 av_hwdevice_get_type_name(config->device_type));
+        return;
+    }
+}
 
-    av_frame_get_buffer(nv12_frame.get(), 0);
+bool AvPlayerSource::ConvertVideoFrameToGuest(const AVFrame& frame, u8* dst) {
+    auto width = u32(frame.width);
+    auto height = u32(frame.height);
+    if (!m_use_vdec2) {
+        width = Common::AlignUp(width, 16);
+        height = Common::AlignUp(height, 16);
+    }
 
     if (m_sws_context == nullptr) {
         m_sws_context =
             SWSContextPtr(sws_getContext(frame.width, frame.height, AVPixelFormat(frame.format),
-                                         nv12_frame->width, nv12_frame->height, AV_PIX_FMT_NV12,
+                                         frame.width, frame.height, AV_PIX_FMT_NV12,
                                          SWS_FAST_BILINEAR, nullptr, nullptr, nullptr),
                           &ReleaseSWSContext);
     }
+
+    // Write the NV12 planes straight into the guest framebuffer instead of
+    // going through an intermediate AVFrame; the aligned width doubles as the
+    // destination pitch.
+    u8* dst_data[2] = {dst, dst + width * height};
+    const int dst_linesize[2] = {int(width), int(width)};
     const auto res = sws_scale(m_sws_context.get(), frame.data, frame.linesize, 0, frame.height,
-                               nv12_frame->data, nv12_frame->linesize);
+                               dst_data, dst_linesize);
     if (res < 0) {
         LOG_ERROR(Lib_AvPlayer, "Could not convert to NV12: {}", av_err2str(res));
-        return AVFramePtr{nullptr, &ReleaseAVFrame};
+        return false;
     }
-    return nv12_frame;
+    return true;
 }
 
 static void CopyNV12Data(u8* dst, const AVFrame& src, bool use_vdec2) {
@@ -568,12 +610,16 @@ static void CopyNV12Data(u8* dst, const AVFrame& src, bool use_vdec2) {
 }
 
 Frame AvPlayerSource::PrepareVideoFrame(GuestBuffer buffer, const AVFrame& frame) {
-    ASSERT(frame.format == AV_PIX_FMT_NV12);
-
     auto p_buffer = buffer.GetBuffer();
-    CopyNV12Data(p_buffer, frame, m_use_vdec2);
+    if (frame.format == AV_PIX_FMT_NV12) {
+        CopyNV12Data(p_buffer, frame, m_use_vdec2);
+    } else if (!ConvertVideoFrameToGuest(frame, p_buffer)) {
+        // Conversion failure leaves the previous buffer contents; still hand
+        // the frame out so playback keeps advancing.
+        LOG_ERROR(Lib_AvPlayer, "Skipping conversion of frame with PTS = {}", frame.pts);
+    }
 
-    const auto pkt_dts = u64(frame.pkt_dts) * 1000;
+    const auto pkt_dts = u64(frame.pkt_dts < 0 ? 0 : frame.pkt_dts) * 1000;
     const auto stream = m_avformat_context->streams[m_video_stream_index.value()];
     const auto time_base = stream->time_base;
     const auto den = time_base.den;
@@ -605,7 +651,10 @@ Frame AvPlayerSource::PrepareVideoFrame(GuestBuffer buffer, const AVFrame& frame
                                 .crop_top_offset = u32(frame.crop_top),
                                 .crop_bottom_offset =
                                     u32(frame.crop_bottom + (height - frame.height)),
-                                .pitch = u32(frame.linesize[0]),
+                                // Both CopyNV12Data and ConvertVideoFrameToGuest pack the
+                                // planes at the aligned width, so report that as the pitch
+                                // rather than the decoder's linesize.
+                                .pitch = width,
                                 .luma_bit_depth = 8,
                                 .chroma_bit_depth = 8,
                             },
@@ -662,12 +711,22 @@ void AvPlayerSource::VideoDecoderThread(std::stop_token stop) {
                     // Video buffers queue was cleared. This means that player was stopped.
                     break;
                 }
-                if (up_frame->format != AV_PIX_FMT_NV12) {
-                    const auto nv12_frame = ConvertVideoFrame(*up_frame);
-                    m_video_frames.Push(PrepareVideoFrame(std::move(buffer.value()), *nv12_frame));
-                } else {
-                    m_video_frames.Push(PrepareVideoFrame(std::move(buffer.value()), *up_frame));
+                if (up_frame->format == m_hw_pix_fmt) {
+                    // Download the hardware surface; most decoders hand back
+                    // NV12, which PrepareVideoFrame copies without conversion.
+                    auto sw_frame = AVFramePtr(av_frame_alloc(), &ReleaseAVFrame);
+                    const auto transfer_res =
+                        av_hwframe_transfer_data(sw_frame.get(), up_frame.get(), 0);
+                    if (transfer_res < 0) {
+                        LOG_ERROR(Lib_AvPlayer, "Could not download hardware frame. Error = {}",
+                                  av_err2str(transfer_res));
+                        m_state.OnError();
+                        return;
+                    }
+                    av_frame_copy_props(sw_frame.get(), up_frame.get());
+                    up_frame = std::move(sw_frame);
                 }
+                m_video_frames.Push(PrepareVideoFrame(std::move(buffer.value()), *up_frame));
                 m_video_frames_cv.Notify();
             }
         }
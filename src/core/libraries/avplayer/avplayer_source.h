@@ -16,6 +16,8 @@
 #include "core/libraries/avplayer/avplayer_data_streamer.h"
 #include "core/libraries/kernel/threads.h"
 
+struct AVBufferRef;
+struct AVCodec;
 struct AVCodecContext;
 struct AVFormatContext;
 struct AVFrame;
@@ -180,8 +182,10 @@ private:
 
     bool HasRunningThreads() const;
 
+    void TrySetupHWDecoding(const AVCodec* decoder);
+
     AVFramePtr ConvertAudioFrame(const AVFrame& frame);
-    AVFramePtr ConvertVideoFrame(const AVFrame& frame);
+    bool ConvertVideoFrameToGuest(const AVFrame& frame, u8* dst);
 
     Frame PrepareAudioFrame(GuestBuffer buffer, const AVFrame& frame);
     Frame PrepareVideoFrame(GuestBuffer buffer, const AVFrame& frame);
@@ -232,6 +236,12 @@ private:
     SWRContextPtr m_swr_context{nullptr, &ReleaseSWRContext};
     SWSContextPtr m_sws_context{nullptr, &ReleaseSWSContext};
 
+    // Hardware decode device shared with the video codec context; unref'd in
+    // the destructor. m_hw_pix_fmt is the AVPixelFormat hardware frames come
+    // back in, or -1 (AV_PIX_FMT_NONE) when decoding in software.
+    AVBufferRef* m_hw_device_ctx{};
+    int m_hw_pix_fmt = -1;
+
     std::optional<u64> m_last_audio_ts{};
     std::optional<std::chrono::high_resolution_clock::time_point> m_start_time{};
     std::chrono::high_resolution_clock::time_point m_pause_time{};
@@ -34,9 +34,11 @@ enum FiberFlags : u32 {
 struct OrbisFiber;
 
 struct OrbisFiberContext {
+    /* Callee-saved machine state, layout shared with fiber_context.s. */
     struct {
-        u64 rax, rcx, rdx, rbx, rsp, rbp, r8, r9, r10, r11, r12, r13, r14, r15;
+        u64 rip, rsp, rbp, rbx, r12, r13, r14, r15;
         u16 fpucw;
+        s8 pad[2];
         u32 mxcsr;
     };
     OrbisFiber* current_fiber;
@@ -1,29 +1,27 @@
 # SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 # SPDX-License-Identifier: GPL-2.0-or-later
 
+# Both primitives are reached through ordinary System V calls, so every caller-saved
+# register is dead at this point and only the callee-saved set (rbx, rsp, rbp, r12-r15)
+# plus the x87/SSE control words has to travel with the fiber. No signal mask syscalls.
+
 .global _sceFiberSetJmp
 _sceFiberSetJmp:
-    movq %rax, 0x0(%rdi)
-
-    movq (%rsp), %rdx
-    movq %rdx, 0x10(%rdi)
+    # Save the return address; later calls in the caller's frame reuse this stack slot,
+    # so LongJmp has to write it back before returning through it.
+    movq (%rsp), %rax
+    movq %rax, 0x00(%rdi)
 
-    movq %rcx, 0x08(%rdi)
+    movq %rsp, 0x08(%rdi)
+    movq %rbp, 0x10(%rdi)
     movq %rbx, 0x18(%rdi)
-    movq %rsp, 0x20(%rdi)
-    movq %rbp, 0x28(%rdi)
+    movq %r12, 0x20(%rdi)
+    movq %r13, 0x28(%rdi)
+    movq %r14, 0x30(%rdi)
+    movq %r15, 0x38(%rdi)
 
-    movq %r8,  0x30(%rdi)
-    movq %r9,  0x38(%rdi)
-    movq %r10, 0x40(%rdi)
-    movq %r11, 0x48(%rdi)
-    movq %r12, 0x50(%rdi)
-    movq %r13, 0x58(%rdi)
-    movq %r14, 0x60(%rdi)
-    movq %r15, 0x68(%rdi)
-
-    fnstcw  0x70(%rdi)
-    stmxcsr 0x72(%rdi)
+    fnstcw  0x40(%rdi)
+    stmxcsr 0x44(%rdi)
 
     xor %eax, %eax
     ret
@@ -32,7 +30,7 @@ _sceFiberSetJmp:
 _sceFiberLongJmp:
     # MXCSR = (MXCSR & 0x3f) ^ (ctx->mxcsr & ~0x3f)
     stmxcsr -0x4(%rsp)
-    movl 0x72(%rdi), %eax
+    movl 0x44(%rdi), %eax
     andl $0xffffffc0, %eax
     movl -0x4(%rsp), %ecx
     andl $0x3f, %ecx
@@ -40,26 +38,19 @@ _sceFiberLongJmp:
     movl %ecx, -0x4(%rsp)
     ldmxcsr -0x4(%rsp)
 
-    movq 0x00(%rdi), %rax
-    movq 0x08(%rdi), %rcx
-    movq 0x10(%rdi), %rdx
+    fldcw 0x40(%rdi)
+
+    movq 0x08(%rdi), %rsp
+    movq 0x10(%rdi), %rbp
     movq 0x18(%rdi), %rbx
-    movq 0x20(%rdi), %rsp
-    movq 0x28(%rdi), %rbp
-
-    movq 0x30(%rdi), %r8
-    movq 0x38(%rdi), %r9
-    movq 0x40(%rdi), %r10
-    movq 0x48(%rdi), %r11
-    movq 0x50(%rdi), %r12
-    movq 0x58(%rdi), %r13
-    movq 0x60(%rdi), %r14
-    movq 0x68(%rdi), %r15
-
-    fldcw 0x70(%rdi)
-
-    # Make the jump and return 1
-    movq %rdx, 0x00(%rsp)
+    movq 0x20(%rdi), %r12
+    movq 0x28(%rdi), %r13
+    movq 0x30(%rdi), %r14
+    movq 0x38(%rdi), %r15
+
+    # Restore the return address and make the jump, returning 1 from SetJmp
+    movq 0x00(%rdi), %rax
+    movq %rax, 0x00(%rsp)
     movl $0x1, %eax
     ret
 
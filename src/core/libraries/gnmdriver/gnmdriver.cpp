@@ -89,6 +89,42 @@ static void WaitGpuIdle() {
     cv_lock.wait(lock, [] { return submission_lock == 0; });
 }
 
+// Debug-tier PM4 framing check, enabled per-title with the DebugDump setting.
+// The release submit path deliberately stays at pointer/size validation only:
+// walking packets costs time proportional to the DCB size on every submit,
+// and Liverpool inspects opcodes as it executes anyway. What it cannot do is
+// point at the bad packet when a stream is malformed — it just hits an
+// UNREACHABLE — so this pass reports the offset up front when enabled.
+static void ValidateCommandBufferFraming(std::span<const u32> cmd, const char* label) {
+    u32 offs_dw = 0;
+    while (offs_dw < cmd.size()) {
+        const u32 header = cmd[offs_dw];
+        const u32 type = header >> 30;
+        u32 next_dw;
+        switch (type) {
+        case 0: // register write, bits 29:16 hold the count minus one
+        case 3: // opcode packet, bits 29:16 hold the body size minus one
+            next_dw = offs_dw + ((header >> 16) & 0x3fffu) + 2;
+            break;
+        case 2: // single-dword filler
+            next_dw = offs_dw + 1;
+            break;
+        default:
+            LOG_WARNING(Lib_GnmDriver, "{}: PM4 type-{} header {:#010x} at dword {:#x}", label,
+                        type, header, offs_dw);
+            return;
+        }
+        if (next_dw > cmd.size()) {
+            LOG_WARNING(Lib_GnmDriver,
+                        "{}: packet with header {:#010x} at dword {:#x} overruns the buffer "
+                        "({:#x} > {:#x} dwords)",
+                        label, header, offs_dw, next_dw, cmd.size());
+            return;
+        }
+        offs_dw = next_dw;
+    }
+}
+
 // Write a special ending NOP packet with N DWs data block
 static inline u32* WriteTrailingNop(u32* cmdbuf, u32 data_block_size) {
     auto* nop = reinterpret_cast<PM4CmdNop*>(cmdbuf);
@@ -322,7 +358,7 @@ void PS4_SYSV_ABI sceGnmDingDong(u32 gnm_vqid, u32 next_offs_dw) {
 
     asc_next_offs_dw[vqid] = next_offs_dw;
 
-    if (DebugState.DumpingCurrentFrame()) {
+    if (DebugState.DumpingCurrentFrame() || DebugState.IsContinuousCaptureEnabled()) {
         static auto last_frame_num = -1LL;
         static u32 seq_num{};
         if (last_frame_num == frames_submitted) {
@@ -346,13 +382,17 @@ void PS4_SYSV_ABI sceGnmDingDong(u32 gnm_vqid, u32 next_offs_dw) {
 
         using namespace DebugStateType;
 
-        DebugState.PushQueueDump({
-            .type = QueueType::acb,
-            .submit_num = seq_num,
-            .num2 = gnm_vqid,
-            .data = {acb.begin(), acb.end()},
-            .base_addr = base_addr,
-        });
+        if (DebugState.DumpingCurrentFrame()) {
+            DebugState.PushQueueDump({
+                .type = QueueType::acb,
+                .submit_num = seq_num,
+                .num2 = gnm_vqid,
+                .data = {acb.begin(), acb.end()},
+                .base_addr = base_addr,
+            });
+        } else {
+            DebugState.PushCaptureSubmit(QueueType::acb, seq_num, gnm_vqid, acb, base_addr);
+        }
     }
     liverpool->SubmitAsc(gnm_vqid, acb_span);
 }
@@ -2260,7 +2300,16 @@ int PS4_SYSV_ABI sceGnmSubmitCommandBuffersForWorkload(u32 workload, u32 count,
         const auto& dcb_span = std::span{dcb_gpu_addrs[cbpair], dcb_size_dw};
         const auto& ccb_span = std::span{ccb, ccb_size_dw};
 
-        if (DebugState.DumpingCurrentFrame()) {
+        // Evaluated once; the config is loaded well before the first submit.
+        static const bool validate_framing = Config::debugDump();
+        if (validate_framing) {
+            ValidateCommandBufferFraming(dcb_span, "dcb");
+            if (!ccb_span.empty()) {
+                ValidateCommandBufferFraming(ccb_span, "ccb");
+            }
+        }
+
+        if (DebugState.DumpingCurrentFrame() || DebugState.IsContinuousCaptureEnabled()) {
             static auto last_frame_num = -1LL;
             static u32 seq_num{};
             if (last_frame_num == frames_submitted && cbpair == 0) {
@@ -2272,20 +2321,27 @@ int PS4_SYSV_ABI sceGnmSubmitCommandBuffersForWorkload(u32 workload, u32 count,
 
             using DebugStateType::QueueType;
 
-            DebugState.PushQueueDump({
-                .type = QueueType::dcb,
-                .submit_num = seq_num,
-                .num2 = cbpair,
-                .data = {dcb_span.begin(), dcb_span.end()},
-                .base_addr = reinterpret_cast<uintptr_t>(dcb_gpu_addrs[cbpair]),
-            });
-            DebugState.PushQueueDump({
-                .type = QueueType::ccb,
-                .submit_num = seq_num,
-                .num2 = cbpair,
-                .data = {ccb_span.begin(), ccb_span.end()},
-                .base_addr = reinterpret_cast<uintptr_t>(ccb),
-            });
+            if (DebugState.DumpingCurrentFrame()) {
+                DebugState.PushQueueDump({
+                    .type = QueueType::dcb,
+                    .submit_num = seq_num,
+                    .num2 = cbpair,
+                    .data = {dcb_span.begin(), dcb_span.end()},
+                    .base_addr = reinterpret_cast<uintptr_t>(dcb_gpu_addrs[cbpair]),
+                });
+                DebugState.PushQueueDump({
+                    .type = QueueType::ccb,
+                    .submit_num = seq_num,
+                    .num2 = cbpair,
+                    .data = {ccb_span.begin(), ccb_span.end()},
+                    .base_addr = reinterpret_cast<uintptr_t>(ccb),
+                });
+            } else {
+                DebugState.PushCaptureSubmit(QueueType::dcb, seq_num, cbpair, dcb_span,
+                                             reinterpret_cast<uintptr_t>(dcb_gpu_addrs[cbpair]));
+                DebugState.PushCaptureSubmit(QueueType::ccb, seq_num, cbpair, ccb_span,
+                                             reinterpret_cast<uintptr_t>(ccb));
+            }
         }
         liverpool->SubmitGfx(dcb_span, ccb_span);
     }
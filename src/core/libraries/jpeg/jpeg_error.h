@@ -7,3 +7,5 @@ constexpr int ORBIS_JPEG_ENC_ERROR_INVALID_ADDR = 0x80650101;
 constexpr int ORBIS_JPEG_ENC_ERROR_INVALID_SIZE = 0x80650102;
 constexpr int ORBIS_JPEG_ENC_ERROR_INVALID_PARAM = 0x80650103;
 constexpr int ORBIS_JPEG_ENC_ERROR_INVALID_HANDLE = 0x80650104;
+constexpr int ORBIS_JPEG_ENC_ERROR_INSUFFICIENT_MEMORY_SIZE = 0x80650105;
+constexpr int ORBIS_JPEG_ENC_ERROR_FATAL = 0x806501FF;
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+#include <memory>
 #include <magic_enum/magic_enum.hpp>
 
 #include "common/alignment.h"
@@ -11,6 +13,11 @@
 #include "jpeg_error.h"
 #include "jpegenc.h"
 
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libswscale/swscale.h>
+}
+
 namespace Libraries::JpegEnc {
 
 constexpr s32 ORBIS_JPEG_ENC_MINIMUM_MEMORY_SIZE = 0x800;
@@ -161,6 +168,32 @@ s32 PS4_SYSV_ABI sceJpegEncDelete(OrbisJpegEncHandle handle) {
     return ORBIS_OK;
 }
 
+static AVPixelFormat GetInputPixelFormat(const OrbisJpegEncEncodeParamPixelFormat format) {
+    switch (format) {
+    case ORBIS_JPEG_ENC_PIXEL_FORMAT_R8G8B8A8:
+        return AV_PIX_FMT_RGBA;
+    case ORBIS_JPEG_ENC_PIXEL_FORMAT_B8G8R8A8:
+        return AV_PIX_FMT_BGRA;
+    case ORBIS_JPEG_ENC_PIXEL_FORMAT_Y8U8Y8V8:
+        return AV_PIX_FMT_YUYV422;
+    case ORBIS_JPEG_ENC_PIXEL_FORMAT_Y8:
+        return AV_PIX_FMT_GRAY8;
+    default:
+        return AV_PIX_FMT_NONE;
+    }
+}
+
+static AVPixelFormat GetOutputPixelFormat(const OrbisJpengEncEncodeParamSamplingType sampling) {
+    switch (sampling) {
+    case ORBIS_JPEG_ENC_SAMPLING_TYPE_420:
+        return AV_PIX_FMT_YUVJ420P;
+    case ORBIS_JPEG_ENC_SAMPLING_TYPE_422:
+        return AV_PIX_FMT_YUVJ422P;
+    default:
+        return AV_PIX_FMT_YUVJ444P;
+    }
+}
+
 s32 PS4_SYSV_ABI sceJpegEncEncode(OrbisJpegEncHandle handle, const OrbisJpegEncEncodeParam* param,
                                   OrbisJpegEncOutputInfo* output_info) {
     if (auto handle_ret = ValidateJpecEngHandle(handle); handle_ret != ORBIS_OK) {
@@ -172,8 +205,8 @@ s32 PS4_SYSV_ABI sceJpegEncEncode(OrbisJpegEncHandle handle, const OrbisJpegEncE
         return param_ret;
     }
 
-    LOG_ERROR(Lib_Jpeg,
-              "(STUBBED) image_size = {} , jpeg_size = {} , image_width = {} , image_height = {} , "
+    LOG_DEBUG(Lib_Jpeg,
+              "image_size = {} , jpeg_size = {} , image_width = {} , image_height = {} , "
               "image_pitch = {} , pixel_format = {} , encode_mode = {} , color_space = {} , "
               "sampling_type = {} , compression_ratio = {} , restart_interval = {}",
               param->image_size, param->jpeg_size, param->image_width, param->image_height,
@@ -182,8 +215,73 @@ s32 PS4_SYSV_ABI sceJpegEncEncode(OrbisJpegEncHandle handle, const OrbisJpegEncE
               magic_enum::enum_name(param->sampling_type), param->compression_ratio,
               param->restart_interval);
 
+    const auto codec = avcodec_find_encoder(AV_CODEC_ID_MJPEG);
+    if (codec == nullptr) {
+        LOG_ERROR(Lib_Jpeg, "MJPEG encoder unavailable");
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+
+    // compression_ratio runs 0 (best quality) to 255 (smallest file); map it
+    // onto the encoder's 1..31 quantizer scale.
+    const int quality = 1 + (30 * param->compression_ratio) / 255;
+
+    const auto context = std::unique_ptr<AVCodecContext, void (*)(AVCodecContext*)>(
+        avcodec_alloc_context3(codec), [](AVCodecContext* ctx) { avcodec_free_context(&ctx); });
+    context->width = param->image_width;
+    context->height = param->image_height;
+    context->pix_fmt = GetOutputPixelFormat(param->sampling_type);
+    context->time_base = {1, 25};
+    context->flags |= AV_CODEC_FLAG_QSCALE;
+    context->global_quality = FF_QP2LAMBDA * quality;
+    if (avcodec_open2(context.get(), codec, nullptr) < 0) {
+        LOG_ERROR(Lib_Jpeg, "Could not open MJPEG encoder");
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+
+    const auto frame = std::unique_ptr<AVFrame, void (*)(AVFrame*)>(
+        av_frame_alloc(), [](AVFrame* ptr) { av_frame_free(&ptr); });
+    frame->format = context->pix_fmt;
+    frame->width = context->width;
+    frame->height = context->height;
+    frame->quality = context->global_quality;
+    if (av_frame_get_buffer(frame.get(), 0) < 0) {
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+
+    // Convert the guest image into the encoder's (subsampled) YCbCr layout.
+    // swscale carries the SIMD color conversion kernels.
+    const auto sws = std::unique_ptr<SwsContext, void (*)(SwsContext*)>(
+        sws_getContext(param->image_width, param->image_height,
+                       GetInputPixelFormat(param->pixel_format), frame->width, frame->height,
+                       AVPixelFormat(frame->format), SWS_FAST_BILINEAR, nullptr, nullptr, nullptr),
+        &sws_freeContext);
+    if (sws == nullptr) {
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+    const u8* src_data[1] = {static_cast<const u8*>(param->image)};
+    const int src_linesize[1] = {int(param->image_pitch)};
+    if (sws_scale(sws.get(), src_data, src_linesize, 0, param->image_height, frame->data,
+                  frame->linesize) < 0) {
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+
+    if (avcodec_send_frame(context.get(), frame.get()) < 0) {
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+    const auto packet = std::unique_ptr<AVPacket, void (*)(AVPacket*)>(
+        av_packet_alloc(), [](AVPacket* ptr) { av_packet_free(&ptr); });
+    if (avcodec_receive_packet(context.get(), packet.get()) < 0) {
+        return ORBIS_JPEG_ENC_ERROR_FATAL;
+    }
+    if (u32(packet->size) > param->jpeg_size) {
+        LOG_ERROR(Lib_Jpeg, "Output buffer too small: need {}, have {}", packet->size,
+                  param->jpeg_size);
+        return ORBIS_JPEG_ENC_ERROR_INSUFFICIENT_MEMORY_SIZE;
+    }
+    std::memcpy(param->jpeg, packet->data, packet->size);
+
     if (output_info) {
-        output_info->size = param->jpeg_size;
+        output_info->size = packet->size;
         output_info->height = param->image_height;
     }
     return ORBIS_OK;
@@ -1,12 +1,19 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "aio.h"
 #include "common/assert.h"
+#include "common/bounded_threadsafe_queue.h"
 #include "common/debug.h"
 #include "common/logging/log.h"
+#include "common/thread.h"
 #include "core/libraries/kernel/equeue.h"
 #include "core/libraries/kernel/orbis_error.h"
 #include "core/libraries/libs.h"
@@ -14,10 +21,110 @@
 
 namespace Libraries::Kernel {
 
-#define MAX_QUEUE 512
+static constexpr s32 MaxQueue = 512;
+
+// A submitted batch of requests, executed in order on the AIO worker thread.
+// Submission returns to the guest immediately; titles observe completion through
+// the request states like they would on real hardware.
+struct AioBatch {
+    std::vector<OrbisKernelAioRWRequest> requests;
+    std::vector<OrbisKernelAioSubmitId> ids;
+    bool per_request_ids;
+    bool is_write;
+};
+
+static std::array<std::atomic<s32>, MaxQueue> id_state;
+static std::mutex id_mutex;
+static s32 id_index = 1;
+
+static Common::MPSCQueue<AioBatch, MaxQueue> batch_queue;
+static std::mutex wait_mutex;
+static std::condition_variable wait_cond;
+static std::jthread worker_thread;
+
+static OrbisKernelAioSubmitId AllocateId() {
+    std::scoped_lock lock{id_mutex};
+    const auto id = id_index;
+    id_index = (id_index + 1) % MaxQueue;
+    // Skip id 0, sceKernelAioCancelRequest uses it to mean "no request".
+    if (id_index == 0) {
+        id_index = 1;
+    }
+    return id;
+}
+
+static void SetIdState(OrbisKernelAioSubmitId id, s32 state) {
+    {
+        // Publish under the wait mutex so a waiter between its predicate check
+        // and going to sleep cannot miss the notification.
+        std::scoped_lock lock{wait_mutex};
+        id_state[id] = state;
+    }
+    wait_cond.notify_all();
+}
+
+static void AioWorker(std::stop_token stoken) {
+    Common::SetCurrentThreadName("shadPS4:AioWorker");
+    while (!stoken.stop_requested()) {
+        AioBatch batch = batch_queue.PopWait(stoken);
+        for (size_t i = 0; i < batch.requests.size(); i++) {
+            auto& req = batch.requests[i];
+            const auto id = batch.per_request_ids ? batch.ids[i] : batch.ids[0];
+            if (id_state[id] == ORBIS_KERNEL_AIO_STATE_ABORTED) {
+                // Cancelled before we got to it.
+                continue;
+            }
+            const s64 ret = batch.is_write
+                                ? sceKernelPwrite(req.fd, req.buf, req.nbyte, req.offset)
+                                : sceKernelPread(req.fd, req.buf, req.nbyte, req.offset);
+            const s32 state =
+                ret < 0 ? ORBIS_KERNEL_AIO_STATE_ABORTED : ORBIS_KERNEL_AIO_STATE_COMPLETED;
+            req.result->state = state;
+            req.result->returnValue = ret;
+            if (batch.per_request_ids) {
+                SetIdState(id, state);
+            }
+        }
+        if (!batch.per_request_ids && !batch.ids.empty()) {
+            SetIdState(batch.ids[0], ORBIS_KERNEL_AIO_STATE_COMPLETED);
+        }
+    }
+}
+
+static s32 SubmitBatch(OrbisKernelAioRWRequest req[], s32 size, bool is_write,
+                       OrbisKernelAioSubmitId* id) {
+    AioBatch batch{};
+    batch.requests.assign(req, req + size);
+    batch.per_request_ids = false;
+    batch.is_write = is_write;
+
+    const auto new_id = AllocateId();
+    id_state[new_id] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
+    batch.ids.push_back(new_id);
+    *id = new_id;
+
+    batch_queue.EmplaceWait(std::move(batch));
+    return 0;
+}
+
+static s32 SubmitBatchMultiple(OrbisKernelAioRWRequest req[], s32 size, bool is_write,
+                               OrbisKernelAioSubmitId id[]) {
+    AioBatch batch{};
+    batch.requests.assign(req, req + size);
+    batch.per_request_ids = true;
+    batch.is_write = is_write;
+
+    batch.ids.reserve(size);
+    for (s32 i = 0; i < size; i++) {
+        const auto new_id = AllocateId();
+        id_state[new_id] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
+        batch.ids.push_back(new_id);
+        id[i] = new_id;
+    }
 
-static s32* id_state;
-static s32 id_index;
+    batch_queue.EmplaceWait(std::move(batch));
+    return 0;
+}
 
 s32 PS4_SYSV_ABI sceKernelAioInitializeImpl(void* p, s32 size) {
 
@@ -28,7 +135,7 @@ s32 PS4_SYSV_ABI sceKernelAioDeleteRequest(OrbisKernelAioSubmitId id, s32* ret)
     if (ret == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    id_state[id] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+    SetIdState(id, ORBIS_KERNEL_AIO_STATE_ABORTED);
     *ret = 0;
     return 0;
 }
@@ -38,7 +145,7 @@ s32 PS4_SYSV_ABI sceKernelAioDeleteRequests(OrbisKernelAioSubmitId id[], s32 num
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
     for (s32 i = 0; i < num; i++) {
-        id_state[id[i]] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+        SetIdState(id[i], ORBIS_KERNEL_AIO_STATE_ABORTED);
         ret[i] = 0;
     }
 
@@ -68,7 +175,7 @@ s32 PS4_SYSV_ABI sceKernelAioCancelRequest(OrbisKernelAioSubmitId id, s32* state
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
     if (id) {
-        id_state[id] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+        SetIdState(id, ORBIS_KERNEL_AIO_STATE_ABORTED);
         *state = ORBIS_KERNEL_AIO_STATE_ABORTED;
     } else {
         *state = ORBIS_KERNEL_AIO_STATE_PROCESSING;
@@ -82,7 +189,7 @@ s32 PS4_SYSV_ABI sceKernelAioCancelRequests(OrbisKernelAioSubmitId id[], s32 num
     }
     for (s32 i = 0; i < num; i++) {
         if (id[i]) {
-            id_state[id[i]] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+            SetIdState(id[i], ORBIS_KERNEL_AIO_STATE_ABORTED);
             state[i] = ORBIS_KERNEL_AIO_STATE_ABORTED;
         } else {
             state[i] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
@@ -96,19 +203,15 @@ s32 PS4_SYSV_ABI sceKernelAioWaitRequest(OrbisKernelAioSubmitId id, s32* state,
     if (state == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    u32 timer = 0;
-
-    s32 timeout = 0;
+    const auto done = [id] { return id_state[id] != ORBIS_KERNEL_AIO_STATE_PROCESSING; };
 
-    while (id_state[id] == ORBIS_KERNEL_AIO_STATE_PROCESSING) {
-        sceKernelUsleep(10);
-
-        timer += 10;
+    bool timeout = false;
+    {
+        std::unique_lock lock{wait_mutex};
         if (*usec) {
-            if (timer > *usec) {
-                timeout = 1;
-                break;
-            }
+            timeout = !wait_cond.wait_for(lock, std::chrono::microseconds(*usec), done);
+        } else {
+            wait_cond.wait(lock, done);
         }
     }
 
@@ -124,22 +227,21 @@ s32 PS4_SYSV_ABI sceKernelAioWaitRequests(OrbisKernelAioSubmitId id[], s32 num,
     if (state == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    u32 timer = 0;
+    // The timeout budget is shared across all requests in the list.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(*usec);
     s32 timeout = 0;
     s32 completion = 0;
 
     for (s32 i = 0; i < num; i++) {
         if (!completion && !timeout) {
-            while (id_state[id[i]] == ORBIS_KERNEL_AIO_STATE_PROCESSING) {
-                sceKernelUsleep(10);
-                timer += 10;
-
-                if (*usec) {
-                    if (timer > *usec) {
-                        timeout = 1;
-                        break;
-                    }
-                }
+            const auto done = [&] {
+                return id_state[id[i]] != ORBIS_KERNEL_AIO_STATE_PROCESSING;
+            };
+            std::unique_lock lock{wait_mutex};
+            if (*usec) {
+                timeout = !wait_cond.wait_until(lock, deadline, done);
+            } else {
+                wait_cond.wait(lock, done);
             }
         }
 
@@ -165,32 +267,7 @@ s32 PS4_SYSV_ABI sceKernelAioSubmitReadCommands(OrbisKernelAioRWRequest req[], s
     if (id == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-
-    for (s32 i = 0; i < size; i++) {
-
-        s64 ret = sceKernelPread(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-        }
-    }
-
-    id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-
-    *id = id_index;
-
-    id_index = (id_index + 1) % MAX_QUEUE;
-
-    if (!id_index)
-        id_index++;
-
-    return 0;
+    return SubmitBatch(req, size, false, id);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitReadCommandsMultiple(OrbisKernelAioRWRequest req[], s32 size,
@@ -201,33 +278,7 @@ s32 PS4_SYSV_ABI sceKernelAioSubmitReadCommandsMultiple(OrbisKernelAioRWRequest
     if (id == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    for (s32 i = 0; i < size; i++) {
-        id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-
-        s64 ret = sceKernelPread(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-        }
-
-        id[i] = id_index;
-
-        id_index = (id_index + 1) % MAX_QUEUE;
-
-        if (!id_index)
-            id_index++;
-    }
-
-    return 0;
+    return SubmitBatchMultiple(req, size, false, id);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitWriteCommands(OrbisKernelAioRWRequest req[], s32 size, s32 prio,
@@ -238,35 +289,7 @@ s32 PS4_SYSV_ABI sceKernelAioSubmitWriteCommands(OrbisKernelAioRWRequest req[],
     if (id == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    for (s32 i = 0; i < size; i++) {
-        id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-
-        s64 ret = sceKernelPwrite(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-        }
-    }
-
-    *id = id_index;
-
-    id_index = (id_index + 1) % MAX_QUEUE;
-
-    // skip id_index equals 0 , because sceKernelAioCancelRequest will submit id
-    // equal to 0
-    if (!id_index)
-        id_index++;
-
-    return 0;
+    return SubmitBatch(req, size, true, id);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitWriteCommandsMultiple(OrbisKernelAioRWRequest req[], s32 size,
@@ -277,29 +300,7 @@ s32 PS4_SYSV_ABI sceKernelAioSubmitWriteCommandsMultiple(OrbisKernelAioRWRequest
     if (id == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    for (s32 i = 0; i < size; i++) {
-        id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-        s64 ret = sceKernelPwrite(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-        }
-
-        id[i] = id_index;
-        id_index = (id_index + 1) % MAX_QUEUE;
-
-        if (!id_index)
-            id_index++;
-    }
-    return 0;
+    return SubmitBatchMultiple(req, size, true, id);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSetParam() {
@@ -313,9 +314,7 @@ s32 PS4_SYSV_ABI sceKernelAioInitializeParam() {
 }
 
 void RegisterAio(Core::Loader::SymbolsResolver* sym) {
-    id_index = 1;
-    id_state = (int*)malloc(sizeof(int) * MAX_QUEUE);
-    memset(id_state, 0, sizeof(sizeof(int) * MAX_QUEUE));
+    worker_thread = std::jthread{AioWorker};
 
     LIB_FUNCTION("fR521KIGgb8", "libkernel", 1, "libkernel", sceKernelAioCancelRequest);
     LIB_FUNCTION("3Lca1XBrQdY", "libkernel", 1, "libkernel", sceKernelAioCancelRequests);
@@ -336,4 +335,4 @@ void RegisterAio(Core::Loader::SymbolsResolver* sym) {
     LIB_FUNCTION("lgK+oIWkJyA", "libkernel", 1, "libkernel", sceKernelAioWaitRequests);
 }
 
-} // namespace Libraries::Kernel
\ No newline at end of file
+} // namespace Libraries::Kernel
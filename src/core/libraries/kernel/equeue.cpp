@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <thread>
 #include <magic_enum/magic_enum.hpp>
 
@@ -23,6 +24,7 @@ extern void KernelSignalRequest();
 
 static std::unordered_map<s32, EqueueInternal*> kqueues;
 static constexpr auto HrTimerSpinlockThresholdNs = 1200000u;
+static constexpr auto TimerCoalesceSlack = std::chrono::microseconds(500);
 
 EqueueInternal* GetEqueue(OrbisKernelEqueue eq) {
     if (!kqueues.contains(eq)) {
@@ -140,6 +142,10 @@ bool EqueueInternal::ScheduleEvent(u64 id, s16 filter,
         it->timer->expires_at(it->timer->expiry() + event.timer_interval);
     }
 
+    if (filter == OrbisKernelEvent::Filter::Timer) {
+        CoalesceTimer(*it);
+    }
+
     it->timer->async_wait(
         [this, event_data = event.event, callback](const boost::system::error_code& ec) {
             if (ec) {
@@ -158,6 +164,40 @@ bool EqueueInternal::ScheduleEvent(u64 id, s16 filter,
     return true;
 }
 
+// Called with m_mutex held, before the async wait is armed. Titles drive many short
+// periodic timers per queue, each of which is otherwise a separate host wakeup and thread
+// wake. Millisecond-resolution timers tolerate a little slack, so when another pending
+// timer on this queue already expires within the slack window the new deadline snaps to
+// it and both fire from a single wakeup. High-resolution timers are never coalesced.
+void EqueueInternal::CoalesceTimer(EqueueEvent& event) {
+    // Never skew a timer by more than a tenth of its period.
+    const auto slack = std::min<std::chrono::steady_clock::duration>(TimerCoalesceSlack,
+                                                                     event.timer_interval / 10);
+    if (slack <= std::chrono::steady_clock::duration::zero()) {
+        return;
+    }
+    const auto target = event.timer->expiry();
+    auto best_delta = slack;
+    bool found = false;
+    std::chrono::steady_clock::time_point best{};
+    for (const auto& other : m_events) {
+        if (&other == &event || !other.timer ||
+            other.event.filter != OrbisKernelEvent::Filter::Timer) {
+            continue;
+        }
+        const auto delta = other.timer->expiry() - target;
+        const auto abs_delta = delta < delta.zero() ? -delta : delta;
+        if (abs_delta <= best_delta) {
+            best_delta = abs_delta;
+            best = other.timer->expiry();
+            found = true;
+        }
+    }
+    if (found && best != target) {
+        event.timer->expires_at(best);
+    }
+}
+
 bool EqueueInternal::RemoveEvent(u64 id, s16 filter) {
     bool has_found = false;
     std::scoped_lock lock{m_mutex};
@@ -166,6 +206,9 @@ bool EqueueInternal::RemoveEvent(u64 id, s16 filter) {
         return ev.event.ident == id && ev.event.filter == filter;
     });
     if (it != m_events.cend()) {
+        if (it->IsTriggered()) {
+            m_num_triggered.fetch_sub(1);
+        }
         m_events.erase(it);
         has_found = true;
     }
@@ -175,7 +218,13 @@ bool EqueueInternal::RemoveEvent(u64 id, s16 filter) {
 int EqueueInternal::WaitForEvents(OrbisKernelEvent* ev, int num, const OrbisKernelUseconds* timo) {
     if (timo != nullptr && *timo == 0) {
         // Effectively acts as a poll; only events that have already
-        // arrived at the time of this function call can be received
+        // arrived at the time of this function call can be received.
+        // The triggered-count hint lets back-to-back polls return
+        // without ever touching the mutex.
+        if (m_num_triggered.load() == 0) {
+            return 0;
+        }
+        std::scoped_lock lock{m_mutex};
         return GetTriggeredEvents(ev, num);
     }
     const auto micros = timo ? *timo : 0u;
@@ -192,6 +241,9 @@ int EqueueInternal::WaitForEvents(OrbisKernelEvent* ev, int num, const OrbisKern
         return count > 0;
     };
 
+    // Advertise ourselves before re-checking the event list under the mutex;
+    // triggerers that observe no waiters may then elide the wakeup.
+    m_num_waiters.fetch_add(1);
     if (micros == 0) {
         // Wait indefinitely for events
         std::unique_lock lock{m_mutex};
@@ -201,6 +253,7 @@ int EqueueInternal::WaitForEvents(OrbisKernelEvent* ev, int num, const OrbisKern
         std::unique_lock lock{m_mutex};
         m_cond.wait_for(lock, std::chrono::microseconds(micros), predicate);
     }
+    m_num_waiters.fetch_sub(1);
 
     return count;
 }
@@ -211,6 +264,7 @@ bool EqueueInternal::TriggerEvent(u64 ident, s16 filter, void* trigger_data) {
         std::scoped_lock lock{m_mutex};
         for (auto& event : m_events) {
             if (event.event.ident == ident && event.event.filter == filter) {
+                const bool was_triggered = event.IsTriggered();
                 if (filter == OrbisKernelEvent::Filter::VideoOut) {
                     event.TriggerDisplay(trigger_data);
                 } else if (filter == OrbisKernelEvent::Filter::User) {
@@ -221,11 +275,19 @@ bool EqueueInternal::TriggerEvent(u64 ident, s16 filter, void* trigger_data) {
                 } else {
                     event.Trigger(trigger_data);
                 }
+                if (!was_triggered) {
+                    m_num_triggered.fetch_add(1);
+                }
                 has_found = true;
             }
         }
     }
-    m_cond.notify_one();
+    // Waiters advertise themselves before scanning the event list under the
+    // mutex, so observing no waiters here means none can miss this trigger
+    // and the wakeup can be skipped entirely.
+    if (m_num_waiters.load() != 0) {
+        m_cond.notify_one();
+    }
     return has_found;
 }
 
@@ -234,14 +296,19 @@ int EqueueInternal::GetTriggeredEvents(OrbisKernelEvent* ev, int num) {
     for (auto it = m_events.begin(); it != m_events.end();) {
         if (it->IsTriggered()) {
             ev[count++] = it->event;
-            if (it->event.flags & OrbisKernelEvent::Flags::Clear) {
+            const bool clear = it->event.flags & OrbisKernelEvent::Flags::Clear;
+            const bool one_shot = it->event.flags & OrbisKernelEvent::Flags::OneShot;
+            if (clear) {
                 it->Clear();
             }
-            if (it->event.flags & OrbisKernelEvent::Flags::OneShot) {
+            if (one_shot) {
                 it = m_events.erase(it);
             } else {
                 ++it;
             }
+            if (clear || one_shot) {
+                m_num_triggered.fetch_sub(1);
+            }
 
             if (count == num) {
                 break;
@@ -318,6 +385,10 @@ s32 PS4_SYSV_ABI posix_kqueue() {
     // Reserve a file handle for the kqueue
     auto* handles = Common::Singleton<Core::FileSys::HandleTable>::Instance();
     s32 kqueue_handle = handles->CreateHandle();
+    if (kqueue_handle < 0) {
+        *__Error() = POSIX_EMFILE;
+        return -1;
+    }
     auto* kqueue_file = handles->GetFile(kqueue_handle);
     kqueue_file->type = Core::FileSys::FileType::Equeue;
 
@@ -437,6 +508,9 @@ int PS4_SYSV_ABI sceKernelCreateEqueue(OrbisKernelEqueue* eq, const char* name)
     // Reserve a file handle for the kqueue
     auto* handles = Common::Singleton<Core::FileSys::HandleTable>::Instance();
     OrbisKernelEqueue kqueue_handle = handles->CreateHandle();
+    if (kqueue_handle < 0) {
+        return ORBIS_KERNEL_ERROR_EMFILE;
+    }
     auto* kqueue_file = handles->GetFile(kqueue_handle);
     kqueue_file->type = Core::FileSys::FileType::Equeue;
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <string>
@@ -181,12 +182,19 @@ public:
     bool EventExists(u64 id, s16 filter);
 
 private:
+    void CoalesceTimer(EqueueEvent& event);
+
     OrbisKernelEqueue m_handle;
     std::string m_name;
     std::mutex m_mutex;
     std::vector<EqueueEvent> m_events;
     std::condition_variable m_cond;
     std::unordered_map<u64, SmallTimer> m_small_timers;
+    /// Pending triggered events and sleeping waiters. Both are hints that let the
+    /// trigger and zero-timeout poll paths skip m_mutex; the truth is always
+    /// re-established under the mutex before any event is delivered.
+    std::atomic<u32> m_num_triggered{};
+    std::atomic<u32> m_num_waiters{};
 };
 
 EqueueInternal* GetEqueue(OrbisKernelEqueue eq);
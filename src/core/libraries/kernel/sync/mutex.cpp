@@ -3,30 +3,23 @@
 
 #include "mutex.h"
 
-#include "common/assert.h"
-
 namespace Libraries::Kernel {
 
-TimedMutex::TimedMutex() {
-#ifdef _WIN64
-    mtx = CreateMutex(nullptr, false, nullptr);
-    ASSERT(mtx);
-#endif
-}
+TimedMutex::TimedMutex() = default;
 
-TimedMutex::~TimedMutex() {
-#ifdef _WIN64
-    CloseHandle(mtx);
-#endif
-}
+TimedMutex::~TimedMutex() = default;
 
 void TimedMutex::lock() {
 #ifdef _WIN64
-    for (;;) {
-        u64 res = WaitForSingleObjectEx(mtx, INFINITE, true);
-        if (res == WAIT_OBJECT_0) {
-            return;
-        }
+    u32 expected = Unlocked;
+    if (state.compare_exchange_strong(expected, Locked, std::memory_order_acquire)) [[likely]] {
+        return;
+    }
+    // Mark contended so the owner knows to wake us, then sleep until the exchange
+    // actually obtains the lock.
+    while (state.exchange(Contended, std::memory_order_acquire) != Unlocked) {
+        u32 contended = Contended;
+        WaitOnAddress(&state, &contended, sizeof(state), INFINITE);
     }
 #else
     mtx.lock();
@@ -35,7 +28,8 @@ void TimedMutex::lock() {
 
 bool TimedMutex::try_lock() {
 #ifdef _WIN64
-    return WaitForSingleObjectEx(mtx, 0, true) == WAIT_OBJECT_0;
+    u32 expected = Unlocked;
+    return state.compare_exchange_strong(expected, Locked, std::memory_order_acquire);
 #else
     return mtx.try_lock();
 #endif
@@ -43,10 +37,12 @@ bool TimedMutex::try_lock() {
 
 void TimedMutex::unlock() {
 #ifdef _WIN64
-    ReleaseMutex(mtx);
+    if (state.exchange(Unlocked, std::memory_order_release) == Contended) {
+        WakeByAddressSingle(&state);
+    }
 #else
     mtx.unlock();
 #endif
 }
 
-} // namespace Libraries::Kernel
\ No newline at end of file
+} // namespace Libraries::Kernel
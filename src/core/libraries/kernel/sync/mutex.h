@@ -8,6 +8,7 @@
 #include "common/types.h"
 
 #ifdef _WIN64
+#include <atomic>
 #include <windows.h>
 #else
 #include <mutex>
@@ -50,20 +51,23 @@ public:
     template <class Clock, class Duration>
     bool try_lock_until(const std::chrono::time_point<Clock, Duration>& abs_time) {
 #ifdef _WIN64
-        for (;;) {
+        u32 expected = Unlocked;
+        if (state.compare_exchange_strong(expected, Locked, std::memory_order_acquire)) {
+            return true;
+        }
+        while (state.exchange(Contended, std::memory_order_acquire) != Unlocked) {
             const auto now = Clock::now();
             if (abs_time <= now) {
+                // The contended mark may be left behind without waiters; unlock then
+                // issues one spurious wake, which is harmless.
                 return false;
             }
-
             const auto rel_ms = std::chrono::ceil<std::chrono::milliseconds>(abs_time - now);
-            u64 res = WaitForSingleObjectEx(mtx, static_cast<u64>(rel_ms.count()), true);
-            if (res == WAIT_OBJECT_0) {
-                return true;
-            } else if (res == WAIT_TIMEOUT) {
-                return false;
-            }
+            u32 contended = Contended;
+            WaitOnAddress(&state, &contended, sizeof(state),
+                          static_cast<DWORD>(rel_ms.count()));
         }
+        return true;
 #else
         return mtx.try_lock_until(abs_time);
 #endif
@@ -71,10 +75,17 @@ public:
 
 private:
 #ifdef _WIN64
-    HANDLE mtx;
+    // Futex-style mutex: the uncontended paths are a single inline CAS and the kernel
+    // is only entered through WaitOnAddress/WakeByAddress when there is contention.
+    enum : u32 {
+        Unlocked = 0,
+        Locked = 1,
+        Contended = 2, ///< Locked and there may be sleeping waiters to wake on unlock.
+    };
+    std::atomic<u32> state{Unlocked};
 #else
     std::timed_mutex mtx;
 #endif
 };
 
-} // namespace Libraries::Kernel
\ No newline at end of file
+} // namespace Libraries::Kernel
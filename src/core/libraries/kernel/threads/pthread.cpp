@@ -297,6 +297,7 @@ int PS4_SYSV_ABI posix_pthread_create_name_np(PthreadT* thread, const PthreadAtt
     if (attr != nullptr && *attr != nullptr && (*attr)->cpuset != nullptr) {
         new_thread->SetAffinity((*attr)->cpuset);
     }
+    new_thread->SetSchedPriority(new_thread->attr.prio);
     if (ret) {
         *thread = nullptr;
     }
@@ -459,13 +460,14 @@ int PS4_SYSV_ABI posix_pthread_setschedparam(PthreadT pthread, SchedPolicy polic
     if (pthread->attr.sched_policy == policy &&
         (policy == SchedPolicy::Other || pthread->attr.prio == param->sched_priority)) {
         pthread->attr.prio = param->sched_priority;
+        pthread->SetSchedPriority(pthread->attr.prio);
         pthread->lock.unlock();
         return 0;
     }
 
-    // TODO: _thr_setscheduler
     pthread->attr.sched_policy = policy;
     pthread->attr.prio = param->sched_priority;
+    pthread->SetSchedPriority(pthread->attr.prio);
     pthread->lock.unlock();
     return 0;
 }
@@ -490,12 +492,8 @@ int PS4_SYSV_ABI posix_pthread_setprio(PthreadT thread, int prio) {
         return ret;
     }
 
-    if (thread->attr.sched_policy == SchedPolicy::Other || thread->attr.prio == prio) {
-        thread->attr.prio = prio;
-    } else {
-        // TODO: _thr_setscheduler
-        thread->attr.prio = prio;
-    }
+    thread->attr.prio = prio;
+    thread->SetSchedPriority(prio);
 
     thread->lock.unlock();
     return 0;
@@ -581,6 +579,30 @@ int Pthread::SetAffinity(const Cpuset* cpuset) {
     return 0;
 }
 
+int Pthread::SetSchedPriority(int prio) {
+    uintptr_t handle = native_thr.GetHandle();
+    if (handle == 0) {
+        return POSIX_ESRCH;
+    }
+
+    // Guest priorities run from 256 (highest) to 767 (lowest), with 700 as the
+    // default. Host schedulers expose far fewer useful levels, so map bands
+    // relative to the default rather than scaling linearly. The emulator's own
+    // threads (Liverpool processor, presenter) run at Normal, so only threads
+    // the title explicitly marks urgent get raised above them, and background
+    // workers the title demotes below the default stop preempting them.
+    Common::ThreadPriority host_prio;
+    if (prio < 500) {
+        host_prio = Common::ThreadPriority::High;
+    } else if (prio <= ORBIS_KERNEL_PRIO_FIFO_DEFAULT) {
+        host_prio = Common::ThreadPriority::Normal;
+    } else {
+        host_prio = Common::ThreadPriority::Low;
+    }
+    Common::SetThreadPriority(reinterpret_cast<void*>(handle), host_prio);
+    return 0;
+}
+
 int PS4_SYSV_ABI posix_pthread_getaffinity_np(PthreadT thread, size_t cpusetsize, Cpuset* cpusetp) {
     if (thread == nullptr || cpusetp == nullptr) {
         return POSIX_EINVAL;
@@ -347,6 +347,8 @@ struct Pthread {
     }
 
     int SetAffinity(const Cpuset* cpuset);
+
+    int SetSchedPriority(int prio);
 };
 using PthreadT = Pthread*;
 
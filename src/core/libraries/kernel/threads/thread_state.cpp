@@ -28,7 +28,7 @@ ThreadState::ThreadState() {
                                       Core::MemoryProt::CpuReadWrite, Core::MemoryMapFlags::NoFlags,
                                       Core::VMAType::File, "ThrHeap");
     ASSERT_MSG(ret == 0, "Unable to allocate thread heap memory {}", ret);
-    thread_heap.Initialize(heap_addr, ThrHeapSize);
+    thread_heap.Initialize("Pthread", heap_addr, ThrHeapSize);
 }
 
 void ThreadState::Collect(Pthread* curthread) {
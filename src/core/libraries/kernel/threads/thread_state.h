@@ -68,7 +68,7 @@ struct ThreadState {
         active_threads.fetch_sub(1);
     }
 
-    Common::SlabHeap<Pthread> thread_heap;
+    Common::CachedSlabHeap<Pthread> thread_heap;
     std::set<Pthread*> threads;
     std::list<Pthread*> free_threads;
     std::list<Pthread*> gc_list;
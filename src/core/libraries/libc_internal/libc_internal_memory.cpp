@@ -3,21 +3,36 @@
 
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "core/debug_state.h"
 #include "core/libraries/error_codes.h"
 #include "core/libraries/libs.h"
 #include "libc_internal_memory.h"
 
 namespace Libraries::LibcInternal {
 
+// The host CRT routines below are already runtime-dispatched to the widest
+// available vector ISA (including non-temporal stores for large sizes), so the
+// only thing worth adding here is telemetry: when enabled from the devtools
+// memop profiler, record the size distribution so wins can be verified.
+
 void* PS4_SYSV_ABI internal_memset(void* s, int c, size_t n) {
+    if (DebugState.IsMemopProfilingEnabled()) [[unlikely]] {
+        DebugState.RecordGuestMemset(n);
+    }
     return std::memset(s, c, n);
 }
 
 void* PS4_SYSV_ABI internal_memcpy(void* dest, const void* src, size_t n) {
+    if (DebugState.IsMemopProfilingEnabled()) [[unlikely]] {
+        DebugState.RecordGuestMemcpy(n);
+    }
     return std::memcpy(dest, src, n);
 }
 
 s32 PS4_SYSV_ABI internal_memcpy_s(void* dest, size_t destsz, const void* src, size_t count) {
+    if (DebugState.IsMemopProfilingEnabled()) [[unlikely]] {
+        DebugState.RecordGuestMemcpy(count);
+    }
 #ifdef _WIN64
     return memcpy_s(dest, destsz, src, count);
 #else
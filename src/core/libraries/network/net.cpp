@@ -11,6 +11,7 @@
 #endif
 
 #include <core/libraries/kernel/kernel.h>
+#include <boost/container/small_vector.hpp>
 #include <magic_enum/magic_enum.hpp>
 #include "common/assert.h"
 #include "common/error.h"
@@ -615,8 +616,15 @@ int PS4_SYSV_ABI sceNetDuplicateIpStop() {
     return ORBIS_OK;
 }
 
-int PS4_SYSV_ABI sceNetEpollAbort() {
-    LOG_ERROR(Lib_Net, "(STUBBED) called");
+int PS4_SYSV_ABI sceNetEpollAbort(OrbisNetId epollid, int flags) {
+    auto file = FDTable::Instance()->GetEpoll(epollid);
+    if (!file) {
+        *sceNetErrnoLoc() = ORBIS_NET_EBADF;
+        return ORBIS_NET_ERROR_EBADF;
+    }
+    LOG_DEBUG(Lib_Net, "called, epollid = {} ({}), flags = {}", epollid, file->epoll->name, flags);
+
+    file->epoll->Wake();
     return ORBIS_OK;
 }
 
@@ -785,6 +793,10 @@ int PS4_SYSV_ABI sceNetEpollCreate(const char* name, int flags) {
     }
 
     auto fd = FDTable::Instance()->CreateHandle();
+    if (fd < 0) {
+        *sceNetErrnoLoc() = ORBIS_NET_EMFILE;
+        return ORBIS_NET_ERROR_EMFILE;
+    }
     auto* epoll = FDTable::Instance()->GetFile(fd);
     epoll->is_opened = true;
     epoll->type = Core::FileSys::FileType::Epoll;
@@ -821,7 +833,9 @@ int PS4_SYSV_ABI sceNetEpollWait(OrbisNetId epollid, OrbisNetEpollEvent* events,
 
     int sockets_waited_on = (epoll->events.size() - epoll->async_resolutions.size()) > 0;
 
-    std::vector<epoll_event> native_events{static_cast<size_t>(maxevents)};
+    // Waits are frequent on multiplayer titles; keep typical event counts off
+    // the heap.
+    boost::container::small_vector<epoll_event, 16> native_events(static_cast<size_t>(maxevents));
     int result = ORBIS_OK;
     if (sockets_waited_on) {
 #ifdef __linux__
@@ -836,6 +850,7 @@ int PS4_SYSV_ABI sceNetEpollWait(OrbisNetId epollid, OrbisNetEpollEvent* events,
     }
 
     int i = 0;
+    bool aborted = false;
 
     if (result < 0) {
         LOG_ERROR(Lib_Net, "epoll_wait failed with {}", Common::GetLastErrorMsg());
@@ -856,10 +871,16 @@ int PS4_SYSV_ABI sceNetEpollWait(OrbisNetId epollid, OrbisNetEpollEvent* events,
     } else if (result == 0) {
         LOG_TRACE(Lib_Net, "timed out");
     } else {
-        for (; i < result; ++i) {
-            const auto& current_event = native_events[i];
-            LOG_DEBUG(Lib_Net, "native_event[{}] = ( .events = {}, .data = {:#x} )", i,
+        for (int n = 0; n < result; ++n) {
+            const auto& current_event = native_events[n];
+            LOG_DEBUG(Lib_Net, "native_event[{}] = ( .events = {}, .data = {:#x} )", n,
                       current_event.events, current_event.data.u64);
+            if (current_event.data.fd == Epoll::WakeupMarker) {
+                // sceNetEpollAbort released this wait.
+                epoll->DrainWakeup();
+                aborted = true;
+                continue;
+            }
             const auto it = std::ranges::find_if(
                 epoll->events, [&](auto& el) { return el.first == current_event.data.fd; });
             ASSERT(it != epoll->events.end());
@@ -870,9 +891,15 @@ int PS4_SYSV_ABI sceNetEpollWait(OrbisNetId epollid, OrbisNetEpollEvent* events,
             };
             LOG_DEBUG(Lib_Net, "event[{}] = ( .events = {:#x}, .ident = {}, .data = {:#x} )", i,
                       events[i].events, events[i].ident, events[i].data.data_u64);
+            ++i;
         }
     }
 
+    if (aborted && i == 0) {
+        *sceNetErrnoLoc() = ORBIS_NET_EINTR;
+        return ORBIS_NET_ERROR_EINTR;
+    }
+
     if (result >= 0) {
         while (!epoll->async_resolutions.empty()) {
             if (i == maxevents) {
@@ -1392,6 +1419,10 @@ int PS4_SYSV_ABI sceNetResolverCreate(const char* name, int poolid, int flags) {
     }
 
     auto fd = FDTable::Instance()->CreateHandle();
+    if (fd < 0) {
+        *sceNetErrnoLoc() = ORBIS_NET_EMFILE;
+        return ORBIS_NET_ERROR_EMFILE;
+    }
     auto* resolver = FDTable::Instance()->GetFile(fd);
     resolver->is_opened = true;
     resolver->type = Core::FileSys::FileType::Resolver;
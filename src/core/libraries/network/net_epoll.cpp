@@ -39,6 +39,42 @@ u32 ConvertEpollEventsOut(u32 epoll_events) {
     return ret;
 }
 
+void Epoll::SetupWakeup() {
+    wakeup_rx = socket(AF_INET, SOCK_DGRAM, 0);
+    wakeup_tx = socket(AF_INET, SOCK_DGRAM, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    ASSERT(bind(wakeup_rx, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+    socklen_t addr_len = sizeof(addr);
+    ASSERT(getsockname(wakeup_rx, reinterpret_cast<sockaddr*>(&addr), &addr_len) == 0);
+    ASSERT(connect(wakeup_tx, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+
+#ifdef _WIN32
+    u_long non_blocking = 1;
+    ioctlsocket(wakeup_rx, FIONBIO, &non_blocking);
+#else
+    int non_blocking = 1;
+    ioctl(wakeup_rx, FIONBIO, &non_blocking);
+#endif
+
+    epoll_event wakeup_event = {.events = EPOLLIN, .data = {.fd = WakeupMarker}};
+    ASSERT(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_rx, &wakeup_event) == 0);
+}
+
+void Epoll::Wake() {
+    const char byte = 0;
+    send(wakeup_tx, &byte, sizeof(byte), 0);
+}
+
+void Epoll::DrainWakeup() {
+    char buf[8];
+    while (recv(wakeup_rx, buf, sizeof(buf), 0) > 0) {
+    }
+}
+
 int EpollTable::CreateHandle(const char* name) {
     std::scoped_lock lock{m_mutex};
 
@@ -5,6 +5,7 @@
 
 #include "common/types.h"
 #include "core/libraries/network/net.h"
+#include "core/libraries/network/sockets.h"
 
 #include <deque>
 #include <mutex>
@@ -28,6 +29,10 @@ using epoll_handle = int;
 #endif
 
 struct Epoll {
+    // Sentinel in epoll_data.fd for the internal wakeup socket; guest net ids
+    // are never negative.
+    static constexpr int WakeupMarker = -2;
+
     std::vector<std::pair<u32 /*netId*/, OrbisNetEpollEvent>> events{};
     std::string name;
     epoll_handle epoll_fd;
@@ -42,6 +47,7 @@ struct Epoll {
         if (name_ == nullptr) {
             name = "anon";
         }
+        SetupWakeup();
     }
 
     bool Destroyed() const noexcept {
@@ -53,15 +59,32 @@ struct Epoll {
 #ifdef _WIN32
         epoll_close(epoll_fd);
         epoll_fd = nullptr;
+        closesocket(wakeup_rx);
+        closesocket(wakeup_tx);
 #else
         close(epoll_fd);
         epoll_fd = -1;
+        close(wakeup_rx);
+        close(wakeup_tx);
 #endif
         name = "";
         destroyed = true;
     }
 
+    /// Wakes a thread blocked in sceNetEpollWait (used by sceNetEpollAbort).
+    void Wake();
+
+    /// Consumes pending wakeup datagrams after the waiter has been released.
+    void DrainWakeup();
+
 private:
+    void SetupWakeup();
+
+    // Loopback datagram pair registered in the epoll set so aborts can
+    // interrupt a blocked wait; a plain socket is the only object both epoll
+    // and wepoll can watch on every platform we build for.
+    net_socket wakeup_rx{};
+    net_socket wakeup_tx{};
     bool destroyed{};
 };
 
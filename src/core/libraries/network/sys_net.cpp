@@ -72,6 +72,11 @@ int PS4_SYSV_ABI sys_accept(OrbisNetId s, OrbisNetSockaddr* addr, u32* paddrlen)
         return -1;
     }
     auto fd = FDTable::Instance()->CreateHandle();
+    if (fd < 0) {
+        new_sock->Close();
+        *Libraries::Kernel::__Error() = ORBIS_NET_EMFILE;
+        return -1;
+    }
     auto* new_file = FDTable::Instance()->GetFile(fd);
     new_file->is_opened = true;
     new_file->type = Core::FileSys::FileType::Socket;
@@ -223,6 +228,10 @@ int PS4_SYSV_ABI sys_socketex(const char* name, int family, int type, int protoc
     }
 
     auto fd = FDTable::Instance()->CreateHandle();
+    if (fd < 0) {
+        *Libraries::Kernel::__Error() = ORBIS_NET_EMFILE;
+        return -1;
+    }
     auto* sock = FDTable::Instance()->GetFile(fd);
     sock->is_opened = true;
     sock->type = Core::FileSys::FileType::Socket;
@@ -312,7 +321,16 @@ int PS4_SYSV_ABI sys_socketpair(int family, int type, int protocol, int sv[2]) {
     }
 
     auto fd1 = FDTable::Instance()->CreateHandle();
+    if (fd1 < 0) {
+        *Libraries::Kernel::__Error() = ORBIS_NET_EMFILE;
+        return -1;
+    }
     auto fd2 = FDTable::Instance()->CreateHandle();
+    if (fd2 < 0) {
+        FDTable::Instance()->DeleteHandle(fd1);
+        *Libraries::Kernel::__Error() = ORBIS_NET_EMFILE;
+        return -1;
+    }
     auto* sock = FDTable::Instance()->GetFile(fd1);
     sock->is_opened = true;
     sock->type = Core::FileSys::FileType::Socket;
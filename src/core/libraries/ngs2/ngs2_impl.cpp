@@ -1,6 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngs2.h"
 #include "ngs2_error.h"
 #include "ngs2_impl.h"
 
@@ -12,6 +17,145 @@ using namespace Libraries::Kernel;
 
 namespace Libraries::Ngs2 {
 
+// Handle registry. Handles are opaque to the guest, so they are simply
+// allocated from a counter; the dummy system handle from SystemSetupCore
+// stays at 1 for compatibility with existing callers.
+static std::mutex registry_mutex;
+static std::unordered_map<OrbisNgs2Handle, std::unique_ptr<RackInternal>> rack_registry;
+static std::unordered_map<OrbisNgs2Handle, VoiceInternal*> voice_registry;
+static OrbisNgs2Handle next_handle = 0x100;
+
+s32 RackSetup(OrbisNgs2Handle systemHandle, u32 rackId, const OrbisNgs2RackOption* option,
+              OrbisNgs2Handle* outHandle) {
+    u32 max_voices = 64;
+    u32 max_grain_samples = 512;
+
+    if (option) {
+        if (option->maxVoices == 0) {
+            LOG_ERROR(Lib_Ngs2, "Invalid rack option (maxVoices=0)");
+            return ORBIS_NGS2_ERROR_INVALID_MAX_VOICES;
+        }
+        max_voices = option->maxVoices;
+        if (option->maxGrainSamples != 0) {
+            max_grain_samples = option->maxGrainSamples;
+        }
+    }
+
+    auto rack = std::make_unique<RackInternal>();
+    rack->systemHandle = systemHandle;
+    rack->rackId = rackId;
+    rack->maxVoices = max_voices;
+    rack->maxGrainSamples = max_grain_samples;
+    if (option) {
+        std::memcpy(rack->name, option->name, ORBIS_NGS2_RACK_NAME_LENGTH);
+    }
+    // The voice vector is sized once and never reallocated, so the registry
+    // can hold stable pointers into it.
+    rack->voices.resize(max_voices);
+
+    std::scoped_lock lock{registry_mutex};
+    const OrbisNgs2Handle rack_handle = next_handle++;
+    for (u32 i = 0; i < max_voices; i++) {
+        rack->voices[i].rack = rack.get();
+        rack->voices[i].voiceId = i;
+        voice_registry.emplace(next_handle++, &rack->voices[i]);
+    }
+    rack_registry.emplace(rack_handle, std::move(rack));
+
+    if (outHandle) {
+        *outHandle = rack_handle;
+    }
+    return ORBIS_OK;
+}
+
+s32 RackCleanup(OrbisNgs2Handle rackHandle, OrbisNgs2ContextBufferInfo* outInfo) {
+    std::scoped_lock lock{registry_mutex};
+    const auto it = rack_registry.find(rackHandle);
+    if (it == rack_registry.end()) {
+        return HandleReportInvalid(rackHandle, 2);
+    }
+    std::erase_if(voice_registry,
+                  [rack = it->second.get()](const auto& entry) { return entry.second->rack == rack; });
+    rack_registry.erase(it);
+    return ORBIS_OK;
+}
+
+s32 RackGetVoice(OrbisNgs2Handle rackHandle, u32 voiceIndex, OrbisNgs2Handle* outHandle) {
+    std::scoped_lock lock{registry_mutex};
+    const auto it = rack_registry.find(rackHandle);
+    if (it == rack_registry.end()) {
+        return HandleReportInvalid(rackHandle, 2);
+    }
+    if (voiceIndex >= it->second->maxVoices) {
+        LOG_ERROR(Lib_Ngs2, "Invalid voice index {} (maxVoices={})", voiceIndex,
+                  it->second->maxVoices);
+        return ORBIS_NGS2_ERROR_INVALID_VOICE_INDEX;
+    }
+    // Voice handles are allocated contiguously right after the rack handle.
+    if (outHandle) {
+        *outHandle = rackHandle + 1 + voiceIndex;
+    }
+    return ORBIS_OK;
+}
+
+s32 VoiceControlImpl(OrbisNgs2Handle voiceHandle, const OrbisNgs2VoiceParamHeader* paramList) {
+    {
+        std::scoped_lock lock{registry_mutex};
+        if (!voice_registry.contains(voiceHandle)) {
+            return HandleReportInvalid(voiceHandle, 4);
+        }
+    }
+    if (!paramList) {
+        return ORBIS_NGS2_ERROR_INVALID_VOICE_CONTROL_ADDRESS;
+    }
+
+    // Walk the parameter chain. The codec-specific parameter semantics are
+    // not implemented yet; validating the chain still catches malformed
+    // lists and keeps titles that poll control results running.
+    const auto* param = paramList;
+    while (true) {
+        if (param->size < sizeof(OrbisNgs2VoiceParamHeader)) {
+            LOG_ERROR(Lib_Ngs2, "Invalid voice control size {}", param->size);
+            return ORBIS_NGS2_ERROR_INVALID_VOICE_CONTROL_SIZE;
+        }
+        LOG_TRACE(Lib_Ngs2, "Voice {} control id = {:#x}, size = {}", voiceHandle, param->id,
+                  param->size);
+        if (param->next == 0) {
+            break;
+        }
+        param = reinterpret_cast<const OrbisNgs2VoiceParamHeader*>(
+            reinterpret_cast<const u8*>(param) + param->next);
+    }
+    return ORBIS_OK;
+}
+
+s32 SystemRenderImpl(OrbisNgs2Handle systemHandle, const OrbisNgs2RenderBufferInfo* aBufferInfo,
+                     u32 numBufferInfo) {
+    if (!aBufferInfo || numBufferInfo == 0) {
+        LOG_ERROR(Lib_Ngs2, "Invalid render buffer info {}", (void*)aBufferInfo);
+        return ORBIS_NGS2_ERROR_INVALID_BUFFER_INFO;
+    }
+
+    // No voices produce samples yet, so a render pass is silence; clearing
+    // the buffers instead of leaving them untouched keeps titles that reuse
+    // the memory from replaying stale data.
+    for (u32 i = 0; i < numBufferInfo; i++) {
+        if (!aBufferInfo[i].buffer) {
+            LOG_ERROR(Lib_Ngs2, "Invalid render buffer address (index={})", i);
+            return ORBIS_NGS2_ERROR_INVALID_BUFFER_ADDRESS;
+        }
+        std::memset(aBufferInfo[i].buffer, 0, aBufferInfo[i].bufferSize);
+    }
+
+    std::scoped_lock lock{registry_mutex};
+    for (auto& [handle, rack] : rack_registry) {
+        if (rack->systemHandle == systemHandle) {
+            rack->renderCount++;
+        }
+    }
+    return ORBIS_OK;
+}
+
 s32 HandleReportInvalid(OrbisNgs2Handle handle, u32 handleType) {
     switch (handleType) {
     case 1:
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "core/libraries/kernel/threads/pthread.h"
 
 namespace Libraries::Ngs2 {
@@ -164,6 +167,38 @@ struct HandleInternal {
     u32 handleID;               // 28
 };
 
+struct OrbisNgs2RackOption;
+struct OrbisNgs2RenderBufferInfo;
+struct OrbisNgs2VoiceParamHeader;
+struct OrbisNgs2RackInfo;
+
+/// A single voice slot of a rack. Voice rendering proper needs the
+/// codec-specific control parameters, so for now only the handle identity
+/// and state flags are tracked.
+struct VoiceInternal {
+    struct RackInternal* rack = nullptr;
+    u32 voiceId = 0;
+    u32 stateFlags = 0;
+};
+
+struct RackInternal {
+    char name[ORBIS_NGS2_RACK_NAME_LENGTH]{};
+    OrbisNgs2Handle systemHandle = 0;
+    u32 rackId = 0;
+    u32 maxVoices = 0;
+    u32 maxGrainSamples = 0;
+    u64 renderCount = 0;
+    std::vector<VoiceInternal> voices;
+};
+
+s32 RackSetup(OrbisNgs2Handle systemHandle, u32 rackId, const OrbisNgs2RackOption* option,
+              OrbisNgs2Handle* outHandle);
+s32 RackCleanup(OrbisNgs2Handle rackHandle, OrbisNgs2ContextBufferInfo* outInfo);
+s32 RackGetVoice(OrbisNgs2Handle rackHandle, u32 voiceIndex, OrbisNgs2Handle* outHandle);
+s32 VoiceControlImpl(OrbisNgs2Handle voiceHandle, const OrbisNgs2VoiceParamHeader* paramList);
+s32 SystemRenderImpl(OrbisNgs2Handle systemHandle, const OrbisNgs2RenderBufferInfo* aBufferInfo,
+                     u32 numBufferInfo);
+
 s32 StackBufferClose(StackBuffer* stackBuffer, size_t* outTotalSize);
 s32 StackBufferOpen(StackBuffer* stackBuffer, void* buffer, size_t bufferSize, void** outBuffer,
                     u8 flags);
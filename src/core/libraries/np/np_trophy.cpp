@@ -1,12 +1,16 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
 #include <unordered_map>
 #include <pugixml.hpp>
 
 #include "common/logging/log.h"
 #include "common/path_util.h"
+#include "common/singleton.h"
 #include "common/slot_vector.h"
+#include "core/file_format/trp.h"
+#include "core/file_sys/fs.h"
 #include "core/libraries/libs.h"
 #include "core/libraries/np/np_error.h"
 #include "core/libraries/np/np_trophy.h"
@@ -35,6 +39,19 @@ static Common::SlotVector<OrbisNpTrophyHandle> trophy_handles{};
 static Common::SlotVector<ContextKey> trophy_contexts{};
 static std::unordered_map<ContextKey, TrophyContext, ContextKeyHash> contexts_internal{};
 
+// Boot only extracts the trophy definitions from the TRP; the icons are
+// backfilled here the first time something actually displays one.
+static void EnsureIconsExtracted() {
+    static std::once_flag flag;
+    std::call_once(flag, [] {
+        auto* mnt = Common::Singleton<Core::FileSys::MntPoints>::Instance();
+        TRP trp;
+        if (!trp.ExtractIcons(mnt->GetHostPath("/app0"), game_serial)) {
+            LOG_ERROR(Lib_NpTrophy, "Couldn't extract trophy icons");
+        }
+    });
+}
+
 void ORBIS_NP_TROPHY_FLAG_ZERO(OrbisNpTrophyFlagArray* p) {
     for (int i = 0; i < ORBIS_NP_TROPHY_NUM_MAX; i++) {
         uint32_t array_index = i / 32;
@@ -245,6 +262,8 @@ int PS4_SYSV_ABI sceNpTrophyGetGameIcon(OrbisNpTrophyContext context, OrbisNpTro
                                         void* buffer, u64* size) {
     ASSERT(size != nullptr);
 
+    EnsureIconsExtracted();
+
     Common::SlotId contextId;
     contextId.index = context - 1;
     if (contextId.index >= trophy_contexts.size()) {
@@ -946,6 +965,9 @@ int PS4_SYSV_ABI sceNpTrophyUnlockTrophy(OrbisNpTrophyContext context, OrbisNpTr
                                          OrbisNpTrophyId trophyId, OrbisNpTrophyId* platinumId) {
     LOG_INFO(Lib_NpTrophy, "Unlocking trophy id {}", trophyId);
 
+    // The popup reads the trophy icon straight from disk
+    EnsureIconsExtracted();
+
     if (context == ORBIS_NP_TROPHY_INVALID_CONTEXT)
         return ORBIS_NP_TROPHY_ERROR_INVALID_CONTEXT;
 
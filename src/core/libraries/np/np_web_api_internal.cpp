@@ -1,8 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <atomic>
+
 #include "common/config.h"
 #include "common/elf_info.h"
+#include "common/task_scheduler.h"
 #include "core/libraries/kernel/process.h"
 #include "core/libraries/kernel/time.h"
 #include "core/libraries/network/http.h"
@@ -23,6 +26,7 @@ static s32 g_extended_push_event_filter_count = 0;
 static s32 g_registered_callback_count = 0;
 static s64 g_request_count = 0;
 static u64 g_last_timeout_check = 0;
+static std::atomic<bool> g_timeout_check_pending = false;
 static s32 g_sdk_ver = 0;
 
 s32 initializeLibrary() {
@@ -140,11 +144,25 @@ void checkTimeout() {
         return;
     }
     g_last_timeout_check = time;
-    std::scoped_lock lk{g_global_mutex};
 
-    for (auto& context : g_contexts) {
-        checkContextTimeout(context.second);
+    // The sweep walks every context, user context and request under the global lock;
+    // titles call this from their main loop, so only the rate limiter runs on the guest
+    // thread and the walk itself goes to the shared pool. The pending flag keeps sweeps
+    // from piling up when the workers lag behind the call rate.
+    if (g_timeout_check_pending.exchange(true, std::memory_order_acq_rel)) {
+        return;
     }
+    Common::TaskScheduler::Instance().Submit(
+        [] {
+            {
+                std::scoped_lock lk{g_global_mutex};
+                for (auto& context : g_contexts) {
+                    checkContextTimeout(context.second);
+                }
+            }
+            g_timeout_check_pending.store(false, std::memory_order_release);
+        },
+        Common::TaskPriority::Low);
 }
 
 s32 deleteContext(s32 libCtxId) {
@@ -1,14 +1,62 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #include "razor_cpu.h"
 
 #include "common/logging/log.h"
+#include "common/rdtsc.h"
+#include "common/trace_profiler.h"
 #include "core/libraries/error_codes.h"
 #include "core/libraries/libs.h"
 
 namespace Libraries::RazorCpu {
 
+namespace {
+
+struct OpenMarker {
+    const char* name;
+    u64 start;
+};
+
+// Guest marker strings may be freed before a trace is exported, so the names
+// are interned into a stable pool. Only touched while capturing.
+const char* InternMarkerName(const char* name) {
+    static std::mutex mutex;
+    static std::unordered_set<std::string> names;
+    std::scoped_lock lk{mutex};
+    return names.emplace(name).first->c_str();
+}
+
+// Per-thread stack of open guest markers. Pushes while capturing is off record
+// a sentinel so pops stay balanced across enable/disable transitions.
+thread_local std::vector<OpenMarker> marker_stack;
+
+void PushGuestMarker(const char* label) {
+    if (!Common::Profiler::IsEnabled() || label == nullptr) {
+        marker_stack.emplace_back(nullptr, 0);
+        return;
+    }
+    marker_stack.emplace_back(InternMarkerName(label), Common::FencedRDTSC());
+}
+
+void PopGuestMarker() {
+    if (marker_stack.empty()) {
+        return;
+    }
+    const OpenMarker marker = marker_stack.back();
+    marker_stack.pop_back();
+    if (marker.start != 0) {
+        Common::Profiler::RecordZone(marker.name, marker.start, Common::FencedRDTSC());
+    }
+}
+
+} // namespace
+
 s32 PS4_SYSV_ABI sceRazorCpuBeginLogicalFileAccess() {
     LOG_DEBUG(Lib_RazorCpu, "(STUBBED) called");
     return ORBIS_OK;
@@ -64,8 +112,7 @@ s32 PS4_SYSV_ABI sceRazorCpuInitializeInternal() {
 }
 
 bool PS4_SYSV_ABI sceRazorCpuIsCapturing() {
-    LOG_DEBUG(Lib_RazorCpu, "(STUBBED) called");
-    return false;
+    return Common::Profiler::IsEnabled();
 }
 
 s32 PS4_SYSV_ABI sceRazorCpuJobManagerDispatch() {
@@ -94,17 +141,17 @@ s32 PS4_SYSV_ABI sceRazorCpuPlotValue() {
 }
 
 s32 PS4_SYSV_ABI sceRazorCpuPopMarker() {
-    LOG_DEBUG(Lib_RazorCpu, "(STUBBED) called");
+    PopGuestMarker();
     return ORBIS_OK;
 }
 
-s32 PS4_SYSV_ABI sceRazorCpuPushMarker() {
-    LOG_DEBUG(Lib_RazorCpu, "(STUBBED) called");
+s32 PS4_SYSV_ABI sceRazorCpuPushMarker(const char* label, u32 color, u32 flags) {
+    PushGuestMarker(label);
     return ORBIS_OK;
 }
 
-s32 PS4_SYSV_ABI sceRazorCpuPushMarkerStatic() {
-    LOG_DEBUG(Lib_RazorCpu, "(STUBBED) called");
+s32 PS4_SYSV_ABI sceRazorCpuPushMarkerStatic(const char* label, u32 color, u32 flags) {
+    PushGuestMarker(label);
     return ORBIS_OK;
 }
 
@@ -96,7 +96,7 @@ SaveDialogState::SaveDialogState(const OrbisSaveDataDialogParam& param) {
             }
 
             PSF param_sfo;
-            param_sfo.Open(param_sfo_path);
+            SaveInstance::OpenCachedParamSFO(param_sfo, param_sfo_path);
 
             auto last_write = std::chrono::system_clock::to_time_t(param_sfo.GetLastWrite());
             std::string date_str = fmt::format("{:%d %b, %Y %R}", *std::localtime(&last_write));
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 
 #include <magic_enum/magic_enum.hpp>
 
@@ -69,6 +71,30 @@ fs::path SaveInstance::GetParamSFOPath(const fs::path& dir_path) {
     return dir_path / sce_sys / "param.sfo";
 }
 
+bool SaveInstance::OpenCachedParamSFO(PSF& out, const fs::path& sfo_path) {
+    static std::mutex cache_mtx;
+    static std::unordered_map<std::string, std::pair<fs::file_time_type, PSF>> cache;
+
+    std::error_code ec;
+    const auto mtime = fs::last_write_time(sfo_path, ec);
+    auto key = Common::FS::PathToUTF8String(sfo_path);
+
+    std::scoped_lock lk{cache_mtx};
+    if (!ec) {
+        if (const auto it = cache.find(key); it != cache.end() && it->second.first == mtime) {
+            out = it->second.second;
+            return true;
+        }
+    }
+    if (!out.Open(sfo_path)) {
+        return false;
+    }
+    if (!ec) {
+        cache.insert_or_assign(std::move(key), std::make_pair(mtime, out));
+    }
+    return true;
+}
+
 void SaveInstance::SetupDefaultParamSFO(PSF& param_sfo, std::string dir_name,
                                         std::string game_serial) {
     int locale = Config::GetLanguage();
@@ -66,6 +66,10 @@ public:
     // Get param.sfo path from a dir_path generated by MakeDirSavePath
     static std::filesystem::path GetParamSFOPath(const std::filesystem::path& dir_path);
 
+    // Parse a param.sfo through a cache keyed by modification time, skipping
+    // the file read and reparse when it hasn't changed since the last call
+    static bool OpenCachedParamSFO(PSF& out, const std::filesystem::path& sfo_path);
+
     static void SetupDefaultParamSFO(PSF& param_sfo, std::string dir_name, std::string game_serial);
 
     explicit SaveInstance(int slot_num, Libraries::UserService::OrbisUserServiceUserId user_id,
@@ -3,9 +3,12 @@
 
 #include "save_memory.h"
 
+#include <algorithm>
 #include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <utility>
 #include <fmt/format.h>
@@ -14,6 +17,7 @@
 #include "common/elf_info.h"
 #include "common/logging/log.h"
 #include "common/path_util.h"
+#include "common/polyfill_thread.h"
 #include "common/singleton.h"
 #include "common/thread.h"
 #include "core/file_sys/fs.h"
@@ -45,13 +49,11 @@ struct SlotData {
 static std::mutex g_slot_mtx;
 static std::unordered_map<u32, SlotData> g_attached_slots;
 
-void PersistMemory(u32 slot_id, bool lock) {
-    std::unique_lock lck{g_slot_mtx, std::defer_lock};
-    if (lock) {
-        lck.lock();
-    }
-    auto& data = g_attached_slots[slot_id];
-    auto memoryPath = data.folder_path / FilenameSaveDataMemory;
+static std::jthread g_flush_thread;
+static std::condition_variable_any g_flush_cv;
+static std::deque<u32> g_dirty_slots; // guarded by g_slot_mtx
+
+static void WriteMemoryFile(const fs::path& memoryPath, std::span<const u8> memory) {
     fs::create_directories(memoryPath.parent_path());
 
     int n = 0;
@@ -61,7 +63,7 @@ void PersistMemory(u32 slot_id, bool lock) {
             IOFile f;
             int r = f.Open(memoryPath, Common::FS::FileAccessMode::Create);
             if (f.IsOpen()) {
-                f.WriteRaw<u8>(data.memory_cache.data(), data.memory_cache.size());
+                f.WriteRaw<u8>(memory.data(), memory.size());
                 f.Close();
                 return;
             }
@@ -80,6 +82,63 @@ void PersistMemory(u32 slot_id, bool lock) {
     MsgDialog::ShowMsgDialog(dialog);
 }
 
+static void FlushThreadBody(std::stop_token stoken) {
+    Common::SetCurrentThreadName("shadPS4:SaveData:MemoryFlushThread");
+    while (true) {
+        u32 slot_id;
+        std::vector<u8> snapshot;
+        fs::path memory_path;
+        OrbisUserServiceUserId user_id;
+        std::string game_serial;
+        {
+            std::unique_lock lk{g_slot_mtx};
+            if (!g_flush_cv.wait(lk, stoken, [] { return !g_dirty_slots.empty(); })) {
+                break; // Stop requested and nothing left to flush
+            }
+            slot_id = g_dirty_slots.front();
+            g_dirty_slots.pop_front();
+
+            // Snapshot the cache so the guest can keep writing while the file
+            // is flushed; later writes just mark the slot dirty again.
+            auto& data = g_attached_slots[slot_id];
+            snapshot = data.memory_cache;
+            memory_path = data.folder_path / FilenameSaveDataMemory;
+            user_id = data.user_id;
+            game_serial = data.game_serial;
+        }
+        WriteMemoryFile(memory_path, snapshot);
+        Backup::NewRequest(user_id, game_serial, GetSaveDir(slot_id),
+                           Backup::OrbisSaveDataEventType::__DO_NOT_SAVE);
+    }
+}
+
+void StartFlushThread() {
+    if (g_flush_thread.joinable()) {
+        return;
+    }
+    LOG_DEBUG(Lib_SaveData, "Starting save memory flush thread");
+    g_flush_thread = std::jthread{FlushThreadBody};
+}
+
+void StopFlushThread() {
+    if (!g_flush_thread.joinable()) {
+        return;
+    }
+    LOG_DEBUG(Lib_SaveData, "Stopping save memory flush thread");
+    // The worker drains every dirty slot before exiting.
+    g_flush_thread.request_stop();
+    g_flush_thread.join();
+}
+
+void PersistMemory(u32 slot_id, bool lock) {
+    std::unique_lock lck{g_slot_mtx, std::defer_lock};
+    if (lock) {
+        lck.lock();
+    }
+    auto& data = g_attached_slots[slot_id];
+    WriteMemoryFile(data.folder_path / FilenameSaveDataMemory, data.memory_cache);
+}
+
 std::string GetSaveDir(u32 slot_id) {
     std::string dir(StandardDirnameSaveDataMemory);
     if (slot_id > 0) {
@@ -99,6 +158,8 @@ std::filesystem::path GetSavePath(Libraries::UserService::OrbisUserServiceUserId
 
 size_t SetupSaveMemory(Libraries::UserService::OrbisUserServiceUserId user_id, u32 slot_id,
                        std::string_view game_serial, size_t memory_size) {
+    StartFlushThread();
+
     std::lock_guard lck{g_slot_mtx};
 
     const auto save_dir = GetSavePath(user_id, slot_id, game_serial);
@@ -220,8 +281,13 @@ void WriteMemory(u32 slot_id, void* buf, size_t buf_size, int64_t offset) {
         memory.resize(offset + buf_size);
     }
     std::memcpy(memory.data() + offset, buf, buf_size);
-    PersistMemory(slot_id, false);
-    Backup::NewRequest(data.user_id, data.game_serial, GetSaveDir(slot_id),
-                       Backup::OrbisSaveDataEventType::__DO_NOT_SAVE);
+
+    // Persisting synchronously stalls the caller for a full rewrite of
+    // memory.dat per write; mark the slot dirty and let the flush thread
+    // snapshot it instead. Queued slots are only flushed once.
+    if (std::ranges::find(g_dirty_slots, slot_id) == g_dirty_slots.end()) {
+        g_dirty_slots.push_back(slot_id);
+    }
+    g_flush_cv.notify_one();
 }
 } // namespace Libraries::SaveData::SaveMemory
\ No newline at end of file
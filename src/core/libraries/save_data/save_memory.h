@@ -11,6 +11,13 @@ class PSF;
 
 namespace Libraries::SaveData::SaveMemory {
 
+// No problem calling this function if the flush thread is already running
+void StartFlushThread();
+
+// Drains every dirty slot before returning
+void StopFlushThread();
+
+// Write the slot to disk immediately on the calling thread
 void PersistMemory(u32 slot_id, bool lock = true);
 
 [[nodiscard]] std::string GetSaveDir(u32 slot_id);
@@ -825,7 +825,7 @@ Error PS4_SYSV_ABI sceSaveDataDirNameSearch(const OrbisSaveDataDirNameSearchCond
         const auto dir_path = SaveInstance::MakeDirSavePath(cond->userId, title_id, dir_name);
         const auto sfo_path = SaveInstance::GetParamSFOPath(dir_path);
         PSF sfo;
-        if (!sfo.Open(sfo_path)) {
+        if (!SaveInstance::OpenCachedParamSFO(sfo, sfo_path)) {
             LOG_ERROR(Lib_SaveData, "Failed to read SFO: {}", fmt::UTF(sfo_path.u8string()));
             ASSERT_MSG(false, "Failed to read SFO");
         }
@@ -1674,6 +1674,7 @@ Error PS4_SYSV_ABI sceSaveDataTerminate() {
         }
     }
     g_initialized = false;
+    SaveMemory::StopFlushThread();
     Backup::StopThread();
     return Error::OK;
 }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstdlib>
+#include "common/bounded_threadsafe_queue.h"
 #include "common/config.h"
 #include "common/logging/log.h"
 #include "common/singleton.h"
@@ -14,8 +15,11 @@
 namespace Libraries::SystemService {
 
 bool g_splash_status{true};
-std::queue<OrbisSystemServiceEvent> g_event_queue;
-std::mutex g_event_queue_mutex;
+// Titles poll sceSystemServiceReceiveEvent every frame, so the empty poll should be a
+// single atomic load rather than a mutex round trip, and producers (which fire from the
+// present and initialization paths) must not contend with it. Events are rare and the
+// ring only backs up when the title stops polling, so a small bound suffices.
+static Common::MPMCQueue<OrbisSystemServiceEvent, 16> g_event_queue;
 
 bool IsSplashVisible() {
     return Config::showSplash() && g_splash_status;
@@ -1779,8 +1783,7 @@ s32 PS4_SYSV_ABI sceSystemServiceGetStatus(OrbisSystemServiceStatus* status) {
         return ORBIS_SYSTEM_SERVICE_ERROR_PARAMETER;
     }
 
-    std::lock_guard<std::mutex> lock(g_event_queue_mutex);
-    status->event_num = static_cast<s32>(g_event_queue.size());
+    status->event_num = static_cast<s32>(g_event_queue.Size());
     status->is_system_ui_overlaid = false;
     status->is_in_background_execution = false;
     status->is_cpu_mode7_cpu_normal = true;
@@ -1967,13 +1970,9 @@ s32 PS4_SYSV_ABI sceSystemServiceReceiveEvent(OrbisSystemServiceEvent* event) {
         return ORBIS_SYSTEM_SERVICE_ERROR_PARAMETER;
     }
 
-    std::lock_guard<std::mutex> lock(g_event_queue_mutex);
-    if (g_event_queue.empty()) {
+    if (!g_event_queue.TryPop(*event)) {
         return ORBIS_SYSTEM_SERVICE_ERROR_NO_EVENT;
     }
-
-    *event = g_event_queue.front();
-    g_event_queue.pop();
     return ORBIS_OK;
 }
 
@@ -2443,8 +2442,12 @@ int PS4_SYSV_ABI Func_CB5E885E225F69F0() {
 }
 
 void PushSystemServiceEvent(const OrbisSystemServiceEvent& event) {
-    std::lock_guard<std::mutex> lock(g_event_queue_mutex);
-    g_event_queue.push(event);
+    if (!g_event_queue.TryEmplace(event)) {
+        // The ring only fills when the title has stopped polling; dropping is no worse
+        // than the event sitting in a queue nobody reads.
+        LOG_WARNING(Lib_SystemService, "Event queue full, dropping event type {}",
+                    static_cast<u32>(event.event_type));
+    }
 }
 
 void RegisterLib(Core::Loader::SymbolsResolver* sym) {
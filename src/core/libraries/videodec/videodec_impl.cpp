@@ -19,6 +19,19 @@ static inline void CopyNV12Data(u8* dst, const AVFrame& src) {
     std::memcpy(dst + src.width * height, src.data[1], (src.width * src.height) / 2);
 }
 
+// Picks the negotiated hardware pixel format when the decoder offers it;
+// FFmpeg falls back to a software format (and software decoding) otherwise.
+static AVPixelFormat GetHWFormat(AVCodecContext* context, const AVPixelFormat* formats) {
+    const auto hw_format = *reinterpret_cast<const int*>(context->opaque);
+    for (const AVPixelFormat* p = formats; *p != AV_PIX_FMT_NONE; ++p) {
+        if (*p == AVPixelFormat(hw_format)) {
+            return *p;
+        }
+    }
+    LOG_WARNING(Lib_Videodec, "Hardware pixel format unavailable, decoding in software");
+    return avcodec_default_get_format(context, formats);
+}
+
 VdecDecoder::VdecDecoder(const OrbisVideodecConfigInfo& pCfgInfoIn,
                          const OrbisVideodecResourceInfo& pRsrcInfoIn) {
 
@@ -30,12 +43,53 @@ VdecDecoder::VdecDecoder(const OrbisVideodecConfigInfo& pCfgInfoIn,
     mCodecContext->width = pCfgInfoIn.maxFrameWidth;
     mCodecContext->height = pCfgInfoIn.maxFrameHeight;
 
+    TrySetupHWDecoding(codec);
     avcodec_open2(mCodecContext, codec, nullptr);
 }
 
 VdecDecoder::~VdecDecoder() {
     avcodec_free_context(&mCodecContext);
     sws_freeContext(mSwsContext);
+    if (mHWDeviceContext != nullptr) {
+        av_buffer_unref(&mHWDeviceContext);
+    }
+}
+
+void VdecDecoder::TrySetupHWDecoding(const AVCodec* codec) {
+    for (int i = 0;; ++i) {
+        const auto config = avcodec_get_hw_config(codec, i);
+        if (config == nullptr) {
+            // No usable hardware configuration; stay on software decoding.
+            return;
+        }
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0) {
+            continue;
+        }
+        AVBufferRef* device_ctx = nullptr;
+        if (av_hwdevice_ctx_create(&device_ctx, config->device_type, nullptr, nullptr, 0) < 0) {
+            continue;
+        }
+        mHWDeviceContext = device_ctx;
+        mHWPixelFormat = config->pix_fmt;
+        mCodecContext->hw_device_ctx = av_buffer_ref(device_ctx);
+        mCodecContext->opaque = &mHWPixelFormat;
+        mCodecContext->get_format = &GetHWFormat;
+        LOG_INFO(Lib_Videodec, "Hardware video decoding enabled via {}",
+                 av_hwdevice_get_type_name(config->device_type));
+        return;
+    }
+}
+
+AVFrame* VdecDecoder::DownloadHWFrame(AVFrame& frame) {
+    AVFrame* sw_frame = av_frame_alloc();
+    const auto res = av_hwframe_transfer_data(sw_frame, &frame, 0);
+    if (res < 0) {
+        LOG_ERROR(Lib_Videodec, "Could not download hardware frame: {}", av_err2str(res));
+        av_frame_free(&sw_frame);
+        return nullptr;
+    }
+    av_frame_copy_props(sw_frame, &frame);
+    return sw_frame;
 }
 
 s32 VdecDecoder::Decode(const OrbisVideodecInputData& pInputDataIn,
@@ -88,6 +142,19 @@ s32 VdecDecoder::Decode(const OrbisVideodecInputData& pInputDataIn,
             return ORBIS_VIDEODEC_ERROR_API_FAIL;
         }
 
+        if (frame->format == mHWPixelFormat) {
+            // Download the hardware surface; decoders usually hand back NV12,
+            // which skips the conversion below entirely.
+            AVFrame* sw_frame = DownloadHWFrame(*frame);
+            if (!sw_frame) {
+                av_packet_free(&packet);
+                av_frame_free(&frame);
+                return ORBIS_VIDEODEC_ERROR_API_FAIL;
+            }
+            av_frame_free(&frame);
+            frame = sw_frame;
+        }
+
         if (frame->format != AV_PIX_FMT_NV12) {
             AVFrame* nv12_frame = ConvertNV12Frame(*frame);
             ASSERT(nv12_frame);
@@ -138,6 +205,18 @@ s32 VdecDecoder::Flush(OrbisVideodecFrameBuffer& pFrameBufferInOut,
             return ORBIS_VIDEODEC_ERROR_API_FAIL;
         }
 
+        if (frame->format == mHWPixelFormat) {
+            // Download the hardware surface; decoders usually hand back NV12,
+            // which skips the conversion below entirely.
+            AVFrame* sw_frame = DownloadHWFrame(*frame);
+            if (!sw_frame) {
+                av_frame_free(&frame);
+                return ORBIS_VIDEODEC_ERROR_API_FAIL;
+            }
+            av_frame_free(&frame);
+            frame = sw_frame;
+        }
+
         if (frame->format != AV_PIX_FMT_NV12) {
             AVFrame* nv12_frame = ConvertNV12Frame(*frame);
             ASSERT(nv12_frame);
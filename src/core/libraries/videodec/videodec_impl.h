@@ -9,6 +9,7 @@
 
 extern "C" {
 #include <libavcodec/avcodec.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/imgutils.h>
 #include <libswscale/swscale.h>
 }
@@ -28,11 +29,19 @@ public:
     s32 Reset();
 
 private:
+    void TrySetupHWDecoding(const AVCodec* codec);
+    AVFrame* DownloadHWFrame(AVFrame& frame);
     AVFrame* ConvertNV12Frame(AVFrame& frame);
 
 private:
     AVCodecContext* mCodecContext = nullptr;
     SwsContext* mSwsContext = nullptr;
+
+    // Hardware decode device shared with the codec context; unref'd in the destructor.
+    // mHWPixelFormat is the AVPixelFormat hardware frames come back in, or -1
+    // (AV_PIX_FMT_NONE) when decoding in software.
+    AVBufferRef* mHWDeviceContext = nullptr;
+    int mHWPixelFormat = AV_PIX_FMT_NONE;
 };
 
 } // namespace Libraries::Videodec
\ No newline at end of file
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <condition_variable>
 #include <mutex>
 #include <stop_token>
@@ -30,7 +31,10 @@ struct InflateResult {
     s32 status;
 };
 
-static Kernel::Thread task_thread;
+// Jobs write to independent destination buffers, so concurrent inflates are
+// safe; a small pool keeps 64KB chunk streams from serializing on one core.
+static constexpr u32 NumTaskThreads = 3;
+static std::array<Kernel::Thread, NumTaskThreads> task_threads;
 
 static std::mutex mutex;
 static std::queue<InflateTask> task_queue;
@@ -76,7 +80,7 @@ void ZlibTaskThread(const std::stop_token& stop) {
 
 s32 PS4_SYSV_ABI sceZlibInitialize(const void* buffer, u32 length) {
     LOG_INFO(Lib_Zlib, "called");
-    if (task_thread.Joinable()) {
+    if (task_threads.front().Joinable()) {
         return ORBIS_ZLIB_ERROR_ALREADY_INITIALIZED;
     }
 
@@ -86,14 +90,16 @@ s32 PS4_SYSV_ABI sceZlibInitialize(const void* buffer, u32 length) {
     results.clear();
     next_request_id = 1;
 
-    task_thread.Run([](const std::stop_token& stop) { ZlibTaskThread(stop); });
+    for (auto& thread : task_threads) {
+        thread.Run([](const std::stop_token& stop) { ZlibTaskThread(stop); });
+    }
     return ORBIS_OK;
 }
 
 s32 PS4_SYSV_ABI sceZlibInflate(const void* src, u32 src_len, void* dst, u32 dst_len,
                                 u64* request_id) {
     LOG_DEBUG(Lib_Zlib, "(STUBBED) called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads.front().Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
     if (!src || !src_len || !dst || !dst_len || !request_id || dst_len > 64_KB ||
@@ -118,7 +124,7 @@ s32 PS4_SYSV_ABI sceZlibInflate(const void* src, u32 src_len, void* dst, u32 dst
 
 s32 PS4_SYSV_ABI sceZlibWaitForDone(u64* request_id, const u32* timeout) {
     LOG_DEBUG(Lib_Zlib, "(STUBBED) called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads.front().Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
     if (!request_id) {
@@ -144,7 +150,7 @@ s32 PS4_SYSV_ABI sceZlibWaitForDone(u64* request_id, const u32* timeout) {
 
 s32 PS4_SYSV_ABI sceZlibGetResult(const u64 request_id, u32* dst_length, s32* status) {
     LOG_DEBUG(Lib_Zlib, "(STUBBED) called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads.front().Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
     if (!dst_length || !status) {
@@ -165,10 +171,12 @@ s32 PS4_SYSV_ABI sceZlibGetResult(const u64 request_id, u32* dst_length, s32* st
 
 s32 PS4_SYSV_ABI sceZlibFinalize() {
     LOG_INFO(Lib_Zlib, "called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads.front().Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
-    task_thread.Stop();
+    for (auto& thread : task_threads) {
+        thread.Stop();
+    }
     return ORBIS_OK;
 }
 
@@ -1,6 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "common/alignment.h"
 #include "common/arch.h"
 #include "common/assert.h"
@@ -213,8 +218,30 @@ Module* Linker::FindByAddress(VAddr address) {
 }
 
 void Linker::Relocate(Module* module) {
-    module->ForEachRelocation([&](elf_relocation* rel, u32 i, bool is_jmp_rel) {
-        const u32 num_relocs = module->dynamic_info.relocation_table_size / sizeof(elf_relocation);
+    const u32 num_relocs = module->dynamic_info.relocation_table_size / sizeof(elf_relocation);
+    const u32 num_jmp_relocs =
+        module->dynamic_info.jmp_relocation_table_size / sizeof(elf_relocation);
+
+    // Symbol resolution mutates global state (stub slots, the devtools module list) and the
+    // same name recurs across GLOB_DAT and JUMP_SLOT entries, so results are memoized under
+    // a lock. Everything else in an entry only touches that entry's target address and rela
+    // bit, which lets the tables be processed in parallel chunks; big eboots are dominated
+    // by R_X86_64_RELATIVE entries that never resolve symbols at all.
+    std::mutex resolve_mutex;
+    std::unordered_map<std::string, std::pair<bool, Loader::SymbolRecord>> resolved;
+    const auto resolve_memoized = [&](const std::string& name, Loader::SymbolType sym_type,
+                                      Loader::SymbolRecord* symrec) {
+        std::scoped_lock lk{resolve_mutex};
+        const auto [it, is_new] =
+            resolved.try_emplace(fmt::format("{}:{}", name, static_cast<u32>(sym_type)));
+        if (is_new) {
+            it->second.first = Resolve(name, sym_type, module, &it->second.second);
+        }
+        *symrec = it->second.second;
+        return it->second.first;
+    };
+
+    const auto patch_entry = [&](elf_relocation* rel, u32 i, bool is_jmp_rel) {
         const u32 bit_idx = (is_jmp_rel ? num_relocs : 0) + i;
         if (module->TestRelaBit(bit_idx)) {
             return;
@@ -280,7 +307,7 @@ void Linker::Relocate(Module* module) {
             case STB_GLOBAL:
             case STB_WEAK: {
                 rel_name = names_tlb + sym.st_name;
-                if (Resolve(rel_name, rel_sym_type, module, &symrec)) {
+                if (resolve_memoized(rel_name, rel_sym_type, &symrec)) {
                     // Only set the rela bit if the symbol was actually resolved and not stubbed.
                     module->SetRelaBit(bit_idx);
                 }
@@ -304,7 +331,35 @@ void Linker::Relocate(Module* module) {
         } else {
             LOG_INFO(Core_Linker, "Function not patched! {}", rel_name);
         }
-    });
+    };
+
+    const auto relocate_table = [&](elf_relocation* table, u32 count, bool is_jmp_rel) {
+        // Below this size the work does not outweigh thread startup.
+        constexpr u32 MinParallelRelocs = 4096;
+        constexpr u32 MaxWorkers = 8;
+        const u32 num_workers = std::min(std::thread::hardware_concurrency(), MaxWorkers);
+        if (count < MinParallelRelocs || num_workers < 2) {
+            for (u32 i = 0; i < count; i++) {
+                patch_entry(&table[i], i, is_jmp_rel);
+            }
+            return;
+        }
+        const u32 chunk_size = (count + num_workers - 1) / num_workers;
+        std::vector<std::jthread> workers;
+        workers.reserve(num_workers);
+        for (u32 begin = 0; begin < count; begin += chunk_size) {
+            const u32 end = std::min(begin + chunk_size, count);
+            workers.emplace_back([&, begin, end] {
+                for (u32 i = begin; i < end; i++) {
+                    patch_entry(&table[i], i, is_jmp_rel);
+                }
+            });
+        }
+        // The jthreads join on destruction, so each table is fully patched before the next.
+    };
+
+    relocate_table(module->dynamic_info.relocation_table, num_relocs, false);
+    relocate_table(module->dynamic_info.jmp_relocation_table, num_jmp_relocs, true);
 }
 
 const Module* Linker::FindExportedModule(const ModuleInfo& module, const LibraryInfo& library) {
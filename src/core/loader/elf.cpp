@@ -1,11 +1,20 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <bit>
+#include <cstring>
 #include <fmt/core.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/loader/elf.h"
 
+#ifdef _WIN64
+#include <windows.h>
+#else
+#include <cerrno>
+#include <sys/mman.h>
+#endif
+
 namespace Core::Loader {
 
 using namespace Common::FS;
@@ -176,7 +185,54 @@ static std::string_view GetMachine(e_machine_es machine) {
     }
 }
 
-Elf::~Elf() = default;
+Elf::~Elf() {
+    UnmapFile();
+}
+
+void Elf::MapFile() {
+    const u64 file_size = m_f.GetSize();
+    if (file_size == 0) {
+        return;
+    }
+#ifdef _WIN64
+    HANDLE hfile = std::bit_cast<HANDLE>(m_f.GetFileMapping());
+    HANDLE mapping = CreateFileMappingW(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        LOG_WARNING(Loader, "Failed to create image mapping, falling back to buffered reads");
+        return;
+    }
+    void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    // The view holds a reference on the mapping object, so the handle can go.
+    CloseHandle(mapping);
+    if (!ptr) {
+        LOG_WARNING(Loader, "Failed to map image view, falling back to buffered reads");
+        return;
+    }
+#else
+    const int fd = static_cast<int>(m_f.GetFileMapping());
+    void* ptr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr == MAP_FAILED) {
+        LOG_WARNING(Loader, "Failed to mmap image: {}, falling back to buffered reads",
+                    strerror(errno));
+        return;
+    }
+#endif
+    m_mapped = static_cast<const u8*>(ptr);
+    m_mapped_size = file_size;
+}
+
+void Elf::UnmapFile() {
+    if (!m_mapped) {
+        return;
+    }
+#ifdef _WIN64
+    UnmapViewOfFile(const_cast<u8*>(m_mapped));
+#else
+    munmap(const_cast<u8*>(m_mapped), m_mapped_size);
+#endif
+    m_mapped = nullptr;
+    m_mapped_size = 0;
+}
 
 void Elf::Open(const std::filesystem::path& file_name) {
     m_f.Open(file_name, FileAccessMode::Read);
@@ -229,6 +285,8 @@ void Elf::Open(const std::filesystem::path& file_name) {
             m_f.ReadObject(m_self_id_header);
         }
     }
+
+    MapFile();
 }
 
 bool Elf::IsSelfFile() const {
@@ -466,8 +524,21 @@ std::string Elf::ElfPHeaderStr(u16 no) {
 }
 
 void Elf::LoadSegment(u64 virtual_addr, u64 file_offset, u64 size) {
+    // Copy straight out of the mapped image when possible: no seeks or intermediate
+    // buffering, and the page cache serves cold reads with readahead.
+    const auto copy_from_image = [&](u64 offset) {
+        if (m_mapped && offset + size <= m_mapped_size) {
+            std::memcpy(reinterpret_cast<void*>(virtual_addr), m_mapped + offset, size);
+            return true;
+        }
+        return false;
+    };
+
     if (!is_self) {
         // It's elf file
+        if (copy_from_image(file_offset)) {
+            return;
+        }
         if (!m_f.Seek(file_offset, SeekOrigin::SetOrigin)) {
             LOG_CRITICAL(Loader, "Failed to seek to ELF header");
             return;
@@ -485,6 +556,9 @@ void Elf::LoadSegment(u64 virtual_addr, u64 file_offset, u64 size) {
 
             if (file_offset >= phdr.p_offset && file_offset < phdr.p_offset + phdr.p_filesz) {
                 auto offset = file_offset - phdr.p_offset;
+                if (copy_from_image(offset + seg.file_offset)) {
+                    return;
+                }
                 if (!m_f.Seek(offset + seg.file_offset, SeekOrigin::SetOrigin)) {
                     LOG_CRITICAL(Loader, "Failed to seek to segment");
                     return;
@@ -508,7 +508,14 @@ public:
     void PHeaderDebugDump(const std::filesystem::path& file_name);
 
 private:
+    void MapFile();
+    void UnmapFile();
+
     Common::FS::IOFile m_f{};
+    /// Read-only mapping of the whole image; segments are copied straight out of it.
+    /// Null when mapping failed, in which case buffered reads are used instead.
+    const u8* m_mapped{};
+    u64 m_mapped_size{};
     bool is_self{};
     self_header m_self{};
     std::vector<self_segment_header> m_self_segments;
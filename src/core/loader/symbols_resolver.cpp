@@ -12,6 +12,8 @@ namespace Core::Loader {
 
 void SymbolsResolver::AddSymbol(const SymbolResolver& s, u64 virtual_addr) {
     m_symbols.emplace_back(GenerateName(s), s.nidName, virtual_addr);
+    // First registration wins, matching the old first-match linear search.
+    m_name_index.try_emplace(m_symbols.back().name, m_symbols.size() - 1);
 }
 
 std::string SymbolsResolver::GenerateName(const SymbolResolver& s) {
@@ -21,10 +23,9 @@ std::string SymbolsResolver::GenerateName(const SymbolResolver& s) {
 
 const SymbolRecord* SymbolsResolver::FindSymbol(const SymbolResolver& s) const {
     const std::string name = GenerateName(s);
-    for (u32 i = 0; i < m_symbols.size(); i++) {
-        if (m_symbols[i].name == name) {
-            return &m_symbols[i];
-        }
+    const auto it = m_name_index.find(name);
+    if (it != m_name_index.end()) {
+        return &m_symbols[it->second];
     }
 
     // LOG_INFO(Core_Linker, "Unresolved! {}", name);
@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "common/assert.h"
 #include "common/types.h"
@@ -74,6 +75,8 @@ public:
 
 private:
     std::vector<SymbolRecord> m_symbols;
+    /// Generated name to m_symbols index, so imports resolve without a linear scan.
+    std::unordered_map<std::string, size_t> m_name_index;
 };
 
 } // namespace Core::Loader
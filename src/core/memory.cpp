@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/config.h"
@@ -660,6 +662,7 @@ s32 MemoryManager::MapMemory(void** out_addr, VAddr virtual_addr, u64 size, Memo
         }
     }
 
+    RecordMemoryEvent(true, mapped_addr, size, type);
     return ORBIS_OK;
 }
 
@@ -829,6 +832,16 @@ s32 MemoryManager::PoolDecommit(VAddr virtual_addr, u64 size) {
     return ORBIS_OK;
 }
 
+void MemoryManager::RecordMemoryEvent(bool is_map, VAddr virtual_addr, u64 size, VMAType type) {
+    static const auto epoch = std::chrono::steady_clock::now();
+    const u64 time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - epoch)
+                            .count();
+    std::scoped_lock lk{event_mutex};
+    memory_events[memory_event_count++ % NumMemoryEvents] = {
+        .time_us = time_us, .addr = virtual_addr, .size = size, .type = type, .is_map = is_map};
+}
+
 s32 MemoryManager::UnmapMemory(VAddr virtual_addr, u64 size) {
     if (size == 0) {
         return ORBIS_OK;
@@ -917,6 +930,7 @@ u64 MemoryManager::UnmapBytesFromEntry(VAddr virtual_addr, VirtualMemoryArea vma
         // Tracy memory tracking breaks from merging memory areas. Disabled for now.
         // TRACK_FREE(virtual_addr, "VMEM");
     }
+    RecordMemoryEvent(false, virtual_addr, size_in_vma, vma_type);
     return size_in_vma;
 }
 
@@ -5,6 +5,7 @@
 
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include "common/enum.h"
@@ -236,6 +237,16 @@ public:
 
     void SetPrtArea(u32 id, VAddr address, u64 size);
 
+    /// Calls the given function on each mapped virtual memory area under the memory lock.
+    void ForEachMappedArea(auto&& func) {
+        std::shared_lock lk{mutex};
+        for (const auto& [base, vma] : vma_map) {
+            if (vma.IsMapped()) {
+                func(vma);
+            }
+        }
+    }
+
     void CopySparseMemory(VAddr source, u8* dest, u64 size);
 
     bool TryWriteBacking(void* address, const void* data, u64 size);
@@ -327,6 +338,8 @@ private:
 
     s32 UnmapMemoryImpl(VAddr virtual_addr, u64 size);
 
+    void RecordMemoryEvent(bool is_map, VAddr virtual_addr, u64 size, VMAType type);
+
 private:
     AddressSpace impl;
     PhysMap dmem_map;
@@ -353,6 +366,19 @@ private:
     };
     std::array<PrtArea, 3> prt_areas{};
 
+    /// One map/unmap operation, kept in a ring for the devtools memory event log.
+    struct MemoryEvent {
+        u64 time_us;
+        VAddr addr;
+        u64 size;
+        VMAType type;
+        bool is_map;
+    };
+    static constexpr size_t NumMemoryEvents = 4096;
+    std::mutex event_mutex{};
+    std::array<MemoryEvent, NumMemoryEvents> memory_events{};
+    u64 memory_event_count{};
+
     friend class ::Core::Devtools::Widget::MemoryMapViewer;
 };
 
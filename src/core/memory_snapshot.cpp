@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <xxhash.h>
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "core/memory.h"
+#include "core/memory_snapshot.h"
+
+#include <miniz.h>
+
+namespace Core {
+
+namespace {
+
+constexpr u64 SNAPSHOT_MAGIC = 0x50414E5334535053ULL; // 'SPS4SNAP'
+constexpr u32 SNAPSHOT_VERSION = 1;
+
+struct SnapshotHeader {
+    u64 magic;
+    u32 version;
+    u32 is_delta;
+    u64 num_blocks;
+};
+
+struct BlockRecord {
+    VAddr virtual_addr;
+    u32 raw_size;
+    u32 compressed_size; // Zero when the payload is stored raw.
+};
+
+/// Only areas whose contents live in emulated physical memory are captured; file and code
+/// mappings are recreated by the loader and cannot be written back through the backing.
+bool IsSnapshotArea(const VirtualMemoryArea& vma) {
+    return vma.type == VMAType::Direct || vma.type == VMAType::Flexible ||
+           vma.type == VMAType::Pooled;
+}
+
+} // Anonymous namespace
+
+MemorySnapshot::MemorySnapshot(MemoryManager* memory_) : memory{memory_} {}
+
+MemorySnapshot::~MemorySnapshot() = default;
+
+bool MemorySnapshot::Save(const std::filesystem::path& path) {
+    struct PendingBlock {
+        VAddr virtual_addr;
+        u32 raw_size;
+        u32 compressed_size;
+        std::vector<u8> payload;
+    };
+
+    // Hash every block of the mapped areas and collect the ones that changed since the
+    // previous capture. The caller is expected to have paused emulation; blocks are read
+    // again by the compression workers below.
+    const bool is_delta = !block_hashes.empty();
+    std::vector<PendingBlock> blocks;
+    tsl::robin_map<VAddr, u64> new_hashes;
+    memory->ForEachMappedArea([&](const VirtualMemoryArea& vma) {
+        if (!IsSnapshotArea(vma)) {
+            return;
+        }
+        const VAddr area_end = vma.base + vma.size;
+        for (VAddr addr = vma.base; addr < area_end; addr += BLOCK_SIZE) {
+            const u32 size = static_cast<u32>(std::min(BLOCK_SIZE, area_end - addr));
+            const u64 hash = XXH3_64bits(std::bit_cast<const u8*>(addr), size);
+            new_hashes.emplace(addr, hash);
+            if (is_delta) {
+                const auto it = block_hashes.find(addr);
+                if (it != block_hashes.end() && it->second == hash) {
+                    continue;
+                }
+            }
+            blocks.push_back({.virtual_addr = addr, .raw_size = size, .compressed_size = 0});
+        }
+    });
+
+    // Compress the dirty blocks in parallel; each worker claims the next pending index.
+    std::atomic<size_t> next_block{0};
+    const size_t num_workers =
+        std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), blocks.size()));
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i) {
+            workers.emplace_back([&] {
+                for (size_t index; (index = next_block.fetch_add(1)) < blocks.size();) {
+                    auto& block = blocks[index];
+                    const u8* const src = std::bit_cast<const u8*>(block.virtual_addr);
+                    mz_ulong out_size = mz_compressBound(block.raw_size);
+                    block.payload.resize(out_size);
+                    const int result = mz_compress2(block.payload.data(), &out_size, src,
+                                                    block.raw_size, MZ_DEFAULT_LEVEL);
+                    if (result != MZ_OK || out_size >= block.raw_size) {
+                        // Incompressible data is stored raw.
+                        block.payload.assign(src, src + block.raw_size);
+                        block.compressed_size = 0;
+                    } else {
+                        block.payload.resize(out_size);
+                        block.compressed_size = static_cast<u32>(out_size);
+                    }
+                }
+            });
+        }
+    }
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Core, "Unable to open snapshot file {}", path.string());
+        return false;
+    }
+    const SnapshotHeader header = {
+        .magic = SNAPSHOT_MAGIC,
+        .version = SNAPSHOT_VERSION,
+        .is_delta = is_delta ? 1u : 0u,
+        .num_blocks = blocks.size(),
+    };
+    if (!file.WriteObject(header)) {
+        return false;
+    }
+    for (const auto& block : blocks) {
+        const BlockRecord record = {
+            .virtual_addr = block.virtual_addr,
+            .raw_size = block.raw_size,
+            .compressed_size = block.compressed_size,
+        };
+        if (!file.WriteObject(record) ||
+            file.WriteSpan<u8>(block.payload) != block.payload.size()) {
+            return false;
+        }
+    }
+
+    block_hashes = std::move(new_hashes);
+    LOG_INFO(Core, "Saved {} memory snapshot with {} blocks to {}", is_delta ? "delta" : "full",
+             blocks.size(), path.string());
+    return true;
+}
+
+bool MemorySnapshot::Restore(const std::filesystem::path& path) {
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Core, "Unable to open snapshot file {}", path.string());
+        return false;
+    }
+    SnapshotHeader header{};
+    if (!file.ReadObject(header) || header.magic != SNAPSHOT_MAGIC ||
+        header.version != SNAPSHOT_VERSION) {
+        LOG_ERROR(Core, "Snapshot file {} has an invalid header", path.string());
+        return false;
+    }
+
+    std::vector<u8> payload;
+    std::vector<u8> scratch;
+    for (u64 i = 0; i < header.num_blocks; ++i) {
+        BlockRecord record{};
+        if (!file.ReadObject(record)) {
+            LOG_ERROR(Core, "Snapshot file {} is truncated", path.string());
+            return false;
+        }
+        const size_t stored_size =
+            record.compressed_size != 0 ? record.compressed_size : record.raw_size;
+        payload.resize(stored_size);
+        if (file.ReadSpan<u8>(payload) != stored_size) {
+            LOG_ERROR(Core, "Snapshot file {} is truncated", path.string());
+            return false;
+        }
+        const u8* data = payload.data();
+        if (record.compressed_size != 0) {
+            scratch.resize(record.raw_size);
+            mz_ulong out_size = record.raw_size;
+            if (mz_uncompress(scratch.data(), &out_size, payload.data(),
+                              record.compressed_size) != MZ_OK ||
+                out_size != record.raw_size) {
+                LOG_ERROR(Core, "Snapshot block {:#x} failed to decompress", record.virtual_addr);
+                return false;
+            }
+            data = scratch.data();
+        }
+        if (!memory->IsValidMapping(record.virtual_addr, record.raw_size) ||
+            !memory->TryWriteBacking(std::bit_cast<u8*>(record.virtual_addr), data,
+                                     record.raw_size)) {
+            LOG_ERROR(Core, "Snapshot block {:#x} no longer matches the address space layout",
+                      record.virtual_addr);
+            return false;
+        }
+        // The GPU caches may hold copies derived from the overwritten contents.
+        memory->InvalidateMemory(record.virtual_addr, record.raw_size);
+    }
+
+    // The restored contents no longer match the stored baseline.
+    Reset();
+    LOG_INFO(Core, "Restored memory snapshot with {} blocks from {}", header.num_blocks,
+             path.string());
+    return true;
+}
+
+} // namespace Core
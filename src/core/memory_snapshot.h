@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <tsl/robin_map.h>
+#include "common/types.h"
+
+namespace Core {
+
+class MemoryManager;
+
+/**
+ * Incremental snapshot engine for mapped guest memory. The first save captures every mapped
+ * region with parallel compression workers; later saves hash fixed-size blocks against the
+ * previous capture and write only the blocks that changed since. Restoring applies a snapshot
+ * onto the current guest mappings; to rebuild a session, apply the full capture followed by
+ * its delta files in order.
+ */
+class MemorySnapshot {
+public:
+    static constexpr u64 BLOCK_SIZE = 256_KB;
+
+    explicit MemorySnapshot(MemoryManager* memory);
+    ~MemorySnapshot();
+
+    /// Writes a snapshot of mapped guest memory to the given file. The first call performs a
+    /// full capture; subsequent calls write only the blocks modified since the previous save.
+    bool Save(const std::filesystem::path& path);
+
+    /// Applies a previously saved snapshot onto the current guest mappings. Only memory
+    /// contents are restored; the address space layout must already match the capture.
+    bool Restore(const std::filesystem::path& path);
+
+    /// Discards the delta baseline, forcing the next save to be a full capture.
+    void Reset() {
+        block_hashes.clear();
+    }
+
+private:
+    MemoryManager* memory;
+    /// XXH3 of every block at the previous capture, keyed by guest virtual address.
+    tsl::robin_map<VAddr, u64> block_hashes;
+};
+
+} // namespace Core
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include "common/config.h"
@@ -194,21 +195,17 @@ public:
         return dynamic_info.export_libs;
     }
 
-    void ForEachRelocation(auto&& func) {
-        for (u32 i = 0; i < dynamic_info.relocation_table_size / sizeof(elf_relocation); i++) {
-            func(&dynamic_info.relocation_table[i], i, false);
-        }
-        for (u32 i = 0; i < dynamic_info.jmp_relocation_table_size / sizeof(elf_relocation); i++) {
-            func(&dynamic_info.jmp_relocation_table[i], i, true);
-        }
-    }
-
+    // Atomic because relocation tables are patched in parallel chunks and neighboring
+    // entries may share a byte.
     void SetRelaBit(u32 index) {
-        rela_bits[index >> 3] |= (1 << (index & 7));
+        std::atomic_ref<u8>{rela_bits[index >> 3]}.fetch_or(1 << (index & 7),
+                                                            std::memory_order_relaxed);
     }
 
     bool TestRelaBit(u32 index) const {
-        return (rela_bits[index >> 3] >> (index & 7)) & 1;
+        const u8 bits = std::atomic_ref<u8>{const_cast<u8&>(rela_bits[index >> 3])}.load(
+            std::memory_order_relaxed);
+        return (bits >> (index & 7)) & 1;
     }
 
     s32 Start(u64 args, const void* argp, void* param);
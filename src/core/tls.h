@@ -4,7 +4,10 @@
 #pragma once
 
 #include <cstring>
+#include <type_traits>
+#include "common/rdtsc.h"
 #include "common/types.h"
+#include "core/hle_trace.h"
 #ifdef _WIN32
 #include <malloc.h>
 #endif
@@ -51,7 +54,23 @@ struct HostCallWrapperImpl;
 template <class ReturnType, class... Args, PS4_SYSV_ABI ReturnType (*func)(Args...)>
 struct HostCallWrapperImpl<PS4_SYSV_ABI ReturnType (*)(Args...), func> {
     static ReturnType PS4_SYSV_ABI wrap(Args... args) {
-        return func(args...);
+        if (HleTrace::enabled.load(std::memory_order_relaxed)) [[unlikely]] {
+            // Record the wrapper itself; it is what the symbol table points at,
+            // so the devtools drain can resolve it back to a NID.
+            const u64 tsc_in = Common::FencedRDTSC();
+            if constexpr (std::is_void_v<ReturnType>) {
+                func(args...);
+                HleTrace::Push(reinterpret_cast<const void*>(&wrap), tsc_in,
+                               Common::FencedRDTSC());
+            } else {
+                ReturnType ret = func(args...);
+                HleTrace::Push(reinterpret_cast<const void*>(&wrap), tsc_in,
+                               Common::FencedRDTSC());
+                return ret;
+            }
+        } else {
+            return func(args...);
+        }
     }
 };
 
@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <latch>
 #include <set>
 #include <sstream>
 #include <fmt/core.h>
@@ -11,6 +12,7 @@
 #include <hwinfo/hwinfo.h>
 
 #include "common/config.h"
+#include "common/config_watch.h"
 #include "common/debug.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
@@ -26,6 +28,7 @@
 #include "common/polyfill_thread.h"
 #include "common/scm_rev.h"
 #include "common/singleton.h"
+#include "common/task_scheduler.h"
 #include "core/debugger.h"
 #include "core/devtools/widget/module_list.h"
 #include "core/emulator_state.h"
@@ -213,6 +216,15 @@ void Emulator::Run(std::filesystem::path file, std::vector<std::string> args,
     } else {
         Common::Log::Initialize();
     }
+
+    // Watch the active config file so GPU/debug knobs can be tweaked without a restart.
+    const auto custom_config_path =
+        Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) / (id + ".toml");
+    if (std::filesystem::exists(custom_config_path)) {
+        Config::StartWatch(custom_config_path, true);
+    } else {
+        Config::StartWatch(Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "config.toml");
+    }
     Common::Log::Start();
     if (!std::filesystem::exists(file)) {
         LOG_CRITICAL(Loader, "eboot.bin does not exist: {}",
@@ -253,16 +265,26 @@ void Emulator::Run(std::filesystem::path file, std::vector<std::string> args,
     LOG_INFO(Config, "Vulkan guestMarkers: {}", Config::getVkGuestMarkersEnabled());
     LOG_INFO(Config, "Vulkan rdocEnable: {}", Config::isRdocEnabled());
 
-    hwinfo::Memory ram;
-    hwinfo::OS os;
-    const auto cpus = hwinfo::getAllCPUs();
-    for (const auto& cpu : cpus) {
-        LOG_INFO(Config, "CPU Model: {}", cpu.modelName());
-        LOG_INFO(Config, "CPU Physical Cores: {}, Logical Cores: {}", cpu.numPhysicalCores(),
-                 cpu.numLogicalCores());
-    }
-    LOG_INFO(Config, "Total RAM: {} GB", std::round(ram.total_Bytes() / pow(1024, 3)));
-    LOG_INFO(Config, "Operating System: {}", os.name());
+    // Boot steps with no mutual dependencies overlap on the task scheduler while the main
+    // thread creates the window (SDL requires that to happen here) and mounts the guest
+    // filesystem. The latch is joined before the game starts executing.
+    auto& boot_scheduler = Common::TaskScheduler::Instance();
+    std::latch boot_tasks{3};
+
+    // Querying hardware info takes long enough to be worth taking off the critical path.
+    boot_scheduler.Submit([&boot_tasks] {
+        hwinfo::Memory ram;
+        hwinfo::OS os;
+        const auto cpus = hwinfo::getAllCPUs();
+        for (const auto& cpu : cpus) {
+            LOG_INFO(Config, "CPU Model: {}", cpu.modelName());
+            LOG_INFO(Config, "CPU Physical Cores: {}, Logical Cores: {}", cpu.numPhysicalCores(),
+                     cpu.numLogicalCores());
+        }
+        LOG_INFO(Config, "Total RAM: {} GB", std::round(ram.total_Bytes() / pow(1024, 3)));
+        LOG_INFO(Config, "Operating System: {}", os.name());
+        boot_tasks.count_down();
+    });
 
     if (param_sfo_exists) {
         LOG_INFO(Loader, "Game id: {} Title: {}", id, title);
@@ -290,23 +312,31 @@ void Emulator::Run(std::filesystem::path file, std::vector<std::string> args,
     controller = Common::Singleton<Input::GameController>::Instance();
     linker = Common::Singleton<Core::Linker>::Instance();
 
-    // Load renderdoc module
-    VideoCore::LoadRenderDoc();
+    // Load renderdoc module; only needed once the Vulkan instance exists, which is well
+    // after the boot tasks are joined.
+    boot_scheduler.Submit([&boot_tasks] {
+        VideoCore::LoadRenderDoc();
+        boot_tasks.count_down();
+    });
 
     // Initialize patcher and trophies
     if (!id.empty()) {
         MemoryPatcher::g_game_serial = id;
         Libraries::Np::NpTrophy::game_serial = id;
-
+    }
+    boot_scheduler.Submit([&boot_tasks, &game_folder, &id] {
         const auto trophyDir =
             Common::FS::GetUserPath(Common::FS::PathType::MetaDataDir) / id / "TrophyFiles";
-        if (!std::filesystem::exists(trophyDir)) {
+        if (!id.empty() && !std::filesystem::exists(trophyDir)) {
             TRP trp;
-            if (!trp.Extract(game_folder, id)) {
+            // Only the definitions are needed this early; the icons are
+            // extracted once something actually displays one.
+            if (!trp.Extract(game_folder, id, false)) {
                 LOG_ERROR(Loader, "Couldn't extract trophies");
             }
         }
-    }
+        boot_tasks.count_down();
+    });
 
     std::string game_title = fmt::format("{} - {} <{}>", id, title, app_version);
     std::string window_title = "";
@@ -397,6 +427,10 @@ void Emulator::Run(std::filesystem::path file, std::vector<std::string> args,
         std::quick_exit(0);
     }
 
+    // Join the boot tasks; trophy data and the RenderDoc hook must be in place before any
+    // guest code runs.
+    boot_tasks.wait();
+
 #ifdef ENABLE_DISCORD_RPC
     // Discord RPC
     if (Config::getEnableDiscordRPC()) {
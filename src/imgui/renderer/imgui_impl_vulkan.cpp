@@ -22,12 +22,15 @@ struct RenderBuffer {
     vk::DeviceMemory buffer_memory{};
     vk::DeviceSize buffer_size{};
     vk::Buffer buffer{};
+    void* mapped{};
 };
 
-// Reusable buffers used for rendering 1 current in-flight frame, for RenderDrawData()
+// Reusable buffers used for rendering 1 current in-flight frame, for RenderDrawData().
+// Vertex and index data are suballocated from a single grow-only, persistently mapped
+// buffer so steady-state frames do no allocation or map/unmap work.
 struct FrameRenderBuffers {
-    RenderBuffer vertex;
-    RenderBuffer index;
+    RenderBuffer buffer;
+    vk::DeviceSize index_offset{};
 };
 
 // Each viewport will hold 1 WindowRenderBuffers
@@ -475,10 +478,14 @@ void RemoveTexture(ImTextureID texture) {
     delete texture;
 }
 
-static void CreateOrResizeBuffer(RenderBuffer& rb, size_t new_size, vk::BufferUsageFlagBits usage) {
+static void CreateOrResizeBuffer(RenderBuffer& rb, size_t new_size, vk::BufferUsageFlags usage) {
     VkData* bd = GetBackendData();
     IM_ASSERT(bd != nullptr);
     const InitInfo& v = bd->init_info;
+    if (rb.mapped != nullptr) {
+        v.device.unmapMemory(rb.buffer_memory);
+        rb.mapped = nullptr;
+    }
     if (rb.buffer != VK_NULL_HANDLE) {
         v.device.destroyBuffer(rb.buffer, v.allocator);
     }
@@ -505,6 +512,8 @@ static void CreateOrResizeBuffer(RenderBuffer& rb, size_t new_size, vk::BufferUs
     rb.buffer_memory = CheckVkResult(v.device.allocateMemory(alloc_info, v.allocator));
 
     CheckVkErr(v.device.bindBufferMemory(rb.buffer, rb.buffer_memory, 0));
+    rb.mapped =
+        CheckVkResult(v.device.mapMemory(rb.buffer_memory, 0, VK_WHOLE_SIZE, vk::MemoryMapFlags{}));
     rb.buffer_size = buffer_size_aligned;
 }
 
@@ -517,10 +526,10 @@ static void SetupRenderState(ImDrawData& draw_data, vk::Pipeline pipeline, vk::C
 
     // Bind Vertex And Index Buffer:
     if (draw_data.TotalVtxCount > 0) {
-        vk::Buffer vertex_buffers[1] = {frb.vertex.buffer};
+        vk::Buffer vertex_buffers[1] = {frb.buffer.buffer};
         vk::DeviceSize vertex_offset[1] = {0};
         cmdbuf.bindVertexBuffers(0, {vertex_buffers}, vertex_offset);
-        cmdbuf.bindIndexBuffer(frb.index.buffer, 0,
+        cmdbuf.bindIndexBuffer(frb.buffer.buffer, frb.index_offset,
                                IDX_SIZE == 2 ? vk::IndexType::eUint16 : vk::IndexType::eUint32);
     }
 
@@ -578,25 +587,25 @@ void RenderDrawData(ImDrawData& draw_data, vk::CommandBuffer command_buffer,
     FrameRenderBuffers& frb = wrb.frame_render_buffers[wrb.index];
 
     if (draw_data.TotalVtxCount > 0) {
-        // Create or resize the vertex/index buffers
-        size_t vertex_size = AlignBufferSize(draw_data.TotalVtxCount * sizeof(ImDrawVert),
-                                             bd->buffer_memory_alignment);
-        size_t index_size =
+        // Create or grow the shared vertex/index buffer; it is never shrunk, so
+        // steady-state frames reuse the persistent allocation and mapping.
+        const size_t vertex_size = AlignBufferSize(draw_data.TotalVtxCount * sizeof(ImDrawVert),
+                                                   bd->buffer_memory_alignment);
+        const size_t index_size =
             AlignBufferSize(draw_data.TotalIdxCount * IDX_SIZE, bd->buffer_memory_alignment);
-        if (frb.vertex.buffer == VK_NULL_HANDLE || frb.vertex.buffer_size < vertex_size) {
-            CreateOrResizeBuffer(frb.vertex, vertex_size, vk::BufferUsageFlagBits::eVertexBuffer);
-        }
-        if (frb.index.buffer == VK_NULL_HANDLE || frb.index.buffer_size < index_size) {
-            CreateOrResizeBuffer(frb.index, index_size, vk::BufferUsageFlagBits::eIndexBuffer);
+        const size_t total_size = vertex_size + index_size;
+        if (frb.buffer.buffer == VK_NULL_HANDLE || frb.buffer.buffer_size < total_size) {
+            // Grow with headroom so slowly expanding overlays don't reallocate every frame.
+            CreateOrResizeBuffer(frb.buffer, total_size + total_size / 2,
+                                 vk::BufferUsageFlagBits::eVertexBuffer |
+                                     vk::BufferUsageFlagBits::eIndexBuffer);
         }
+        frb.index_offset = vertex_size;
 
-        // Upload vertex/index data into a single contiguous GPU buffer
-        ImDrawVert* vtx_dst = nullptr;
-        ImDrawIdx* idx_dst = nullptr;
-        vtx_dst = (ImDrawVert*)CheckVkResult(
-            v.device.mapMemory(frb.vertex.buffer_memory, 0, vertex_size, vk::MemoryMapFlags{}));
-        idx_dst = (ImDrawIdx*)CheckVkResult(
-            v.device.mapMemory(frb.index.buffer_memory, 0, index_size, vk::MemoryMapFlags{}));
+        // Upload vertex/index data, with indices suballocated after the vertices
+        auto* vtx_dst = reinterpret_cast<ImDrawVert*>(frb.buffer.mapped);
+        auto* idx_dst =
+            reinterpret_cast<ImDrawIdx*>(static_cast<char*>(frb.buffer.mapped) + vertex_size);
         for (int n = 0; n < draw_data.CmdListsCount; n++) {
             const ImDrawList* cmd_list = draw_data.CmdLists[n];
             memcpy(vtx_dst, cmd_list->VtxBuffer.Data,
@@ -605,19 +614,13 @@ void RenderDrawData(ImDrawData& draw_data, vk::CommandBuffer command_buffer,
             vtx_dst += cmd_list->VtxBuffer.Size;
             idx_dst += cmd_list->IdxBuffer.Size;
         }
-        vk::MappedMemoryRange range[2]{
-            {
-                .memory = frb.vertex.buffer_memory,
-                .size = VK_WHOLE_SIZE,
-            },
+        vk::MappedMemoryRange range[1]{
             {
-                .memory = frb.index.buffer_memory,
+                .memory = frb.buffer.buffer_memory,
                 .size = VK_WHOLE_SIZE,
             },
         };
         CheckVkErr(v.device.flushMappedMemoryRanges({range}));
-        v.device.unmapMemory(frb.vertex.buffer_memory);
-        v.device.unmapMemory(frb.index.buffer_memory);
     }
 
     // Setup desired Vulkan state
@@ -630,6 +633,13 @@ void RenderDrawData(ImDrawData& draw_data, vk::CommandBuffer command_buffer,
     // (1,1) unless using retina display which are often (2,2)
     ImVec2 clip_scale = draw_data.FramebufferScale;
 
+    // Last scissor/texture state applied to the command buffer, used to elide redundant
+    // state changes; overlays often reuse the same clip rect and font texture for many
+    // consecutive draw commands.
+    vk::Rect2D bound_scissor{};
+    bool has_bound_scissor = false;
+    vk::DescriptorSet bound_desc_set{};
+
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
     int global_vtx_offset = 0;
@@ -644,8 +654,13 @@ void RenderDrawData(ImDrawData& draw_data, vk::CommandBuffer command_buffer,
                 // request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState) {
                     SetupRenderState(draw_data, pipeline, command_buffer, frb, fb_width, fb_height);
+                    has_bound_scissor = false;
+                    bound_desc_set = vk::DescriptorSet{};
                 } else {
                     pcmd->UserCallback(cmd_list, pcmd);
+                    // The callback may have recorded arbitrary state changes.
+                    has_bound_scissor = false;
+                    bound_desc_set = vk::DescriptorSet{};
                 }
             } else {
                 // Project scissor/clipping rectangles into framebuffer space
@@ -681,12 +696,19 @@ void RenderDrawData(ImDrawData& draw_data, vk::CommandBuffer command_buffer,
                         .height = (uint32_t)(clip_max.y - clip_min.y),
                     },
                 };
-                command_buffer.setScissor(0, 1, &scissor);
+                if (!has_bound_scissor || scissor != bound_scissor) {
+                    command_buffer.setScissor(0, 1, &scissor);
+                    bound_scissor = scissor;
+                    has_bound_scissor = true;
+                }
 
                 // Bind DescriptorSet with font or user texture
-                vk::DescriptorSet desc_set[1]{pcmd->TextureId->descriptor_set};
-                command_buffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics,
-                                                  bd->pipeline_layout, 0, {desc_set}, {});
+                if (pcmd->TextureId->descriptor_set != bound_desc_set) {
+                    bound_desc_set = pcmd->TextureId->descriptor_set;
+                    vk::DescriptorSet desc_set[1]{bound_desc_set};
+                    command_buffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics,
+                                                      bd->pipeline_layout, 0, {desc_set}, {});
+                }
 
                 // Draw
                 command_buffer.drawIndexed(pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset,
@@ -919,6 +941,10 @@ static void DestroyFontsTexture() {
 
 static void DestroyFrameRenderBuffers(vk::Device device, RenderBuffer& rb,
                                       const vk::AllocationCallbacks* allocator) {
+    if (rb.mapped) {
+        device.unmapMemory(rb.buffer_memory);
+        rb.mapped = nullptr;
+    }
     if (rb.buffer) {
         device.destroyBuffer(rb.buffer, allocator);
         rb.buffer = VK_NULL_HANDLE;
@@ -934,8 +960,7 @@ static void DestroyWindowRenderBuffers(vk::Device device, WindowRenderBuffers& b
                                        const vk::AllocationCallbacks* allocator) {
     for (uint32_t n = 0; n < buffers.count; n++) {
         auto& frb = buffers.frame_render_buffers[n];
-        DestroyFrameRenderBuffers(device, frb.index, allocator);
-        DestroyFrameRenderBuffers(device, frb.vertex, allocator);
+        DestroyFrameRenderBuffers(device, frb.buffer, allocator);
     }
     buffers = {};
 }
@@ -4,6 +4,7 @@
 #include <SDL3/SDL.h>
 #include "common/config.h"
 #include "common/logging/log.h"
+#include "common/task_scheduler.h"
 #include "core/libraries/kernel/time.h"
 #include "core/libraries/pad/pad.h"
 #include "input/controller.h"
@@ -66,7 +67,40 @@ GameController::GameController() : m_states_queue(64) {}
 void GameController::ReadState(State* state, bool* isConnected, int* connectedCount) {
     *isConnected = m_connected;
     *connectedCount = m_connected_count;
-    *state = m_state;
+
+    // Copy the two most recent snapshots without taking a lock, so guest pad
+    // reads at any rate never stall the event producers.
+    State prev;
+    State cur;
+    while (true) {
+        const u32 token = m_snapshot_mutex.BeginOptimisticRead();
+        prev = m_snapshot_prev;
+        cur = m_snapshot;
+        if (m_snapshot_mutex.ValidateOptimisticRead(token)) {
+            break;
+        }
+    }
+
+    const u64 now = Libraries::Kernel::sceKernelGetProcessTime();
+    if (now >= cur.time || cur.time <= prev.time) {
+        *state = cur;
+        return;
+    }
+    if (now <= prev.time) {
+        *state = prev;
+        return;
+    }
+
+    // The read falls between the two samples: take the digital state from the
+    // nearer one and interpolate the analog axes to the read time.
+    const float t =
+        static_cast<float>(now - prev.time) / static_cast<float>(cur.time - prev.time);
+    *state = t < 0.5f ? prev : cur;
+    for (int i = 0; i < static_cast<int>(Axis::AxisMax); i++) {
+        state->axes[i] =
+            prev.axes[i] + static_cast<int>(t * static_cast<float>(cur.axes[i] - prev.axes[i]));
+    }
+    state->time = now;
 }
 
 int GameController::ReadStates(State* states, int states_num, bool* isConnected,
@@ -151,10 +185,28 @@ void GameController::SetLightBarRGB(u8 r, u8 g, u8 b) {
 }
 
 void GameController::SetVibration(u8 smallMotor, u8 largeMotor) {
-    if (!m_engine) {
+    // Rumble crosses into the SDL joystick backend, which can mean a blocking hid write
+    // on some drivers. Record the latest request and let a scheduler task apply it, so
+    // the guest call returns immediately and a burst of calls within a frame collapses
+    // into a single backend submission of the most recent value.
+    const u16 request = static_cast<u16>(smallMotor) | (static_cast<u16>(largeMotor) << 8);
+    m_vibration_request.store(request, std::memory_order_release);
+    if (m_vibration_pending.exchange(true, std::memory_order_acq_rel)) {
         return;
     }
-    m_engine->SetVibration(smallMotor, largeMotor);
+    Common::TaskScheduler::Instance().Submit(
+        [this] {
+            // Clear the flag before sampling the request, so a setter racing with the
+            // read schedules a fresh task rather than being lost.
+            m_vibration_pending.store(false, std::memory_order_release);
+            const u16 latest = m_vibration_request.load(std::memory_order_acquire);
+            if (latest == m_vibration_applied || !m_engine) {
+                return;
+            }
+            m_vibration_applied = latest;
+            m_engine->SetVibration(latest & 0xFF, latest >> 8);
+        },
+        Common::TaskPriority::High);
 }
 
 void GameController::SetTouchpadState(int touchIndex, bool touchDown, float x, float y) {
@@ -227,9 +279,15 @@ Engine* GameController::GetEngine() {
 }
 
 void GameController::PushState() {
-    std::lock_guard lg(m_states_queue_mutex);
-    m_state.time = Libraries::Kernel::sceKernelGetProcessTime();
-    m_states_queue.Push(m_state);
+    {
+        std::lock_guard lg(m_states_queue_mutex);
+        m_state.time = Libraries::Kernel::sceKernelGetProcessTime();
+        m_states_queue.Push(m_state);
+    }
+    // Publish the new sample for the lock-free ReadState path.
+    std::lock_guard lg(m_snapshot_mutex);
+    m_snapshot_prev = m_snapshot;
+    m_snapshot = m_state;
 }
 
 u32 GameController::Poll() {
@@ -4,12 +4,14 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 #include <SDL3/SDL_gamepad.h>
 
+#include "common/shared_first_mutex.h"
 #include "common/types.h"
 #include "core/libraries/pad/pad.h"
 
@@ -149,9 +151,23 @@ private:
 
     State m_state;
 
+    // The two most recent timestamped states, published through a seqlock so
+    // guest reads never contend with the producers. State is flat POD, which
+    // keeps the optimistic copies safe.
+    Common::SharedFirstMutex m_snapshot_mutex;
+    State m_snapshot_prev;
+    State m_snapshot;
+
     std::mutex m_states_queue_mutex;
     RingBufferQueue<State> m_states_queue;
 
+    // Latest requested rumble value (small motor in the low byte) and a dispatch flag;
+    // the backend submission happens on a scheduler task, so back-to-back guest calls
+    // coalesce into one. m_vibration_applied is only touched by the task.
+    std::atomic<u16> m_vibration_request{};
+    std::atomic<bool> m_vibration_pending{};
+    u16 m_vibration_applied{};
+
     std::unique_ptr<Engine> m_engine = nullptr;
 };
 
@@ -458,14 +458,20 @@ void PatchPhiNodes(const IR::Program& program, EmitContext& ctx) {
 
 std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                            const IR::Program& program, Bindings& binding) {
-    EmitContext ctx{profile, runtime_info, program.info, binding};
-    const Id main{DefineMain(ctx, program)};
-    DefineEntryPoint(program.info, ctx, main);
-    SetupCapabilities(program.info, profile, runtime_info, ctx);
-    SetupFloatMode(ctx, profile, runtime_info, main);
-    PatchPhiNodes(program, ctx);
-    binding.user_data += program.info.ud_mask.NumRegs();
-    return ctx.Assemble();
+    std::vector<u32> result;
+    {
+        EmitContext ctx{profile, runtime_info, program.info, binding};
+        const Id main{DefineMain(ctx, program)};
+        DefineEntryPoint(program.info, ctx, main);
+        SetupCapabilities(program.info, profile, runtime_info, ctx);
+        SetupFloatMode(ctx, profile, runtime_info, main);
+        PatchPhiNodes(program, ctx);
+        binding.user_data += program.info.ud_mask.NumRegs();
+        result = ctx.Assemble();
+    }
+    // Reclaim all arena-backed bookkeeping of this compile in one shot.
+    EmitContext::ThreadArena().Reset();
+    return result;
 }
 
 Id EmitPhi(EmitContext& ctx, IR::Inst* inst) {
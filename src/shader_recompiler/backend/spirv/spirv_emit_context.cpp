@@ -66,6 +66,11 @@ void Name(EmitContext& ctx, Id object, std::string_view format_str, Args&&... ar
 
 } // Anonymous namespace
 
+Common::LinearArena& EmitContext::ThreadArena() {
+    thread_local Common::LinearArena arena{256 * 1024};
+    return arena;
+}
+
 EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_info_, Info& info_,
                          Bindings& binding_)
     : Sirit::Module(profile_.supported_spirv), info{info_}, runtime_info{runtime_info_},
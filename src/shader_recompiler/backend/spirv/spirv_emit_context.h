@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <sirit/sirit.h>
 
+#include "common/object_pool.h"
 #include "shader_recompiler/backend/bindings.h"
 #include "shader_recompiler/info.h"
 #include "shader_recompiler/ir/value.h"
@@ -351,7 +352,14 @@ public:
     boost::container::small_vector<BufferDefinition, 16> buffers;
     boost::container::small_vector<TextureDefinition, 8> images;
     boost::container::small_vector<Id, 4> samplers;
-    std::unordered_map<u32, Id> first_to_last_label_map;
+
+    /// Per-thread bump arena backing transient emission bookkeeping. Freed in one shot
+    /// by EmitSPIRV() after assembly, keeping compile workers allocation-quiet.
+    static Common::LinearArena& ThreadArena();
+
+    using LabelMap = std::unordered_map<u32, Id, std::hash<u32>, std::equal_to<u32>,
+                                        Common::ArenaAllocator<std::pair<const u32, Id>>>;
+    LabelMap first_to_last_label_map{LabelMap::allocator_type{ThreadArena()}};
 
     size_t flatbuf_index{};
     size_t bda_pagetable_index{};
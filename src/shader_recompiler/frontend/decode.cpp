@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include "common/assert.h"
 #include "shader_recompiler/frontend/decode.h"
 
@@ -16,74 +17,88 @@ T extract(T value, u32 lst, u32 fst) {
 }
 } // namespace bit
 
-InstEncoding GetInstructionEncoding(u32 token) {
-    auto encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_9bit);
-    switch (encoding) {
-    case InstEncoding::SOP1:
-    case InstEncoding::SOPP:
-    case InstEncoding::SOPC:
-        return encoding;
-    default:
-        break;
-    }
+// Every encoding is fully determined by the top nine bits of the first token, so the
+// longest-prefix-match over the seven mask widths is precomputed into one table lookup.
+static constexpr std::array<InstEncoding, 512> BuildEncodingTable() {
+    constexpr auto classify = [](u32 token) {
+        auto encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_9bit);
+        switch (encoding) {
+        case InstEncoding::SOP1:
+        case InstEncoding::SOPP:
+        case InstEncoding::SOPC:
+            return encoding;
+        default:
+            break;
+        }
 
-    encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_7bit);
-    switch (encoding) {
-    case InstEncoding::VOP1:
-    case InstEncoding::VOPC:
-        return encoding;
-    default:
-        break;
-    }
+        encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_7bit);
+        switch (encoding) {
+        case InstEncoding::VOP1:
+        case InstEncoding::VOPC:
+            return encoding;
+        default:
+            break;
+        }
 
-    encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_6bit);
-    switch (encoding) {
-    case InstEncoding::VOP3:
-    case InstEncoding::EXP:
-    case InstEncoding::VINTRP:
-    case InstEncoding::DS:
-    case InstEncoding::MUBUF:
-    case InstEncoding::MTBUF:
-    case InstEncoding::MIMG:
-        return encoding;
-    default:
-        break;
-    }
+        encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_6bit);
+        switch (encoding) {
+        case InstEncoding::VOP3:
+        case InstEncoding::EXP:
+        case InstEncoding::VINTRP:
+        case InstEncoding::DS:
+        case InstEncoding::MUBUF:
+        case InstEncoding::MTBUF:
+        case InstEncoding::MIMG:
+            return encoding;
+        default:
+            break;
+        }
 
-    encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_5bit);
-    switch (encoding) {
-    case InstEncoding::SMRD:
-        return encoding;
-    default:
-        break;
-    }
+        encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_5bit);
+        switch (encoding) {
+        case InstEncoding::SMRD:
+            return encoding;
+        default:
+            break;
+        }
 
-    encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_4bit);
-    switch (encoding) {
-    case InstEncoding::SOPK:
-        return encoding;
-    default:
-        break;
-    }
+        encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_4bit);
+        switch (encoding) {
+        case InstEncoding::SOPK:
+            return encoding;
+        default:
+            break;
+        }
 
-    encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_2bit);
-    switch (encoding) {
-    case InstEncoding::SOP2:
-        return encoding;
-    default:
-        break;
-    }
+        encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_2bit);
+        switch (encoding) {
+        case InstEncoding::SOP2:
+            return encoding;
+        default:
+            break;
+        }
 
-    encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_1bit);
-    switch (encoding) {
-    case InstEncoding::VOP2:
-        return encoding;
-    default:
-        break;
+        encoding = static_cast<InstEncoding>(token & (u32)EncodingMask::MASK_1bit);
+        switch (encoding) {
+        case InstEncoding::VOP2:
+            return encoding;
+        default:
+            break;
+        }
+
+        return InstEncoding::ILLEGAL;
+    };
+
+    std::array<InstEncoding, 512> table{};
+    for (u32 prefix = 0; prefix < table.size(); ++prefix) {
+        table[prefix] = classify(prefix << 23);
     }
+    return table;
+}
 
-    UNREACHABLE();
-    return InstEncoding::ILLEGAL;
+InstEncoding GetInstructionEncoding(u32 token) {
+    static constexpr auto encoding_table = BuildEncodingTable();
+    return encoding_table[token >> 23];
 }
 
 bool HasAdditionalLiteral(InstEncoding encoding, Opcode opcode) {
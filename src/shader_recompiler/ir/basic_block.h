@@ -149,10 +149,15 @@ public:
         return instructions.crend();
     }
 
+    /// Number of status flags (SCC, EXEC, VCC, VCC_LO, VCC_HI, M0) the SSA pass
+    /// tracks per block; slot assignment lives with the pass.
+    static constexpr size_t NumSsaFlags = 6;
+
     /// Intrusively store the value of a register in the block.
     std::array<Value, NumScalarRegs> ssa_sreg_values;
     std::array<Value, NumScalarRegs> ssa_sbit_values;
     std::array<Value, NumVectorRegs> ssa_vreg_values;
+    std::array<Value, NumSsaFlags> ssa_flag_values;
 
     /// Block of the CFG that corresponds to this IR block.
     /// It can be null as IR has additional control flow blocks.
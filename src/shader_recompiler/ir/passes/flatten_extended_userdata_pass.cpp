@@ -7,6 +7,7 @@
 #include <xbyak/xbyak.h>
 #include <xbyak/xbyak_util.h>
 #include "common/config.h"
+#include "common/hash.h"
 #include "common/io_file.h"
 #include "common/logging/log.h"
 #include "common/path_util.h"
@@ -170,25 +171,48 @@ static inline void PopPtr(Xbyak::CodeGenerator& c) {
     c.pop(rdi);
 };
 
-static void VisitPointer(u32 off_dw, IR::Inst* subtree, PassInfo& pass_info,
-                         Xbyak::CodeGenerator& c) {
-    PushPtr(c, off_dw);
+// Assigns flattened buffer offsets to the ReadConsts of a subtree while hashing the
+// layout (source offsets and pointer nesting). Two shaders with the same hash walk
+// identical SRT shapes and assign identical destination offsets, so they can share
+// one emitted walker.
+static u64 AssignOffsets(u32 off_dw, IR::Inst* subtree, PassInfo& pass_info, u64 hash) {
     PassInfo::PtrUserList* use_list = pass_info.GetUsesAsPointer(subtree);
     ASSERT(use_list);
 
-    // First copy all the src data from this tree level
+    // Mark the subtree boundary so nesting is captured, not just the offset sequence.
+    hash = HashCombine(hash, u64{off_dw} | (u64{use_list->size()} << 32));
+
+    // First assign all the src data from this tree level.
     // That way, all data that was contiguous in the guest SRT is also contiguous in the
     // flattened buffer.
-    // TODO src and dst are contiguous. Optimize with wider loads/stores
-    // TODO if this subtree is dynamically indexed, don't compact it (keep it sparse)
     for (auto [src_off_dw, use] : *use_list) {
-        c.mov(r10d, ptr[rdi + (src_off_dw << 2)]);
-        c.mov(ptr[rsi + (pass_info.dst_off_dw << 2)], r10d);
-
+        hash = HashCombine(hash, u64{src_off_dw});
         use->SetFlags<u32>(pass_info.dst_off_dw);
         pass_info.dst_off_dw++;
     }
 
+    // Then visit any children used as pointers
+    for (const auto [src_off_dw, use] : *use_list) {
+        if (pass_info.GetUsesAsPointer(use)) {
+            hash = AssignOffsets(src_off_dw, use, pass_info, hash);
+        }
+    }
+    return hash;
+}
+
+// Emits the walker for a subtree whose destination offsets were assigned above.
+// TODO src and dst are contiguous. Optimize with wider loads/stores
+// TODO if this subtree is dynamically indexed, don't compact it (keep it sparse)
+static void VisitPointer(u32 off_dw, IR::Inst* subtree, PassInfo& pass_info,
+                         Xbyak::CodeGenerator& c) {
+    PushPtr(c, off_dw);
+    PassInfo::PtrUserList* use_list = pass_info.GetUsesAsPointer(subtree);
+
+    for (auto [src_off_dw, use] : *use_list) {
+        c.mov(r10d, ptr[rdi + (src_off_dw << 2)]);
+        c.mov(ptr[rsi + (use->Flags<u32>() << 2)], r10d);
+    }
+
     // Then visit any children used as pointers
     for (const auto [src_off_dw, use] : *use_list) {
         if (pass_info.GetUsesAsPointer(use)) {
@@ -199,6 +223,17 @@ static void VisitPointer(u32 off_dw, IR::Inst* subtree, PassInfo& pass_info,
     PopPtr(c);
 }
 
+struct CachedSrtWalker {
+    PFN_SrtWalker walker_func;
+    size_t walker_func_size;
+    u32 flattened_bufsize_dw;
+};
+
+// Walkers already emitted, keyed by layout hash. Permutations of the same shader and
+// shaders sharing an SRT shape reuse one walker instead of filling the codegen buffer
+// with identical copies. Only touched on the translation thread, like g_srt_codegen.
+static std::unordered_map<u64, CachedSrtWalker> g_srt_walker_cache;
+
 static void GenerateSrtProgram(Info& info, PassInfo& pass_info) {
     Xbyak::CodeGenerator& c = g_srt_codegen;
 
@@ -215,10 +250,26 @@ static void GenerateSrtProgram(Info& info, PassInfo& pass_info) {
         signals->RegisterAccessViolationHandler(SrtWalkerSignalHandler, priority);
     }
 
-    info.srt_info.walker_func = c.getCurr<PFN_SrtWalker>();
     pass_info.dst_off_dw = NUM_USER_DATA_REGS;
     ASSERT(pass_info.dst_off_dw == info.srt_info.flattened_bufsize_dw);
 
+    // Offsets always need to be assigned to the freshly translated IR, but the walker
+    // they describe is a pure function of the layout and can be shared on a hash hit.
+    u64 layout_hash = 0;
+    for (const auto& [sgpr_base, root] : pass_info.srt_roots) {
+        layout_hash = AssignOffsets(static_cast<u32>(sgpr_base), root, pass_info, layout_hash);
+    }
+
+    const auto [it, is_new] = g_srt_walker_cache.try_emplace(layout_hash);
+    if (!is_new) {
+        info.srt_info.walker_func = it->second.walker_func;
+        info.srt_info.walker_func_size = it->second.walker_func_size;
+        info.srt_info.flattened_bufsize_dw = it->second.flattened_bufsize_dw;
+        return;
+    }
+
+    info.srt_info.walker_func = c.getCurr<PFN_SrtWalker>();
+
     for (const auto& [sgpr_base, root] : pass_info.srt_roots) {
         VisitPointer(static_cast<u32>(sgpr_base), root, pass_info, c);
     }
@@ -235,6 +286,11 @@ static void GenerateSrtProgram(Info& info, PassInfo& pass_info) {
     }
 
     info.srt_info.flattened_bufsize_dw = pass_info.dst_off_dw;
+    it->second = CachedSrtWalker{
+        .walker_func = info.srt_info.walker_func,
+        .walker_func_size = info.srt_info.walker_func_size,
+        .flattened_bufsize_dw = info.srt_info.flattened_bufsize_dw,
+    };
 }
 
 }; // namespace
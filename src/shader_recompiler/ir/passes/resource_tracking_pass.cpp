@@ -819,7 +819,7 @@ IR::U32 CalculateBufferAddress(IR::IREmitter& ir, const IR::Inst& inst, const In
 
 void PatchBufferArgs(IR::Block& block, IR::Inst& inst, Info& info) {
     const auto handle = inst.Arg(0);
-    const auto buffer_res = info.buffers[handle.U32()];
+    auto& buffer_res = info.buffers[handle.U32()];
     const auto buffer = buffer_res.GetSharp(info);
 
     // Address of constant buffer reads can be calculated at IR emission time.
@@ -827,6 +827,13 @@ void PatchBufferArgs(IR::Block& block, IR::Inst& inst, Info& info) {
         return;
     }
 
+    // Without an index term the stride multiply folds away with the zero index, so
+    // only accesses that scale by it force specialization on the stride value.
+    const auto inst_info = inst.Flags<IR::BufferInstInfo>();
+    if (inst_info.index_enable || buffer.add_tid_enable || buffer.swizzle_enable) {
+        buffer_res.stride_baked = true;
+    }
+
     IR::IREmitter ir{block, IR::Block::InstructionList::s_iterator_to(inst)};
     inst.SetArg(IR::LoadBufferArgs::Address,
                 CalculateBufferAddress(ir, inst, info, buffer, buffer.stride));
@@ -123,14 +123,19 @@ void SharedMemoryToStoragePass(IR::Program& program, const RuntimeInfo& runtime_
     });
 
     for (IR::Block* const block : program.blocks) {
+        // The workgroup base offset is loop-invariant; materialize it at the first shared
+        // access of each block and reuse it, there is no CSE pass to clean up duplicates.
+        IR::U32 offset{};
         for (IR::Inst& inst : block->Instructions()) {
             if (!IsSharedAccess(inst)) {
                 continue;
             }
             IR::IREmitter ir{*block, IR::Block::InstructionList::s_iterator_to(inst)};
             const IR::U32 handle = ir.Imm32(binding);
-            const IR::U32 offset = ir.IMul(ir.GetAttributeU32(IR::Attribute::WorkgroupIndex),
-                                           ir.Imm32(shared_memory_size));
+            if (offset.IsEmpty()) {
+                offset = ir.IMul(ir.GetAttributeU32(IR::Attribute::WorkgroupIndex),
+                                 ir.Imm32(shared_memory_size));
+            }
             const IR::U32 address = ir.IAdd(IR::U32{inst.Arg(0)}, offset);
             switch (inst.GetOpcode()) {
             case IR::Opcode::SharedAtomicIAdd32:
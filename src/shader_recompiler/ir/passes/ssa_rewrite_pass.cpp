@@ -57,6 +57,17 @@ using Variant = std::variant<IR::ScalarReg, IR::VectorReg, GotoVariable, ThreadB
                              SccFlagTag, ExecFlagTag, VccFlagTag, VccLoTag, VccHiTag, M0Tag>;
 using ValueMap = std::unordered_map<IR::Block*, IR::Value>;
 
+/// Slot of each status flag in IR::Block::ssa_flag_values.
+enum SsaFlagSlot : size_t {
+    SccSlot,
+    ExecSlot,
+    VccSlot,
+    VccLoSlot,
+    VccHiSlot,
+    M0Slot,
+};
+static_assert(M0Slot < IR::Block::NumSsaFlags);
+
 struct DefTable {
     const IR::Value& Def(IR::Block* block, IR::ScalarReg variable) {
         return block->ssa_sreg_values[RegIndex(variable)];
@@ -87,54 +98,49 @@ struct DefTable {
     }
 
     const IR::Value& Def(IR::Block* block, SccFlagTag) {
-        return scc_flag[block];
+        return block->ssa_flag_values[SccSlot];
     }
     void SetDef(IR::Block* block, SccFlagTag, const IR::Value& value) {
-        scc_flag.insert_or_assign(block, value);
+        block->ssa_flag_values[SccSlot] = value;
     }
 
     const IR::Value& Def(IR::Block* block, ExecFlagTag) {
-        return exec_flag[block];
+        return block->ssa_flag_values[ExecSlot];
     }
     void SetDef(IR::Block* block, ExecFlagTag, const IR::Value& value) {
-        exec_flag.insert_or_assign(block, value);
+        block->ssa_flag_values[ExecSlot] = value;
     }
 
     const IR::Value& Def(IR::Block* block, VccLoTag) {
-        return vcc_lo_flag[block];
+        return block->ssa_flag_values[VccLoSlot];
     }
     void SetDef(IR::Block* block, VccLoTag, const IR::Value& value) {
-        vcc_lo_flag.insert_or_assign(block, value);
+        block->ssa_flag_values[VccLoSlot] = value;
     }
 
     const IR::Value& Def(IR::Block* block, VccHiTag) {
-        return vcc_hi_flag[block];
+        return block->ssa_flag_values[VccHiSlot];
     }
     void SetDef(IR::Block* block, VccHiTag, const IR::Value& value) {
-        vcc_hi_flag.insert_or_assign(block, value);
+        block->ssa_flag_values[VccHiSlot] = value;
     }
 
     const IR::Value& Def(IR::Block* block, VccFlagTag) {
-        return vcc_flag[block];
+        return block->ssa_flag_values[VccSlot];
     }
     void SetDef(IR::Block* block, VccFlagTag, const IR::Value& value) {
-        vcc_flag.insert_or_assign(block, value);
+        block->ssa_flag_values[VccSlot] = value;
     }
     const IR::Value& Def(IR::Block* block, M0Tag) {
-        return m0_flag[block];
+        return block->ssa_flag_values[M0Slot];
     }
     void SetDef(IR::Block* block, M0Tag, const IR::Value& value) {
-        m0_flag.insert_or_assign(block, value);
+        block->ssa_flag_values[M0Slot] = value;
     }
 
+    // Goto variables are created on demand with dynamic indices, so they keep the
+    // map representation rather than an intrusive slot in the block.
     std::unordered_map<u32, ValueMap> goto_vars;
-    ValueMap scc_flag;
-    ValueMap exec_flag;
-    ValueMap vcc_flag;
-    ValueMap scc_lo_flag;
-    ValueMap vcc_lo_flag;
-    ValueMap vcc_hi_flag;
-    ValueMap m0_flag;
 };
 
 IR::Opcode UndefOpcode(IR::ScalarReg) noexcept {
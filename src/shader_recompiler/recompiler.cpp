@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
+#include "common/hash.h"
 #include "shader_recompiler/frontend/control_flow_graph.h"
 #include "shader_recompiler/frontend/decode.h"
 #include "shader_recompiler/frontend/structured_control_flow.h"
@@ -29,22 +32,30 @@ IR::BlockList GenerateBlocks(const IR::AbstractSyntaxList& syntax_list) {
 }
 
 IR::Program TranslateProgram(const std::span<const u32>& code, Pools& pools, Info& info,
-                             RuntimeInfo& runtime_info, const Profile& profile) {
+                             RuntimeInfo& runtime_info, const Profile& profile,
+                             TranslateTimes* times) {
+    const auto start = std::chrono::steady_clock::now();
     // Ensure first instruction is expected.
     constexpr u32 token_mov_vcchi = 0xBEEB03FF;
     if (code[0] != token_mov_vcchi) {
         LOG_DEBUG(Render_Recompiler, "First instruction is not s_mov_b32 vcc_hi, #imm");
     }
 
-    Gcn::GcnCodeSlice slice(code.data(), code.data() + code.size());
-    Gcn::GcnDecodeContext decoder;
-
-    // Decode and save instructions
+    // Decode and save instructions. Decoded lists are cached by a hash of the raw
+    // instruction words, so recompiles of the same bytecode for another specialization
+    // permutation, or of a duplicate shader body mapped elsewhere, skip the decoder.
     IR::Program program{info};
-    program.ins_list.reserve(code.size());
-    while (!slice.atEnd()) {
-        program.ins_list.emplace_back(decoder.decodeInstruction(slice));
+    const u64 code_hash = XXH3_64bits(code.data(), code.size_bytes());
+    const auto [it, is_new] = pools.decode_cache.try_emplace(code_hash);
+    if (is_new) {
+        Gcn::GcnCodeSlice slice(code.data(), code.data() + code.size());
+        Gcn::GcnDecodeContext decoder;
+        it->second.reserve(code.size());
+        while (!slice.atEnd()) {
+            it->second.emplace_back(decoder.decodeInstruction(slice));
+        }
     }
+    program.ins_list = it->second;
 
     // Clear any previous pooled data.
     pools.ReleaseContents();
@@ -63,32 +74,68 @@ IR::Program TranslateProgram(const std::span<const u32>& code, Pools& pools, Inf
     // it with expensive discard in PS.
     Shader::InjectClipDistanceAttributes(program, runtime_info);
 
-    // Run optimization passes
+    const auto frontend_done = std::chrono::steady_clock::now();
+
+    using FloatMs = std::chrono::duration<float, std::milli>;
+
+    // Run optimization passes. When the caller collects telemetry, each pass is timed and
+    // the instruction count delta recorded; the devtools compile profiler displays them.
+    const auto num_insts = [&] {
+        size_t count{};
+        for (const IR::Block* const block : program.blocks) {
+            count += block->Instructions().size();
+        }
+        return count;
+    };
+    const auto run_pass = [&](const char* name, auto&& pass) {
+        if (!times) {
+            pass();
+            return;
+        }
+        const auto before = std::chrono::steady_clock::now();
+        const size_t insts_before = num_insts();
+        pass();
+        const auto after = std::chrono::steady_clock::now();
+        times->passes.push_back({
+            .name = name,
+            .time_ms = FloatMs(after - before).count(),
+            .inst_delta = static_cast<s32>(num_insts()) - static_cast<s32>(insts_before),
+        });
+    };
+    using namespace Shader::Optimization;
     if (!profile.support_float64) {
-        Shader::Optimization::LowerFp64ToFp32(program);
+        run_pass("LowerFp64ToFp32", [&] { LowerFp64ToFp32(program); });
     }
-    Shader::Optimization::SsaRewritePass(program.post_order_blocks);
-    Shader::Optimization::ConstantPropagationPass(program.post_order_blocks);
-    Shader::Optimization::IdentityRemovalPass(program.blocks);
+    run_pass("SsaRewrite", [&] { SsaRewritePass(program.post_order_blocks); });
+    run_pass("ConstantPropagation", [&] { ConstantPropagationPass(program.post_order_blocks); });
+    run_pass("IdentityRemoval", [&] { IdentityRemovalPass(program.blocks); });
     if (info.l_stage == LogicalStage::TessellationControl) {
-        Shader::Optimization::TessellationPreprocess(program, runtime_info);
-        Shader::Optimization::HullShaderTransform(program, runtime_info);
+        run_pass("TessellationPreprocess", [&] { TessellationPreprocess(program, runtime_info); });
+        run_pass("HullShaderTransform", [&] { HullShaderTransform(program, runtime_info); });
     } else if (info.l_stage == LogicalStage::TessellationEval) {
-        Shader::Optimization::TessellationPreprocess(program, runtime_info);
-        Shader::Optimization::DomainShaderTransform(program, runtime_info);
+        run_pass("TessellationPreprocess", [&] { TessellationPreprocess(program, runtime_info); });
+        run_pass("DomainShaderTransform", [&] { DomainShaderTransform(program, runtime_info); });
+    }
+    run_pass("RingAccessElimination", [&] { RingAccessElimination(program, runtime_info); });
+    run_pass("ReadLaneElimination", [&] { ReadLaneEliminationPass(program); });
+    run_pass("FlattenExtendedUserdata", [&] { FlattenExtendedUserdataPass(program); });
+    run_pass("ResourceTracking", [&] { ResourceTrackingPass(program); });
+    run_pass("LowerBufferFormatToRaw", [&] { LowerBufferFormatToRaw(program); });
+    run_pass("SharedMemorySimplify", [&] { SharedMemorySimplifyPass(program, profile); });
+    run_pass("SharedMemoryToStorage",
+             [&] { SharedMemoryToStoragePass(program, runtime_info, profile); });
+    run_pass("SharedMemoryBarrier",
+             [&] { SharedMemoryBarrierPass(program, runtime_info, profile); });
+    run_pass("IdentityRemoval", [&] { IdentityRemovalPass(program.blocks); });
+    run_pass("DeadCodeElimination", [&] { DeadCodeEliminationPass(program); });
+    run_pass("ConstantPropagation", [&] { ConstantPropagationPass(program.post_order_blocks); });
+    run_pass("CollectShaderInfo", [&] { CollectShaderInfoPass(program, profile); });
+
+    if (times) {
+        const auto passes_done = std::chrono::steady_clock::now();
+        times->frontend_ms = FloatMs(frontend_done - start).count();
+        times->passes_ms = FloatMs(passes_done - frontend_done).count();
     }
-    Shader::Optimization::RingAccessElimination(program, runtime_info);
-    Shader::Optimization::ReadLaneEliminationPass(program);
-    Shader::Optimization::FlattenExtendedUserdataPass(program);
-    Shader::Optimization::ResourceTrackingPass(program);
-    Shader::Optimization::LowerBufferFormatToRaw(program);
-    Shader::Optimization::SharedMemorySimplifyPass(program, profile);
-    Shader::Optimization::SharedMemoryToStoragePass(program, runtime_info, profile);
-    Shader::Optimization::SharedMemoryBarrierPass(program, runtime_info, profile);
-    Shader::Optimization::IdentityRemovalPass(program.blocks);
-    Shader::Optimization::DeadCodeEliminationPass(program);
-    Shader::Optimization::ConstantPropagationPass(program.post_order_blocks);
-    Shader::Optimization::CollectShaderInfoPass(program, profile);
 
     Shader::IR::DumpProgram(program, info);
 
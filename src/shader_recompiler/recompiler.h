@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <unordered_map>
+
+#include <boost/container/static_vector.hpp>
+
 #include "common/object_pool.h"
 #include "shader_recompiler/ir/basic_block.h"
 #include "shader_recompiler/ir/program.h"
@@ -19,6 +23,14 @@ struct Pools {
     Common::ObjectPool<IR::Inst> inst_pool;
     Common::ObjectPool<IR::Block> block_pool;
 
+    /// Decoded instruction lists keyed by a hash of the raw GCN instruction words.
+    /// Decoding is a pure function of the bytes, so entries are shared across
+    /// specialization permutations and across duplicate shader bodies that only differ
+    /// in their headers. The structured IR cannot be cached the same way: the passes
+    /// specialize it in place against Info/RuntimeInfo and its pooled storage is
+    /// released on every translation, hence this survives ReleaseContents().
+    std::unordered_map<u64, std::vector<Gcn::GcnInst>> decode_cache;
+
     explicit Pools() : inst_pool{InstPoolSize}, block_pool{BlockPoolSize} {}
 
     void ReleaseContents() {
@@ -27,8 +39,24 @@ struct Pools {
     }
 };
 
+/// Time spent in the translation phases, filled when the caller collects telemetry.
+struct TranslateTimes {
+    /// Measured impact of one optimization pass run.
+    struct Pass {
+        const char* name;
+        float time_ms;
+        s32 inst_delta; ///< Instruction count change; negative when the pass shrank the IR
+    };
+    static constexpr size_t MaxPasses = 24;
+
+    float frontend_ms; ///< Decode, CFG construction and structurization
+    float passes_ms;   ///< IR optimization passes
+    boost::container::static_vector<Pass, MaxPasses> passes;
+};
+
 [[nodiscard]] IR::Program TranslateProgram(const std::span<const u32>& code, Pools& pools,
                                            Info& info, RuntimeInfo& runtime_info,
-                                           const Profile& profile);
+                                           const Profile& profile,
+                                           TranslateTimes* times = nullptr);
 
 } // namespace Shader
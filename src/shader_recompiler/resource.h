@@ -36,6 +36,10 @@ struct BufferResource {
     u8 instance_attrib{};
     bool is_written{};
     bool is_formatted{};
+    /// Set when address lowering materialized the sharp's stride as an immediate.
+    /// Buffers accessed only without an index term never bake the stride (the
+    /// multiply folds away), so specialization need not key on it for them.
+    bool stride_baked{};
 
     bool IsSpecial() const noexcept {
         return buffer_type != BufferType::Guest;
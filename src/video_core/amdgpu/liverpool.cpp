@@ -1,18 +1,23 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <bit>
+#include <chrono>
 #include <boost/preprocessor/stringize.hpp>
 
 #include "common/assert.h"
 #include "common/config.h"
 #include "common/debug.h"
+#include "common/trace_profiler.h"
 #include "common/polyfill_thread.h"
+#include "common/spin_lock.h"
 #include "common/thread.h"
 #include "core/debug_state.h"
 #include "core/libraries/kernel/process.h"
 #include "core/libraries/videoout/driver.h"
 #include "core/memory.h"
 #include "video_core/amdgpu/fence_detector.h"
+#include "video_core/amdgpu/prefetch_detector.h"
 #include "core/platform.h"
 #include "video_core/amdgpu/liverpool.h"
 #include "video_core/amdgpu/pm4_cmds.h"
@@ -52,6 +57,50 @@ static const char* acb_task_name[] = NAME_ARRAY(ACB_TASK, MAX_NAMES);
 
 std::array<u8, 48_KB> Liverpool::ConstantEngine::constants_heap;
 
+namespace {
+
+// Free lists for recycled coroutine frames, one per observed frame size. Frames are
+// created on submitting guest threads and destroyed on the GPU thread, hence the lock.
+// The pool never returns memory to the allocator; its footprint is bounded by the peak
+// number of in-flight submits.
+struct TaskFrameBucket {
+    size_t size{};
+    void* head{};
+};
+std::array<TaskFrameBucket, 4> task_frame_buckets{};
+Common::SpinLock task_frame_lock{};
+
+} // Anonymous namespace
+
+void* Liverpool::AllocateTaskFrame(size_t size) {
+    task_frame_lock.lock();
+    for (auto& bucket : task_frame_buckets) {
+        if (bucket.size == size && bucket.head) {
+            void* const frame = bucket.head;
+            bucket.head = *static_cast<void**>(frame);
+            task_frame_lock.unlock();
+            return frame;
+        }
+    }
+    task_frame_lock.unlock();
+    return ::operator new(size);
+}
+
+void Liverpool::FreeTaskFrame(void* ptr, size_t size) {
+    task_frame_lock.lock();
+    for (auto& bucket : task_frame_buckets) {
+        if (bucket.size == size || bucket.size == 0) {
+            bucket.size = size;
+            *static_cast<void**>(ptr) = bucket.head;
+            bucket.head = ptr;
+            task_frame_lock.unlock();
+            return;
+        }
+    }
+    task_frame_lock.unlock();
+    ::operator delete(ptr);
+}
+
 static std::span<const u32> NextPacket(std::span<const u32> span, size_t offset) {
     if (offset > span.size()) {
         LOG_ERROR(
@@ -66,6 +115,19 @@ static std::span<const u32> NextPacket(std::span<const u32> span, size_t offset)
     return span.subspan(offset);
 }
 
+// Copies a SET_*_REG payload over the shadow register state, returning true when any word
+// actually changed. Accumulating the diff while copying makes one pass over the payload
+// where memcmp followed by memcpy made two; the plain word loop vectorizes on its own.
+static bool CopyRegsIfChanged(u32* dst, const u32* src, size_t set_size) {
+    u32 changed = 0;
+    const size_t num_words = set_size / sizeof(u32);
+    for (size_t i = 0; i < num_words; ++i) {
+        changed |= dst[i] ^ src[i];
+        dst[i] = src[i];
+    }
+    return changed != 0;
+}
+
 Liverpool::Liverpool() {
     num_counter_pairs = Libraries::Kernel::sceKernelIsNeoMode() ? 16 : 8;
     process_thread = std::jthread{std::bind_front(&Liverpool::Process, this)};
@@ -92,6 +154,10 @@ void Liverpool::ProcessCommands() {
 
 void Liverpool::Process(std::stop_token stoken) {
     Common::SetCurrentThreadName("shadPS4:GpuCommandProcessor");
+    // Guest threads run at default priority; elevate command processing so an all-core
+    // guest load cannot preempt it mid-frame.
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
+    Common::SetCurrentThreadAffinity(Config::gpuThreadAffinityMask());
     gpu_id = std::this_thread::get_id();
 
     while (!stoken.stop_requested()) {
@@ -111,29 +177,50 @@ void Liverpool::Process(std::stop_token stoken) {
         while (num_submits || num_commands) {
             ProcessCommands();
 
-            curr_qid = (curr_qid + 1) % num_mapped_queues;
+            // Resume one round over the rings that actually have work queued. With every
+            // compute pipe mapped a plain round-robin would lock and skip dozens of empty
+            // queues between each resumption.
+            const u64 pending = pending_queues.load(std::memory_order_acquire);
+            for (u64 mask = pending; mask != 0; mask &= mask - 1) {
+                ProcessCommands();
+
+                curr_qid = std::countr_zero(mask);
+
+                auto& queue = mapped_queues[curr_qid];
+
+                // Drain every submit already queued on this ring before moving to the next
+                // one. Titles that batch many small dcbs otherwise pay a full round over
+                // the pending mask per submit; a task that yields (i.e. blocks on another
+                // ring) still hands control over immediately.
+                while (true) {
+                    Task::Handle task{};
+                    {
+                        std::scoped_lock lock{queue.m_access};
+                        if (queue.submits.empty()) {
+                            break;
+                        }
+                        task = queue.submits.front();
+                    }
+                    task.resume();
 
-            auto& queue = mapped_queues[curr_qid];
+                    if (!task.done()) {
+                        break;
+                    }
+                    task.destroy();
+
+                    {
+                        std::scoped_lock lock{queue.m_access};
+                        queue.submits.pop();
+                        if (queue.submits.empty()) {
+                            pending_queues.fetch_and(~(1ULL << curr_qid),
+                                                     std::memory_order_release);
+                        }
+                    }
 
-            Task::Handle task{};
-            {
-                std::scoped_lock lock{queue.m_access};
-                if (queue.submits.empty()) {
-                    continue;
+                    --num_submits;
+                    std::scoped_lock lock2{submit_mutex};
+                    submit_cv.notify_all();
                 }
-                task = queue.submits.front();
-            }
-            task.resume();
-
-            if (task.done()) {
-                task.destroy();
-
-                std::scoped_lock lock{queue.m_access};
-                queue.submits.pop();
-
-                --num_submits;
-                std::scoped_lock lock2{submit_mutex};
-                submit_cv.notify_all();
             }
         }
 
@@ -216,8 +303,105 @@ Liverpool::Task Liverpool::ProcessCeUpdate(std::span<const u32> ccb) {
     FIBER_EXIT;
 }
 
+void Liverpool::SetContextRegFromPacket(const PM4Header* header) {
+    const u32 count = header->type3.NumWords();
+    const auto* set_data = reinterpret_cast<const PM4CmdSetData*>(header);
+    const auto reg_addr = Regs::ContextRegWordOffset + set_data->reg_offset;
+    const auto* payload = reinterpret_cast<const u32*>(header + 2);
+    const auto set_size = (count - 1) * sizeof(u32);
+
+    // Diffing while copying keeps redundant SET bursts from dirtying the
+    // draw state, which lets the pipeline cache reuse its previous key.
+    if (CopyRegsIfChanged(&regs.reg_array[reg_addr], payload, set_size)) {
+        gfx_state_dirty = true;
+    }
+
+    // In the case of HW, render target memory has alignment as color block operates on
+    // tiles. There is no information of actual resource extents stored in CB context
+    // regs, so any deduction of it from slices/pitch will lead to a larger surface
+    // created. The same applies to the depth targets. Fortunately, the guest always
+    // sends a trailing NOP packet right after the context regs setup, so we can use the
+    // heuristic below and extract the hint to determine actual resource dims.
+
+    switch (reg_addr) {
+    case ContextRegs::CbColor0Base:
+    case ContextRegs::CbColor1Base:
+    case ContextRegs::CbColor2Base:
+    case ContextRegs::CbColor3Base:
+    case ContextRegs::CbColor4Base:
+    case ContextRegs::CbColor5Base:
+    case ContextRegs::CbColor6Base:
+    case ContextRegs::CbColor7Base: {
+        const auto col_buf_id = (reg_addr - ContextRegs::CbColor0Base) /
+                                (ContextRegs::CbColor1Base - ContextRegs::CbColor0Base);
+        ASSERT(col_buf_id < NUM_COLOR_BUFFERS);
+
+        const auto nop_offset = header->type3.count;
+        if (nop_offset == 0x0e || nop_offset == 0x0d || nop_offset == 0x0b) {
+            ASSERT_MSG(payload[nop_offset] == 0xc0001000,
+                       "NOP hint is missing in CB setup sequence");
+            last_cb_extent[col_buf_id].raw = payload[nop_offset + 1];
+        } else {
+            last_cb_extent[col_buf_id].raw = 0;
+        }
+        break;
+    }
+    case ContextRegs::CbColor0Cmask:
+    case ContextRegs::CbColor1Cmask:
+    case ContextRegs::CbColor2Cmask:
+    case ContextRegs::CbColor3Cmask:
+    case ContextRegs::CbColor4Cmask:
+    case ContextRegs::CbColor5Cmask:
+    case ContextRegs::CbColor6Cmask:
+    case ContextRegs::CbColor7Cmask: {
+        const auto col_buf_id = (reg_addr - ContextRegs::CbColor0Cmask) /
+                                (ContextRegs::CbColor1Cmask - ContextRegs::CbColor0Cmask);
+        ASSERT(col_buf_id < NUM_COLOR_BUFFERS);
+
+        const auto nop_offset = header->type3.count;
+        if (nop_offset == 0x04) {
+            ASSERT_MSG(payload[nop_offset] == 0xc0001000,
+                       "NOP hint is missing in CB setup sequence");
+            last_cb_extent[col_buf_id].raw = payload[nop_offset + 1];
+        }
+        break;
+    }
+    case ContextRegs::DbZInfo: {
+        if (header->type3.count == 8) {
+            ASSERT_MSG(payload[20] == 0xc0001000, "NOP hint is missing in DB setup sequence");
+            last_db_extent.raw = payload[21];
+        } else {
+            last_db_extent.raw = 0;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void Liverpool::SetShRegFromPacket(const PM4Header* header) {
+    const u32 count = header->type3.NumWords();
+    const auto* set_data = reinterpret_cast<const PM4CmdSetData*>(header);
+    const auto set_size = (count - 1) * sizeof(u32);
+
+    if (set_data->reg_offset >= 0x200 &&
+        set_data->reg_offset <= (0x200 + sizeof(ComputeProgram) / 4)) {
+        ASSERT(set_size <= sizeof(ComputeProgram));
+        auto* addr = reinterpret_cast<u32*>(&mapped_queues[GfxQueueId].cs_state) +
+                     (set_data->reg_offset - 0x200);
+        std::memcpy(addr, header + 2, set_size);
+    } else {
+        auto* addr = &regs.reg_array[Regs::ShRegWordOffset + set_data->reg_offset];
+        if (CopyRegsIfChanged(addr, reinterpret_cast<const u32*>(header + 2), set_size)) {
+            gfx_state_dirty = true;
+        }
+    }
+}
+
 Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<const u32> ccb) {
     FIBER_ENTER(dcb_task_name);
+    PROFILE_SCOPE("Liverpool::ProcessGraphics");
 
     cblock.Reset();
 
@@ -235,6 +419,13 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
 
     const auto fence_detector = FenceDetector(dcb);
 
+    // Resolve every index buffer the stream will reference before executing it, so their
+    // uploads land in one batch at the head of the submit instead of on the draw path.
+    if (rasterizer) {
+        const auto prefetch_detector = PrefetchDetector(dcb);
+        rasterizer->PrefetchBuffers(prefetch_detector.Ranges());
+    }
+
     const auto base_addr = reinterpret_cast<uintptr_t>(dcb.data());
     while (!dcb.empty()) {
         ProcessCommands();
@@ -307,110 +498,51 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
             }
             case PM4ItOpcode::ClearState: {
                 regs.SetDefaults();
+                gfx_state_dirty = true;
                 break;
             }
             case PM4ItOpcode::SetConfigReg: {
                 const auto* set_data = reinterpret_cast<const PM4CmdSetData*>(header);
                 const auto reg_addr = Regs::ConfigRegWordOffset + set_data->reg_offset;
                 const auto* payload = reinterpret_cast<const u32*>(header + 2);
-                std::memcpy(&regs.reg_array[reg_addr], payload, (count - 1) * sizeof(u32));
+                const auto set_size = (count - 1) * sizeof(u32);
+                if (CopyRegsIfChanged(&regs.reg_array[reg_addr], payload, set_size)) {
+                    gfx_state_dirty = true;
+                }
                 break;
             }
-            case PM4ItOpcode::SetContextReg: {
-                const auto* set_data = reinterpret_cast<const PM4CmdSetData*>(header);
-                const auto reg_addr = Regs::ContextRegWordOffset + set_data->reg_offset;
-                const auto* payload = reinterpret_cast<const u32*>(header + 2);
-
-                std::memcpy(&regs.reg_array[reg_addr], payload, (count - 1) * sizeof(u32));
-
-                // In the case of HW, render target memory has alignment as color block operates on
-                // tiles. There is no information of actual resource extents stored in CB context
-                // regs, so any deduction of it from slices/pitch will lead to a larger surface
-                // created. The same applies to the depth targets. Fortunately, the guest always
-                // sends a trailing NOP packet right after the context regs setup, so we can use the
-                // heuristic below and extract the hint to determine actual resource dims.
-
-                switch (reg_addr) {
-                case ContextRegs::CbColor0Base:
-                case ContextRegs::CbColor1Base:
-                case ContextRegs::CbColor2Base:
-                case ContextRegs::CbColor3Base:
-                case ContextRegs::CbColor4Base:
-                case ContextRegs::CbColor5Base:
-                case ContextRegs::CbColor6Base:
-                case ContextRegs::CbColor7Base: {
-                    const auto col_buf_id = (reg_addr - ContextRegs::CbColor0Base) /
-                                            (ContextRegs::CbColor1Base - ContextRegs::CbColor0Base);
-                    ASSERT(col_buf_id < NUM_COLOR_BUFFERS);
-
-                    const auto nop_offset = header->type3.count;
-                    if (nop_offset == 0x0e || nop_offset == 0x0d || nop_offset == 0x0b) {
-                        ASSERT_MSG(payload[nop_offset] == 0xc0001000,
-                                   "NOP hint is missing in CB setup sequence");
-                        last_cb_extent[col_buf_id].raw = payload[nop_offset + 1];
+            case PM4ItOpcode::SetContextReg:
+            case PM4ItOpcode::SetShReg: {
+                // Register writes arrive in long back-to-back bursts; consume the whole
+                // run here so each packet does not pay for the outer dispatch again.
+                while (true) {
+                    if (header->type3.opcode == PM4ItOpcode::SetContextReg) {
+                        SetContextRegFromPacket(header);
                     } else {
-                        last_cb_extent[col_buf_id].raw = 0;
+                        SetShRegFromPacket(header);
                     }
-                    break;
-                }
-                case ContextRegs::CbColor0Cmask:
-                case ContextRegs::CbColor1Cmask:
-                case ContextRegs::CbColor2Cmask:
-                case ContextRegs::CbColor3Cmask:
-                case ContextRegs::CbColor4Cmask:
-                case ContextRegs::CbColor5Cmask:
-                case ContextRegs::CbColor6Cmask:
-                case ContextRegs::CbColor7Cmask: {
-                    const auto col_buf_id =
-                        (reg_addr - ContextRegs::CbColor0Cmask) /
-                        (ContextRegs::CbColor1Cmask - ContextRegs::CbColor0Cmask);
-                    ASSERT(col_buf_id < NUM_COLOR_BUFFERS);
-
-                    const auto nop_offset = header->type3.count;
-                    if (nop_offset == 0x04) {
-                        ASSERT_MSG(payload[nop_offset] == 0xc0001000,
-                                   "NOP hint is missing in CB setup sequence");
-                        last_cb_extent[col_buf_id].raw = payload[nop_offset + 1];
+                    dcb = NextPacket(dcb, header->type3.NumWords() + 1);
+                    if (dcb.empty()) {
+                        break;
                     }
-                    break;
-                }
-                case ContextRegs::DbZInfo: {
-                    if (header->type3.count == 8) {
-                        ASSERT_MSG(payload[20] == 0xc0001000,
-                                   "NOP hint is missing in DB setup sequence");
-                        last_db_extent.raw = payload[21];
-                    } else {
-                        last_db_extent.raw = 0;
+                    const auto* next = reinterpret_cast<const PM4Header*>(dcb.data());
+                    if (next->type != 3 || (next->type3.opcode != PM4ItOpcode::SetContextReg &&
+                                            next->type3.opcode != PM4ItOpcode::SetShReg)) {
+                        break;
                     }
-                    break;
-                }
-                default:
-                    break;
+                    header = next;
                 }
-                break;
+                continue;
             }
-            case PM4ItOpcode::SetShReg: {
+            case PM4ItOpcode::SetUconfigReg: {
                 const auto* set_data = reinterpret_cast<const PM4CmdSetData*>(header);
+                auto* addr = &regs.reg_array[Regs::UconfigRegWordOffset + set_data->reg_offset];
                 const auto set_size = (count - 1) * sizeof(u32);
-
-                if (set_data->reg_offset >= 0x200 &&
-                    set_data->reg_offset <= (0x200 + sizeof(ComputeProgram) / 4)) {
-                    ASSERT(set_size <= sizeof(ComputeProgram));
-                    auto* addr = reinterpret_cast<u32*>(&mapped_queues[GfxQueueId].cs_state) +
-                                 (set_data->reg_offset - 0x200);
-                    std::memcpy(addr, header + 2, set_size);
-                } else {
-                    std::memcpy(&regs.reg_array[Regs::ShRegWordOffset + set_data->reg_offset],
-                                header + 2, set_size);
+                if (CopyRegsIfChanged(addr, reinterpret_cast<const u32*>(header + 2), set_size)) {
+                    gfx_state_dirty = true;
                 }
                 break;
             }
-            case PM4ItOpcode::SetUconfigReg: {
-                const auto* set_data = reinterpret_cast<const PM4CmdSetData*>(header);
-                std::memcpy(&regs.reg_array[Regs::UconfigRegWordOffset + set_data->reg_offset],
-                            header + 2, (count - 1) * sizeof(u32));
-                break;
-            }
             case PM4ItOpcode::SetPredication: {
                 LOG_DEBUG(Render, "Unimplemented IT_SET_PREDICATION");
                 break;
@@ -827,7 +959,17 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
                     vo_port->WaitVoLabel([&] { return wait_reg_mem->Test(regs.reg_array); });
                     break;
                 }
+                u32 spins = 0;
                 while (!wait_reg_mem->Test(regs.reg_array)) {
+                    // A wait heading the only pending ring would otherwise hot-spin the
+                    // processor thread until the label is written. Labels are stored by
+                    // guest threads with plain writes, so there is nothing to block on;
+                    // back off with short sleeps instead. New submits and commands are
+                    // re-checked on every resumption in between.
+                    if (++spins >= 128 && num_commands == 0 &&
+                        std::popcount(pending_queues.load(std::memory_order_relaxed)) == 1) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(10));
+                    }
                     YIELD_GFX();
                 }
                 break;
@@ -1080,8 +1222,12 @@ Liverpool::Task Liverpool::ProcessCompute(std::span<const u32> acb, u32 vqid) {
                              (set_data->reg_offset - 0x200);
                 std::memcpy(addr, header + 2, set_size);
             } else {
-                std::memcpy(&regs.reg_array[Regs::ShRegWordOffset + set_data->reg_offset],
-                            header + 2, set_size);
+                // These land in the shared graphics register file, so the draw-state fast
+                // path has to see them as a change like on the graphics ring.
+                if (CopyRegsIfChanged(&regs.reg_array[Regs::ShRegWordOffset + set_data->reg_offset],
+                                      reinterpret_cast<const u32*>(header + 2), set_size)) {
+                    gfx_state_dirty = true;
+                }
             }
             break;
         }
@@ -1174,7 +1320,14 @@ Liverpool::Task Liverpool::ProcessCompute(std::span<const u32> acb, u32 vqid) {
         case PM4ItOpcode::WaitRegMem: {
             const auto* wait_reg_mem = reinterpret_cast<const PM4CmdWaitRegMem*>(header);
             ASSERT(wait_reg_mem->engine.Value() == PM4CmdWaitRegMem::Engine::Me);
+            u32 spins = 0;
             while (!wait_reg_mem->Test(regs.reg_array)) {
+                // Same backoff as the graphics ring: without it a lone waiting compute
+                // ring keeps the processor thread spinning at full tilt.
+                if (++spins >= 128 && num_commands == 0 &&
+                    std::popcount(pending_queues.load(std::memory_order_relaxed)) == 1) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(10));
+                }
                 YIELD_ASC(vqid);
             }
             break;
@@ -1257,6 +1410,7 @@ void Liverpool::SubmitGfx(std::span<const u32> dcb, std::span<const u32> ccb) {
     {
         std::scoped_lock lock{queue.m_access};
         queue.submits.emplace(task.handle);
+        pending_queues.fetch_or(1ULL << GfxQueueId, std::memory_order_release);
     }
 
     std::scoped_lock lk{submit_mutex};
@@ -1273,6 +1427,7 @@ void Liverpool::SubmitAsc(u32 gnm_vqid, std::span<const u32> acb) {
     {
         std::scoped_lock lock{queue.m_access};
         queue.submits.emplace(task.handle);
+        pending_queues.fetch_or(1ULL << gnm_vqid, std::memory_order_release);
     }
 
     std::scoped_lock lk{submit_mutex};
@@ -13,6 +13,7 @@
 #include <vector>
 #include <queue>
 
+#include "common/adaptive_mutex.h"
 #include "common/assert.h"
 #include "common/slot_vector.h"
 #include "common/types.h"
@@ -30,6 +31,8 @@ struct VideoOutPort;
 
 namespace AmdGpu {
 
+union PM4Header;
+
 struct Liverpool {
     static constexpr u32 GfxQueueId = 0u;
     static constexpr u32 NumGfxRings = 1u;     // actually 2, but HP is reserved by system software
@@ -63,6 +66,13 @@ struct Liverpool {
     std::array<CbDbExtent, NUM_COLOR_BUFFERS> last_cb_extent{};
     CbDbExtent last_db_extent{};
 
+    /// Returns and clears the draw-state dirty flag. Register writes that change any
+    /// reg_array contents set it, so consumers can skip state rebuilds between draws
+    /// that did not touch registers.
+    bool AckGraphicsStateDirty() noexcept {
+        return std::exchange(gfx_state_dirty, false);
+    }
+
 public:
     explicit Liverpool();
     ~Liverpool();
@@ -144,8 +154,22 @@ public:
     Common::SlotVector<AscQueueInfo> asc_queues{};
 
 private:
+    // Recycles coroutine frames between submits. Frame sizes take one of a few distinct
+    // values (one per coroutine function), so a spin-locked per-size free list in the
+    // style of Common::SlabHeap suffices; see liverpool.cpp.
+    static void* AllocateTaskFrame(size_t size);
+    static void FreeTaskFrame(void* ptr, size_t size);
+
     struct Task {
         struct promise_type {
+            // Frames are allocated for every submit; recycle them instead of paying a
+            // global allocator round trip per dcb on submit-rate-heavy titles.
+            static void* operator new(size_t size) {
+                return AllocateTaskFrame(size);
+            }
+            static void operator delete(void* ptr, size_t size) {
+                FreeTaskFrame(ptr, size);
+            }
             auto get_return_object() {
                 Task task{};
                 task.handle = std::coroutine_handle<promise_type>::from_promise(*this);
@@ -186,6 +210,12 @@ private:
     void ProcessCommands();
     void Process(std::stop_token stoken);
 
+    // SET_CONTEXT_REG and SET_SH_REG dominate command heavy streams. Their handlers live
+    // outside the coroutine switch so the graphics processor can consume whole runs of
+    // them in a tight loop without bouncing through the per-packet dispatch.
+    void SetContextRegFromPacket(const PM4Header* header);
+    void SetShRegFromPacket(const PM4Header* header);
+
     struct GpuQueue {
         std::mutex m_access{};
         std::atomic<u32> dcb_buffer_offset;
@@ -225,12 +255,19 @@ private:
     std::jthread process_thread{};
     std::atomic<u32> num_submits{};
     std::atomic<u32> num_commands{};
+    // One bit per mapped queue with submits outstanding; bits are set/cleared under the
+    // owning queue's m_access lock, the processor loop reads the whole word at once.
+    std::atomic<u64> pending_queues{};
     std::atomic<bool> submit_done{};
-    std::mutex submit_mutex;
+    Common::AdaptiveSpinMutex submit_mutex{"Liverpool submit"};
     std::condition_variable_any submit_cv;
     std::queue<Common::UniqueFunction<void>> command_queue{};
     std::thread::id gpu_id;
     s32 curr_qid{-1};
+    // Set on any register write that actually changed reg_array contents; consumed by
+    // the pipeline cache to skip redundant graphics key rebuilds. Only ever touched on
+    // the GPU thread.
+    bool gfx_state_dirty{true};
 };
 
 } // namespace AmdGpu
@@ -338,10 +338,15 @@ enum class InterruptSelect : u32 {
 };
 
 static u64 GetGpuClock64() {
-    auto now = std::chrono::high_resolution_clock::now();
-    auto duration = now.time_since_epoch();
-    auto ticks = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
-    return static_cast<u64>(ticks);
+    // Guest timestamps tick in the GPU core clock domain (800MHz, or 911MHz in Neo mode),
+    // not host nanoseconds. Frame governors compute GPU time from deltas of these values,
+    // so returning an unscaled host clock makes the GPU look slower or faster than it is.
+    // Scale the TSC with a cached fixed-point factor the same way Common::NativeClock
+    // derives wall time, keeping fences monotonic and consistent with the perf counter.
+    static const u64 gpu_rdtsc_factor =
+        Common::GetFixedPoint64Factor(Libraries::GnmDriver::sceGnmGetGpuCoreClockFrequency(),
+                                      Libraries::Kernel::sceKernelGetTscFrequency());
+    return Common::MultiplyHigh(Libraries::Kernel::sceKernelReadTsc(), gpu_rdtsc_factor);
 }
 
 static u64 GetGpuPerfCounter() {
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/types.h"
+#include "video_core/amdgpu/pm4_cmds.h"
+
+namespace AmdGpu {
+
+/// Walks a command stream ahead of execution and collects the guest ranges of all index
+/// buffers referenced by it. Resolving them against the buffer cache before processing
+/// starts batches their uploads at the head of the submit instead of interleaving them
+/// with draws, where each one breaks rendering.
+class PrefetchDetector {
+public:
+    using Range = std::pair<VAddr, u32>;
+
+    explicit PrefetchDetector(std::span<const u32> cmd) {
+        DetectRanges(cmd);
+    }
+
+    std::span<const Range> Ranges() const {
+        return ranges;
+    }
+
+private:
+    static std::span<const u32> NextPacket(std::span<const u32> cmd, size_t offset) {
+        if (offset > cmd.size()) {
+            return {};
+        }
+        return cmd.subspan(offset);
+    }
+
+    void DetectRanges(std::span<const u32> cmd) {
+        // Until the stream sets an index type the element size from the previous submit
+        // is unknown, so draws before the first IT_INDEX_TYPE are not recorded.
+        u32 index_size = 0;
+        while (!cmd.empty()) {
+            const auto* header = reinterpret_cast<const PM4Header*>(cmd.data());
+            const u32 type = header->type;
+
+            switch (type) {
+            default:
+                UNREACHABLE_MSG("Wrong PM4 type {}", type);
+            case 0:
+                return;
+            case 2:
+                cmd = NextPacket(cmd, 1);
+                break;
+            case 3:
+                const PM4ItOpcode opcode = header->type3.opcode;
+                switch (opcode) {
+                case PM4ItOpcode::IndexType: {
+                    const auto* index_type = reinterpret_cast<const PM4CmdDrawIndexType*>(header);
+                    index_size = index_type->index_type == 0 ? sizeof(u16) : sizeof(u32);
+                    break;
+                }
+                case PM4ItOpcode::DrawIndex2: {
+                    const auto* draw_index = reinterpret_cast<const PM4CmdDrawIndex2*>(header);
+                    if (index_size == 0 || draw_index->index_count == 0) {
+                        break;
+                    }
+                    const VAddr base = (draw_index->index_base_lo & ~1U) |
+                                       (u64(draw_index->index_base_hi & 0xff) << 32);
+                    const Range range{base, draw_index->index_count * index_size};
+                    // Titles commonly re-issue the same buffer across consecutive draws.
+                    if (ranges.empty() || ranges.back() != range) {
+                        ranges.emplace_back(range);
+                    }
+                    break;
+                }
+                default:
+                    break;
+                }
+                cmd = NextPacket(cmd, header->type3.NumWords() + 1);
+                break;
+            }
+        }
+    }
+
+private:
+    boost::container::small_vector<Range, 32> ranges;
+};
+
+} // namespace AmdGpu
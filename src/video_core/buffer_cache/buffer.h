@@ -153,6 +153,7 @@ public:
     VAddr cpu_addr = 0;
     bool is_picked{};
     bool is_coherent{};
+    bool is_device_local{};
     bool is_deleted{};
     int stream_score = 0;
     size_t size_bytes = 0;
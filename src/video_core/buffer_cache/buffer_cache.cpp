@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <limits>
 #include "common/alignment.h"
 #include "common/debug.h"
+#include "common/trace_profiler.h"
 #include "common/scope_exit.h"
 #include "core/memory.h"
 #include "video_core/amdgpu/liverpool.h"
@@ -136,9 +138,11 @@ void BufferCache::DownloadBufferMemory(Buffer& buffer, VAddr device_addr, u64 si
         scheduler.EndRendering();
         const auto cmdbuf = scheduler.CommandBuffer();
         cmdbuf.copyBuffer(buffer.buffer, download_buffer.Handle(), copies);
-        const auto write_data = [&]() {
+        // Captured by value: the deferred form outlives this stack frame.
+        const auto write_data = [this, copies, buffer_addr = buffer.CpuAddr(), offset, download,
+                                 device_addr, size, is_write, memory] {
             for (const auto& copy : copies) {
-                const VAddr copy_device_addr = buffer.CpuAddr() + copy.srcOffset;
+                const VAddr copy_device_addr = buffer_addr + copy.srcOffset;
                 const u64 dst_offset = copy.dstOffset - offset;
                 memory->TryWriteBacking(std::bit_cast<u8*>(copy_device_addr), download + dst_offset,
                                         copy.size);
@@ -146,7 +150,11 @@ void BufferCache::DownloadBufferMemory(Buffer& buffer, VAddr device_addr, u64 si
             memory_tracker->UnmarkRegionAsGpuModified(device_addr, size, is_write);
         };
         if constexpr (async) {
-            scheduler.DeferOperation(write_data);
+            // The priority worker waits on the master semaphore and writes results back the
+            // moment the GPU signals the copy, instead of sitting in the pending queue until
+            // the GPU thread polls it. The memory tracker is internally locked, so the
+            // unmark is safe off-thread.
+            scheduler.DeferPriorityOperation(write_data);
         } else {
             scheduler.Finish();
             write_data();
@@ -264,10 +272,21 @@ void BufferCache::BindIndexBuffer(u32 index_offset) {
     const VAddr index_address =
         regs.index_base_address.Address<VAddr>() + index_offset * index_size;
 
-    // Bind index buffer.
+    // Bind index buffer. Prefer a cached buffer when one already covers the range; repeated
+    // draws of static geometry then reuse the resident copy, re-uploaded only when the
+    // memory tracker reports guest writes, instead of re-copying the indices through the
+    // stream ring on every draw.
     const u32 index_buffer_size = regs.num_indices * index_size;
-    const auto [vk_buffer, offset] = ObtainBuffer(index_address, index_buffer_size, false);
     const auto cmdbuf = scheduler.CommandBuffer();
+    if (const BufferId buffer_id = page_table[index_address >> CACHING_PAGEBITS]; buffer_id) {
+        if (Buffer& buffer = slot_buffers[buffer_id];
+            buffer.IsInBounds(index_address, index_buffer_size)) {
+            SynchronizeBuffer(buffer, index_address, index_buffer_size, false, false);
+            cmdbuf.bindIndexBuffer(buffer.Handle(), buffer.Offset(index_address), index_type);
+            return;
+        }
+    }
+    const auto [vk_buffer, offset] = ObtainBuffer(index_address, index_buffer_size, false);
     cmdbuf.bindIndexBuffer(vk_buffer->Handle(), offset, index_type);
 }
 
@@ -384,8 +403,14 @@ void BufferCache::CopyBuffer(VAddr dst, VAddr src, u32 num_bytes, bool dst_gds,
 
 std::pair<Buffer*, u32> BufferCache::ObtainBuffer(VAddr device_addr, u32 size, bool is_written,
                                                   bool is_texel_buffer, BufferId buffer_id) {
+    PROFILE_SCOPE("BufferCache::ObtainBuffer");
     // For read-only buffers use device local stream buffer to reduce renderpass breaks.
-    if (!is_written && size <= CACHING_PAGESIZE && !IsRegionGpuModified(device_addr, size)) {
+    // When the ring resides in host visible VRAM (UMA or resizable BAR), draws read the
+    // written bytes at device speed, so much larger per-frame uploads can skip the cached
+    // buffer and its staging round trip entirely.
+    const u64 stream_threshold =
+        stream_buffer.is_device_local ? DEVICE_LOCAL_STREAM_THRESHOLD : CACHING_PAGESIZE;
+    if (!is_written && size <= stream_threshold && !IsRegionGpuModified(device_addr, size)) {
         const u64 offset = stream_buffer.Copy(device_addr, size, instance.UniformMinAlignment());
         return {&stream_buffer, offset};
     }
@@ -539,49 +564,64 @@ BufferCache::OverlapResult BufferCache::ResolveOverlaps(VAddr device_addr, u32 w
     };
 }
 
-void BufferCache::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
-                              bool accumulate_stream_score) {
-    Buffer& new_buffer = slot_buffers[new_buffer_id];
-    Buffer& overlap = slot_buffers[overlap_id];
-    if (accumulate_stream_score) {
-        new_buffer.IncreaseStreamScore(overlap.StreamScore() + 1);
+void BufferCache::JoinOverlaps(BufferId new_buffer_id, std::span<const BufferId> overlap_ids,
+                               bool accumulate_stream_score) {
+    if (overlap_ids.empty()) {
+        return;
     }
-    const size_t dst_base_offset = overlap.CpuAddr() - new_buffer.CpuAddr();
-    const vk::BufferCopy copy = {
-        .srcOffset = 0,
-        .dstOffset = dst_base_offset,
-        .size = overlap.SizeBytes(),
-    };
-    scheduler.EndRendering();
-    const auto cmdbuf = scheduler.CommandBuffer();
+    Buffer& new_buffer = slot_buffers[new_buffer_id];
 
-    boost::container::static_vector<vk::BufferMemoryBarrier2, 2> pre_barriers{};
-    if (auto src_barrier = overlap.GetBarrier(vk::AccessFlagBits2::eTransferRead,
-                                              vk::PipelineStageFlagBits2::eTransfer)) {
-        pre_barriers.push_back(*src_barrier);
+    // Merge all overlaps with a single renderpass break and one barrier batch on each side
+    // of the copies, instead of paying them once per joined buffer.
+    boost::container::small_vector<vk::BufferCopy, 8> copies{};
+    boost::container::small_vector<vk::BufferMemoryBarrier2, 8> pre_barriers{};
+    size_t min_dst_offset = std::numeric_limits<size_t>::max();
+    for (const BufferId overlap_id : overlap_ids) {
+        Buffer& overlap = slot_buffers[overlap_id];
+        if (accumulate_stream_score) {
+            new_buffer.IncreaseStreamScore(overlap.StreamScore() + 1);
+        }
+        const size_t dst_base_offset = overlap.CpuAddr() - new_buffer.CpuAddr();
+        min_dst_offset = std::min(min_dst_offset, dst_base_offset);
+        copies.push_back(vk::BufferCopy{
+            .srcOffset = 0,
+            .dstOffset = dst_base_offset,
+            .size = overlap.SizeBytes(),
+        });
+        if (auto src_barrier = overlap.GetBarrier(vk::AccessFlagBits2::eTransferRead,
+                                                  vk::PipelineStageFlagBits2::eTransfer)) {
+            pre_barriers.push_back(*src_barrier);
+        }
     }
     if (auto dst_barrier =
             new_buffer.GetBarrier(vk::AccessFlagBits2::eTransferWrite,
-                                  vk::PipelineStageFlagBits2::eTransfer, dst_base_offset)) {
+                                  vk::PipelineStageFlagBits2::eTransfer, min_dst_offset)) {
         pre_barriers.push_back(*dst_barrier);
     }
+    scheduler.EndRendering();
+    const auto cmdbuf = scheduler.CommandBuffer();
     cmdbuf.pipelineBarrier2(vk::DependencyInfo{
         .dependencyFlags = vk::DependencyFlagBits::eByRegion,
         .bufferMemoryBarrierCount = static_cast<u32>(pre_barriers.size()),
         .pBufferMemoryBarriers = pre_barriers.data(),
     });
 
-    cmdbuf.copyBuffer(overlap.Handle(), new_buffer.Handle(), copy);
+    for (size_t i = 0; i < overlap_ids.size(); ++i) {
+        cmdbuf.copyBuffer(slot_buffers[overlap_ids[i]].Handle(), new_buffer.Handle(), copies[i]);
+    }
 
-    boost::container::static_vector<vk::BufferMemoryBarrier2, 2> post_barriers{};
-    if (auto src_barrier =
-            overlap.GetBarrier(vk::AccessFlagBits2::eMemoryRead | vk::AccessFlagBits2::eMemoryWrite,
-                               vk::PipelineStageFlagBits2::eAllCommands)) {
-        post_barriers.push_back(*src_barrier);
+    boost::container::small_vector<vk::BufferMemoryBarrier2, 8> post_barriers{};
+    for (const BufferId overlap_id : overlap_ids) {
+        Buffer& overlap = slot_buffers[overlap_id];
+        if (auto src_barrier = overlap.GetBarrier(vk::AccessFlagBits2::eMemoryRead |
+                                                      vk::AccessFlagBits2::eMemoryWrite,
+                                                  vk::PipelineStageFlagBits2::eAllCommands)) {
+            post_barriers.push_back(*src_barrier);
+        }
     }
     if (auto dst_barrier = new_buffer.GetBarrier(
             vk::AccessFlagBits2::eMemoryRead | vk::AccessFlagBits2::eMemoryWrite,
-            vk::PipelineStageFlagBits2::eAllCommands, dst_base_offset)) {
+            vk::PipelineStageFlagBits2::eAllCommands, min_dst_offset)) {
         post_barriers.push_back(*dst_barrier);
     }
     cmdbuf.pipelineBarrier2(vk::DependencyInfo{
@@ -589,7 +629,9 @@ void BufferCache::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
         .bufferMemoryBarrierCount = static_cast<u32>(post_barriers.size()),
         .pBufferMemoryBarriers = post_barriers.data(),
     });
-    DeleteBuffer(overlap_id);
+    for (const BufferId overlap_id : overlap_ids) {
+        DeleteBuffer(overlap_id);
+    }
 }
 
 BufferId BufferCache::CreateBuffer(VAddr device_addr, u32 wanted_size) {
@@ -601,10 +643,7 @@ BufferId BufferCache::CreateBuffer(VAddr device_addr, u32 wanted_size) {
     const BufferId new_buffer_id =
         slot_buffers.insert(instance, scheduler, MemoryUsage::DeviceLocal, overlap.begin,
                             AllFlags | vk::BufferUsageFlagBits::eShaderDeviceAddress, size);
-    auto& new_buffer = slot_buffers[new_buffer_id];
-    for (const BufferId overlap_id : overlap.ids) {
-        JoinOverlap(new_buffer_id, overlap_id, !overlap.has_stream_leap);
-    }
+    JoinOverlaps(new_buffer_id, overlap.ids, !overlap.has_stream_leap);
     Register(new_buffer_id);
     return new_buffer_id;
 }
@@ -646,13 +685,7 @@ void BufferCache::ChangeRegister(BufferId buffer_id) {
     const u64 page_begin = device_addr_begin / CACHING_PAGESIZE;
     const u64 page_end = Common::DivCeil(device_addr_end, CACHING_PAGESIZE);
     const u64 size_pages = page_end - page_begin;
-    for (u64 page = page_begin; page != page_end; ++page) {
-        if constexpr (insert) {
-            page_table[page] = buffer_id;
-        } else {
-            page_table[page]= BufferId{};
-        }
-    }
+    page_table.SetRange(page_begin, size_pages, insert ? buffer_id : BufferId{});
     if constexpr (insert) {
         total_used_memory += Common::AlignUp(size, CACHING_PAGESIZE);
         buffer.SetLRUId(lru_cache.Insert(buffer_id, gc_tick));
@@ -836,7 +869,7 @@ void BufferCache::CommitPendingGpuRanges() {
         });
         SynchronizeBuffersInRange(begin, end - begin, true);
     });
-    gpu_modified_ranges.m_ranges_set += gpu_modified_ranges_pending.m_ranges_set;
+    gpu_modified_ranges.Merge(gpu_modified_ranges_pending);
     gpu_modified_ranges_pending.Clear();
     if (!preemptive_copies.empty()) {
         const u64 done_tick = scheduler.CurrentTick();
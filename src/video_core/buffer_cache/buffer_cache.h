@@ -41,6 +41,8 @@ public:
     static constexpr u32 CACHING_PAGEBITS = 13;
     static constexpr u64 CACHING_PAGESIZE = u64{1} << CACHING_PAGEBITS;
     static constexpr u64 DEVICE_PAGESIZE = 16_KB;
+    // Stream upload cap when the ring landed in host visible VRAM (UMA or resizable BAR).
+    static constexpr u64 DEVICE_LOCAL_STREAM_THRESHOLD = 256_KB;
     static constexpr u64 CACHING_NUMPAGES = u64{1} << (40 - CACHING_PAGEBITS);
     static constexpr u64 BDA_PAGETABLE_SIZE = CACHING_NUMPAGES * sizeof(vk::DeviceAddress);
 
@@ -182,7 +184,8 @@ private:
 
     [[nodiscard]] OverlapResult ResolveOverlaps(VAddr device_addr, u32 wanted_size);
 
-    void JoinOverlap(BufferId new_buffer_id, BufferId overlap_id, bool accumulate_stream_score);
+    void JoinOverlaps(BufferId new_buffer_id, std::span<const BufferId> overlap_ids,
+                      bool accumulate_stream_score);
 
     BufferId CreateBuffer(VAddr device_addr, u32 wanted_size);
 
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <span>
 #include "common/div_ceil.h"
 #include "video_core/buffer_cache/buffer_cache.h"
 #include "video_core/buffer_cache/fault_manager.h"
@@ -156,11 +158,21 @@ void FaultManager::ProcessFaultBuffer() {
 
     scheduler.DeferOperation([this, mapped, area = current_area] {
         fault_ranges.Clear();
-        const u64* fault_buf = std::bit_cast<const u64*>(mapped);
-        const u32 fault_count = fault_buf[0];
-        for (u32 i = 1; i <= fault_count; ++i) {
-            fault_ranges.Add(fault_buf[i], caching_pagesize);
-            LOG_INFO(Render_Vulkan, "Accessed non-GPU cached memory at {:#x}", fault_buf[i]);
+        u64* fault_buf = std::bit_cast<u64*>(mapped);
+        const u32 fault_count = std::min<u32>(static_cast<u32>(fault_buf[0]), MaxPageFaults);
+        // The parser appends page addresses atomically, so they arrive unordered. Sort and
+        // merge adjacent pages into runs first; the range set then takes one insert per run
+        // instead of one per faulted page.
+        const std::span<u64> pages{fault_buf + 1, fault_count};
+        std::sort(pages.begin(), pages.end());
+        for (size_t i = 0; i < pages.size();) {
+            const VAddr start = pages[i];
+            VAddr end = start + caching_pagesize;
+            while (++i < pages.size() && pages[i] == end) {
+                end += caching_pagesize;
+            }
+            fault_ranges.Add(start, end - start);
+            LOG_DEBUG(Render_Vulkan, "Accessed non-GPU cached memory at {:#x}-{:#x}", start, end);
         }
         fault_ranges.ForEach([&](VAddr start, VAddr end) {
             ASSERT_MSG((end - start) <= std::numeric_limits<u32>::max(),
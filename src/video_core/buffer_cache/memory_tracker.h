@@ -31,8 +31,7 @@ public:
     bool IsRegionCpuModified(VAddr query_cpu_addr, u64 query_size) noexcept {
         return IteratePages<true>(
             query_cpu_addr, query_size, [](RegionManager* manager, u64 offset, size_t size) {
-                std::scoped_lock lk{manager->lock};
-                return manager->template IsRegionModified<Type::CPU>(offset, size);
+                return QueryRegion<Type::CPU>(manager, offset, size);
             });
     }
 
@@ -40,8 +39,7 @@ public:
     bool IsRegionGpuModified(VAddr query_cpu_addr, u64 query_size) noexcept {
         return IteratePages<false>(
             query_cpu_addr, query_size, [](RegionManager* manager, u64 offset, size_t size) {
-                std::scoped_lock lk{manager->lock};
-                return manager->template IsRegionModified<Type::GPU>(offset, size);
+                return QueryRegion<Type::GPU>(manager, offset, size);
             });
     }
 
@@ -143,6 +141,20 @@ public:
     }
 
 private:
+    /// Optimistic modification query; the region bitsets are plain words, so a read torn by a
+    /// concurrent state change fails sequence validation and is retried without ever taking
+    /// the region lock.
+    template <Type type>
+    static bool QueryRegion(RegionManager* manager, u64 offset, size_t size) noexcept {
+        while (true) {
+            const u32 token = manager->lock.BeginOptimisticRead();
+            const bool modified = manager->template IsRegionModified<type>(offset, size);
+            if (manager->lock.ValidateOptimisticRead(token)) {
+                return modified;
+            }
+        }
+    }
+
     /**
      * @brief IteratePages Iterates L2 word manager page table.
      * @param cpu_address Start byte cpu address
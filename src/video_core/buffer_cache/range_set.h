@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <boost/container/small_vector.hpp>
 #include <boost/icl/discrete_interval.hpp>
 #include <boost/icl/interval_map.hpp>
 #include <boost/icl/split_interval_map.hpp>
@@ -19,80 +21,133 @@ using RangeSetsAllocator =
     boost::fast_pool_allocator<T, boost::default_user_allocator_new_delete,
                                boost::details::pool::default_mutex, 1024, 2048>;
 
+/**
+ * Ordered set of disjoint address ranges kept coalesced in a flat sorted vector. Short sets
+ * live in inline storage, so the hot invalidation paths neither chase interval-tree nodes nor
+ * hit the allocator; all queries are a binary search plus a contiguous walk.
+ */
 struct RangeSet {
-    using IntervalSet =
-        boost::icl::interval_set<VAddr, std::less,
-                                 ICL_INTERVAL_INSTANCE(ICL_INTERVAL_DEFAULT, VAddr, std::less),
-                                 RangeSetsAllocator>;
-    using IntervalType = typename IntervalSet::interval_type;
+    struct Range {
+        VAddr lower;
+        VAddr upper;
+    };
+    static constexpr size_t NumInlineRanges = 16;
+    using Storage = boost::container::small_vector<Range, NumInlineRanges>;
 
     explicit RangeSet() = default;
     ~RangeSet() = default;
 
     void Add(VAddr base_address, size_t size) {
         const VAddr end_address = base_address + size;
-        IntervalType interval{base_address, end_address};
-        m_ranges_set.add(interval);
+        // First range that ends at or after the new lower bound; everything before it
+        // cannot touch the inserted range.
+        auto it = std::lower_bound(
+            m_ranges.begin(), m_ranges.end(), base_address,
+            [](const Range& range, VAddr addr) { return range.upper < addr; });
+        if (it == m_ranges.end() || it->lower > end_address) {
+            m_ranges.insert(it, Range{base_address, end_address});
+            return;
+        }
+        // Fold the new range and every overlapping or touching successor into one entry.
+        it->lower = std::min(it->lower, base_address);
+        it->upper = std::max(it->upper, end_address);
+        auto last = std::next(it);
+        while (last != m_ranges.end() && last->lower <= it->upper) {
+            it->upper = std::max(it->upper, last->upper);
+            ++last;
+        }
+        m_ranges.erase(std::next(it), last);
     }
 
     void Subtract(VAddr base_address, size_t size) {
         const VAddr end_address = base_address + size;
-        IntervalType interval{base_address, end_address};
-        m_ranges_set.subtract(interval);
+        auto it = std::lower_bound(
+            m_ranges.begin(), m_ranges.end(), base_address,
+            [](const Range& range, VAddr addr) { return range.upper <= addr; });
+        while (it != m_ranges.end() && it->lower < end_address) {
+            if (it->lower < base_address && it->upper > end_address) {
+                // The subtracted range punches a hole; split the survivor in two.
+                const Range tail{end_address, it->upper};
+                it->upper = base_address;
+                m_ranges.insert(std::next(it), tail);
+                return;
+            }
+            if (it->lower < base_address) {
+                it->upper = base_address;
+                ++it;
+            } else if (it->upper > end_address) {
+                it->lower = end_address;
+                return;
+            } else {
+                it = m_ranges.erase(it);
+            }
+        }
+    }
+
+    /// Unions another set into this one with a single merge pass over both vectors.
+    void Merge(const RangeSet& other) {
+        if (other.m_ranges.empty()) {
+            return;
+        }
+        Storage merged;
+        merged.reserve(m_ranges.size() + other.m_ranges.size());
+        auto lhs = m_ranges.begin();
+        auto rhs = other.m_ranges.begin();
+        const auto append = [&merged](const Range& range) {
+            if (!merged.empty() && range.lower <= merged.back().upper) {
+                merged.back().upper = std::max(merged.back().upper, range.upper);
+            } else {
+                merged.push_back(range);
+            }
+        };
+        while (lhs != m_ranges.end() && rhs != other.m_ranges.end()) {
+            append(lhs->lower <= rhs->lower ? *lhs++ : *rhs++);
+        }
+        std::for_each(lhs, m_ranges.end(), append);
+        std::for_each(rhs, other.m_ranges.end(), append);
+        m_ranges = std::move(merged);
     }
 
     void Clear() {
-        m_ranges_set.clear();
+        m_ranges.clear();
     }
 
     bool Contains(VAddr base_address, size_t size) const {
+        if (size == 0) {
+            return true;
+        }
         const VAddr end_address = base_address + size;
-        IntervalType interval{base_address, end_address};
-        return boost::icl::contains(m_ranges_set, interval);
+        // The set is coalesced, so containment implies a single covering range.
+        const auto it = std::lower_bound(
+            m_ranges.begin(), m_ranges.end(), base_address,
+            [](const Range& range, VAddr addr) { return range.upper <= addr; });
+        return it != m_ranges.end() && it->lower <= base_address && it->upper >= end_address;
     }
 
     bool Intersects(VAddr base_address, size_t size) const {
         const VAddr end_address = base_address + size;
-        IntervalType interval{base_address, end_address};
-        return boost::icl::intersects(m_ranges_set, interval);
+        const auto it = std::lower_bound(
+            m_ranges.begin(), m_ranges.end(), base_address,
+            [](const Range& range, VAddr addr) { return range.upper <= addr; });
+        return it != m_ranges.end() && it->lower < end_address;
     }
 
     template <typename Func>
     void ForEach(Func&& func) const {
-        if (m_ranges_set.empty()) {
-            return;
-        }
-
-        for (const auto& set : m_ranges_set) {
-            const VAddr inter_addr_end = set.upper();
-            const VAddr inter_addr = set.lower();
-            func(inter_addr, inter_addr_end);
+        for (const auto& range : m_ranges) {
+            func(range.lower, range.upper);
         }
     }
 
     template <typename Func>
     void ForEachInRange(VAddr base_addr, size_t size, Func&& func) const {
-        if (m_ranges_set.empty()) {
-            return;
-        }
         const VAddr start_address = base_addr;
         const VAddr end_address = start_address + size;
-        const IntervalType search_interval{start_address, end_address};
-        auto it = m_ranges_set.lower_bound(search_interval);
-        if (it == m_ranges_set.end()) {
-            return;
-        }
-        auto end_it = m_ranges_set.upper_bound(search_interval);
-        for (; it != end_it; it++) {
-            VAddr inter_addr_end = it->upper();
-            VAddr inter_addr = it->lower();
-            if (inter_addr_end > end_address) {
-                inter_addr_end = end_address;
-            }
-            if (inter_addr < start_address) {
-                inter_addr = start_address;
-            }
-            func(inter_addr, inter_addr_end);
+        auto it = std::lower_bound(
+            m_ranges.begin(), m_ranges.end(), start_address,
+            [](const Range& range, VAddr addr) { return range.upper <= addr; });
+        for (; it != m_ranges.end() && it->lower < end_address; ++it) {
+            func(std::max(it->lower, start_address), std::min(it->upper, end_address));
         }
     }
 
@@ -110,7 +165,7 @@ struct RangeSet {
         }
     }
 
-    IntervalSet m_ranges_set;
+    Storage m_ranges;
 };
 
 template <typename T>
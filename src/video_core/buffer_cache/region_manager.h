@@ -7,23 +7,17 @@
 #include "common/div_ceil.h"
 #include "common/logging/log.h"
 
-#ifdef __linux__
-#include "common/adaptive_mutex.h"
-#else
-#include "common/spin_lock.h"
-#endif
 #include "common/debug.h"
+#include "common/shared_first_mutex.h"
 #include "common/types.h"
 #include "video_core/buffer_cache/region_definitions.h"
 #include "video_core/page_manager.h"
 
 namespace VideoCore {
 
-#ifdef PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
-using LockType = Common::AdaptiveMutex;
-#else
-using LockType = Common::SpinLock;
-#endif
+// Region state lives in flat bitset words, so read-only queries can use the sequence-validated
+// optimistic read path instead of acquiring the lock; mutators still lock exclusively.
+using LockType = Common::SharedFirstMutex;
 
 /**
  * Allows tracking CPU and GPU modification of pages in a contigious 16MB virtual address region.
@@ -131,19 +125,28 @@ public:
         }
 
         RegionBits& bits = GetRegionBits<type>();
-        RegionBits mask(bits, start_page, end_page);
-
         if constexpr (clear) {
+            // Snapshot the queried window before clearing, since the tracker must be notified
+            // about the new protection state before the callbacks run.
+            RegionBits mask(bits, start_page, end_page);
             bits.UnsetRange(start_page, end_page);
             if constexpr (type == Type::CPU) {
                 UpdateProtection<true, false>();
             } else if (Config::getReadbacksMode() != Config::GpuReadbacksMode::Disabled) {
                 UpdateProtection<false, true>();
             }
-        }
-
-        for (const auto& [start, end] : mask) {
-            func(cpu_addr + start * TRACKER_BYTES_PER_PAGE, (end - start) * TRACKER_BYTES_PER_PAGE);
+            for (const auto& [start, end] : mask) {
+                func(cpu_addr + start * TRACKER_BYTES_PER_PAGE,
+                     (end - start) * TRACKER_BYTES_PER_PAGE);
+            }
+        } else {
+            // Read-only query; walk the dirty runs in place instead of copying the window.
+            for (auto range = bits.FirstRangeFrom(start_page); range.first < end_page;
+                 range = bits.FirstRangeFrom(range.second)) {
+                const size_t end = std::min<size_t>(range.second, end_page);
+                func(cpu_addr + range.first * TRACKER_BYTES_PER_PAGE,
+                     (end - range.first) * TRACKER_BYTES_PER_PAGE);
+            }
         }
     }
 
@@ -164,8 +167,7 @@ public:
         }
 
         const RegionBits& bits = GetRegionBits<type>();
-        RegionBits test(bits, start_page, end_page);
-        return test.Any();
+        return bits.AnyInRange(start_page, end_page);
     }
 
     LockType lock;
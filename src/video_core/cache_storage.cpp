@@ -18,6 +18,7 @@
 #include <future>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 
 namespace {
 
@@ -82,6 +83,17 @@ constexpr std::string GetBlobFileExtension(BlobType type) {
     case BlobType::ShaderProfile: {
         return "bin";
     }
+    case BlobType::DriverCache: {
+        return "vkpc";
+    }
+    case BlobType::PipelineHotList: {
+        return "hot";
+    }
+    case BlobType::HostShader: {
+        // Must not end in "spv": ForEachBlob matches blob types by extension suffix and
+        // these would otherwise be enumerated together with guest shader binaries.
+        return "hsh";
+    }
     default:
         UNREACHABLE();
     }
@@ -120,6 +132,94 @@ void DataBase::Open() {
     opened = true;
 }
 
+// mz_zip_writer_add_mem appends a new entry even when the name already exists, so every
+// re-saved blob leaves a stale copy behind and the archive grows monotonically. Rewrites
+// the archive keeping only the newest entry per name, reporting how much was reclaimed.
+static void CompactArchive(const std::filesystem::path& cache_path) {
+    mz_zip_archive src{};
+    if (!mz_zip_reader_init_file(&src, cache_path.string().c_str(), 0)) {
+        return;
+    }
+
+    const auto num_files = mz_zip_reader_get_num_files(&src);
+    std::unordered_map<std::string, u32> latest{};
+    latest.reserve(num_files);
+    u64 stale_bytes{};
+    for (u32 index = 0; index < num_files; ++index) {
+        std::array<char, MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE> file_name{};
+        file_name.fill(0);
+        mz_zip_reader_get_filename(&src, index, file_name.data(), file_name.size());
+        const auto [it, inserted] = latest.try_emplace(std::string{file_name.data()}, index);
+        if (!inserted) {
+            mz_zip_archive_file_stat stat{};
+            mz_zip_reader_file_stat(&src, it->second, &stat);
+            stale_bytes += stat.m_comp_size;
+            it->second = index;
+        }
+    }
+
+    // Identical payloads stored under different names (e.g. the same SPIR-V reached from
+    // several permutations) are only reported, not merged: the load paths address blobs
+    // by name. CRC32 plus size from the entry stat is good enough for a report.
+    std::unordered_map<u64, u32> contents{};
+    contents.reserve(latest.size());
+    u64 dup_bytes{};
+    u32 dup_entries{};
+    for (const auto& [name, index] : latest) {
+        mz_zip_archive_file_stat stat{};
+        mz_zip_reader_file_stat(&src, index, &stat);
+        const u64 content_key = (u64{stat.m_crc32} << 32) | (stat.m_uncomp_size & 0xffffffffu);
+        if (!contents.try_emplace(content_key, index).second) {
+            dup_bytes += stat.m_comp_size;
+            ++dup_entries;
+        }
+    }
+    if (dup_entries) {
+        LOG_INFO(Render, "Cache archive holds {} KB of duplicate payloads across {} entries",
+                 dup_bytes / 1024, dup_entries);
+    }
+
+    const u32 stale_entries = num_files - static_cast<u32>(latest.size());
+    if (stale_entries == 0) {
+        mz_zip_reader_end(&src);
+        return;
+    }
+
+    auto tmp_path = cache_path;
+    tmp_path += ".tmp";
+    mz_zip_archive dst{};
+    if (!mz_zip_writer_init_file(&dst, tmp_path.string().c_str(), 0)) {
+        mz_zip_reader_end(&src);
+        return;
+    }
+    bool success = true;
+    for (u32 index = 0; index < num_files && success; ++index) {
+        std::array<char, MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE> file_name{};
+        file_name.fill(0);
+        mz_zip_reader_get_filename(&src, index, file_name.data(), file_name.size());
+        if (latest.at(std::string{file_name.data()}) != index) {
+            continue;
+        }
+        // Copies the stored deflate stream as-is, no recompression.
+        success = mz_zip_writer_add_from_zip_reader(&dst, &src, index);
+    }
+    success = success && mz_zip_writer_finalize_archive(&dst);
+    mz_zip_writer_end(&dst);
+    mz_zip_reader_end(&src);
+
+    std::error_code ec{};
+    if (success) {
+        std::filesystem::rename(tmp_path, cache_path, ec);
+    }
+    if (!success || ec) {
+        std::filesystem::remove(tmp_path, ec);
+        LOG_WARNING(Render, "Cache archive compaction failed, keeping the previous archive");
+        return;
+    }
+    LOG_INFO(Render, "Compacted cache archive: dropped {} stale entries, reclaimed {} KB",
+             stale_entries, stale_bytes / 1024);
+}
+
 void DataBase::Close() {
     if (!IsOpened()) {
         return;
@@ -131,6 +231,7 @@ void DataBase::Close() {
     if (Config::isPipelineCacheArchived()) {
         mz_zip_writer_finalize_archive(&zip_ar);
         mz_zip_writer_end(&zip_ar);
+        CompactArchive(cache_path);
     }
 
     LOG_INFO(Render, "Cache dumped");
@@ -223,7 +324,8 @@ void DataBase::Load(BlobType type, const std::string& name, std::vector<u32>& da
     return LoadVector(type, path, data);
 }
 
-void DataBase::ForEachBlob(BlobType type, const std::function<void(std::vector<u8>&& data)>& func) {
+void DataBase::ForEachBlob(
+    BlobType type, const std::function<void(const std::string& name, std::vector<u8>&& data)>& func) {
     const auto& ext = GetBlobFileExtension(type);
     if (Config::isPipelineCacheArchived()) {
         const auto num_files = mz_zip_reader_get_num_files(&zip_ar);
@@ -236,7 +338,7 @@ void DataBase::ForEachBlob(BlobType type, const std::function<void(std::vector<u
                 mz_zip_reader_file_stat(&zip_ar, index, &stat);
                 std::vector<u8> data(stat.m_uncomp_size);
                 mz_zip_reader_extract_to_mem(&zip_ar, index, data.data(), data.size(), 0);
-                func(std::move(data));
+                func(std::filesystem::path{file_name.data()}.stem().string(), std::move(data));
             }
         }
     } else {
@@ -247,7 +349,7 @@ void DataBase::ForEachBlob(BlobType type, const std::function<void(std::vector<u
                 if (file.IsOpen()) {
                     std::vector<u8> data(file.GetSize());
                     file.Read(data);
-                    func(std::move(data));
+                    func(file_name.path().stem().string(), std::move(data));
                 }
             }
         }
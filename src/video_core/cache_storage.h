@@ -8,6 +8,7 @@
 #include "common/types.h"
 
 #include <functional>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -18,6 +19,9 @@ enum class BlobType : u32 {
     ShaderBinary,
     PipelineKey,
     ShaderProfile,
+    DriverCache,
+    PipelineHotList,
+    HostShader,
 };
 
 class DataBase {
@@ -39,7 +43,8 @@ public:
     void Load(BlobType type, const std::string& name, std::vector<u8>& data);
     void Load(BlobType type, const std::string& name, std::vector<u32>& data);
 
-    void ForEachBlob(BlobType type, const std::function<void(std::vector<u8>&& data)>& func);
+    void ForEachBlob(BlobType type,
+                     const std::function<void(const std::string& name, std::vector<u8>&& data)>& func);
 
 private:
     std::jthread io_worker{};
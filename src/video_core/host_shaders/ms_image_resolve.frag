@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#version 450 core
+#extension GL_EXT_samplerless_texture_functions : require
+
+#ifndef NUM_SAMPLES
+#define NUM_SAMPLES 4
+#endif
+
+layout (binding = 0, set = 0) uniform texture2DMS in_tex;
+
+layout (location = 0) in vec2 uv;
+layout (location = 0) out vec4 out_color;
+
+void main()
+{
+    vec4 sum = vec4(0.0);
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        sum += texelFetch(in_tex, ivec2(gl_FragCoord.xy), i);
+    }
+    out_color = sum / float(NUM_SAMPLES);
+}
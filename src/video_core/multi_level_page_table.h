@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -66,6 +67,30 @@ public:
         return (*first_level_map[l1_page])[l2_page];
     }
 
+    /// Assigns value to count consecutive entries starting at page, filling whole second
+    /// level pages at a time instead of descending the table once per entry. Writing the
+    /// default entry over a range whose second level pages were never allocated is a no-op
+    /// and does not allocate them.
+    void SetRange(size_t page, size_t count, const Entry& value) {
+        const bool is_default = value == Entry{};
+        while (count > 0) {
+            const size_t l1_page = page >> SecondLevelBits;
+            const size_t l2_page = page & (NumEntriesPerL1Page - 1);
+            const size_t run = std::min(count, NumEntriesPerL1Page - l2_page);
+            if (!first_level_map[l1_page]) {
+                if (is_default) {
+                    page += run;
+                    count -= run;
+                    continue;
+                }
+                first_level_map[l1_page] = page_alloc.Create();
+            }
+            std::fill_n(first_level_map[l1_page]->begin() + l2_page, run, value);
+            page += run;
+            count -= run;
+        }
+    }
+
 private:
     std::vector<L1Page*> first_level_map{};
     Common::ObjectPool<L1Page> page_alloc;
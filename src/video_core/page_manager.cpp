@@ -1,11 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <boost/container/small_vector.hpp>
 #include "common/assert.h"
 #include "common/debug.h"
 #include "common/div_ceil.h"
 #include "common/range_lock.h"
+#include "common/shared_first_mutex.h"
 #include "common/signal_context.h"
 #include "core/memory.h"
 #include "core/signals.h"
@@ -181,8 +183,11 @@ struct PageManager::Impl {
     std::jthread ufd_thread;
     int uffd;
 #else
+    inline static Impl* instance;
+
     Impl(Vulkan::Rasterizer* rasterizer_) {
         rasterizer = rasterizer_;
+        instance = this;
 
         // Should be called first.
         constexpr auto priority = std::numeric_limits<u32>::min();
@@ -191,11 +196,47 @@ struct PageManager::Impl {
     }
 
     void OnMap(VAddr address, size_t size) {
-        // No-op
+        UpdateMappedPages(address, size, true);
     }
 
     void OnUnmap(VAddr address, size_t size) {
-        // No-op
+        UpdateMappedPages(address, size, false);
+    }
+
+    void UpdateMappedPages(VAddr address, size_t size, bool mapped) {
+        size_t page = address >> PAGE_BITS;
+        const size_t page_end = Common::DivCeil(address + size, PAGE_SIZE);
+        std::scoped_lock lk{mapped_pages_mutex};
+        // Build the mask covering this word's pages in one step; large maps and unmaps span
+        // tens of thousands of pages and should not pay a loop iteration per bit.
+        while (page != page_end) {
+            const size_t bit = page % MAPPED_PAGES_PER_WORD;
+            const size_t count = std::min(page_end - page, MAPPED_PAGES_PER_WORD - bit);
+            const u64 mask = (count == MAPPED_PAGES_PER_WORD ? ~u64{0} : (1ULL << count) - 1)
+                             << bit;
+            if (mapped) {
+                mapped_pages[page / MAPPED_PAGES_PER_WORD] |= mask;
+            } else {
+                mapped_pages[page / MAPPED_PAGES_PER_WORD] &= ~mask;
+            }
+            page += count;
+        }
+    }
+
+    bool IsGpuMapped(VAddr address) const {
+        const size_t page = address >> PAGE_BITS;
+        // Optimistic read: the fault path runs for every protected page touch during
+        // streaming, so it must not perform an atomic read-modify-write just to look up one
+        // bit. A racing map/unmap fails validation and the lookup is simply retried.
+        while (true) {
+            const u32 token = mapped_pages_mutex.BeginOptimisticRead();
+            const bool mapped =
+                (mapped_pages[page / MAPPED_PAGES_PER_WORD] >> (page % MAPPED_PAGES_PER_WORD)) &
+                1;
+            if (mapped_pages_mutex.ValidateOptimisticRead(token)) {
+                return mapped;
+            }
+        }
     }
 
     void Protect(VAddr address, size_t size, Core::MemoryPermission perms) {
@@ -209,13 +250,41 @@ struct PageManager::Impl {
 
     static bool GuestFaultSignalHandler(void* context, void* fault_address) {
         const auto addr = reinterpret_cast<VAddr>(fault_address);
-        if (Common::IsWriteError(context)) {
+        if ((addr >> PAGE_BITS) >= NUM_ADDRESS_PAGES) {
+            // The page state and mapped-page mirrors only cover the 40-bit tracked range.
+            // Faults outside it (lower-priority handlers in the chain deliberately probe
+            // arbitrary guest pointers) must not index the arrays, especially not from
+            // signal context; they are never ours to resolve.
+            return false;
+        }
+        const bool is_write = Common::IsWriteError(context);
+
+        // Consult the page state before taking any cache or tracker locks. The read is racy
+        // by design: watcher counts change before the matching protection does, so a zero
+        // count means another thread has already untracked this page and the access only
+        // needs to be retried once the pending protection restore lands. A stale non-zero
+        // count merely sends the fault down the regular invalidation path.
+        const PageState state = instance->cached_pages[addr >> PAGE_BITS];
+        const u8 num_watchers = is_write ? state.num_write_watchers : state.num_read_watchers;
+        if (num_watchers == 0) {
+            // Only resolve faults on GPU mapped memory; anything else belongs to the next
+            // access violation handler in the chain.
+            return instance->IsGpuMapped(addr);
+        }
+
+        if (is_write) {
             return rasterizer->InvalidateMemory(addr, 8);
-        } else {
-            return rasterizer->ReadMemory(addr, 8);
         }
-        return false;
+        return rasterizer->ReadMemory(addr, 8);
     }
+
+    static constexpr size_t MAPPED_PAGES_PER_WORD = 64;
+
+    // Mirror of the rasterizer's GPU mapped ranges at page granularity. Flat words so the
+    // fault handler can query it with a sequence-validated read instead of taking the
+    // rasterizer's shared lock from signal context.
+    Common::SharedFirstMutex mapped_pages_mutex;
+    std::array<u64, NUM_ADDRESS_PAGES / MAPPED_PAGES_PER_WORD> mapped_pages{};
 #endif
 
     template <bool track, bool is_read>
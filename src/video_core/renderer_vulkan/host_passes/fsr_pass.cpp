@@ -1,6 +1,8 @@
 //  SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 //  SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/assert.h"
 #include "common/config.h"
 #include "video_core/host_shaders/fsr_comp.h"
@@ -25,10 +27,19 @@ struct FSRConstants {
 
 namespace Vulkan::HostPasses {
 
-void FsrPass::Create(vk::Device device, VmaAllocator allocator, u32 num_images) {
+void FsrPass::Create(vk::Device device, VmaAllocator allocator, u32 num_images,
+                     std::span<const u32> queue_family_indices) {
     this->device = device;
     this->num_images = num_images;
 
+    // Share the pass images between all given families so the chain can run on either the
+    // graphics or a dedicated compute queue without ownership transfers.
+    for (const u32 family : queue_family_indices) {
+        if (std::ranges::find(sharing_queue_families, family) == sharing_queue_families.end()) {
+            sharing_queue_families.push_back(family);
+        }
+    }
+
     sampler = Check<"create upscaling sampler">(device.createSamplerUnique(vk::SamplerCreateInfo{
         .magFilter = vk::Filter::eLinear,
         .minFilter = vk::Filter::eLinear,
@@ -420,6 +431,10 @@ void FsrPass::CreateImages(Img& img) const {
         .samples = vk::SampleCountFlagBits::e1,
         // .tiling = vk::ImageTiling::eOptimal,
         .usage = vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eStorage,
+        .sharingMode = sharing_queue_families.size() > 1 ? vk::SharingMode::eConcurrent
+                                                         : vk::SharingMode::eExclusive,
+        .queueFamilyIndexCount = static_cast<u32>(sharing_queue_families.size()),
+        .pQueueFamilyIndices = sharing_queue_families.data(),
         .initialLayout = vk::ImageLayout::eUndefined,
     };
     img.intermediary_image.Create(image_create_info);
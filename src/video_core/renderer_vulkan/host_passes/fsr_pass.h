@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "common/types.h"
 #include "video_core/renderer_vulkan/vk_common.h"
 #include "video_core/texture_cache/image.h"
@@ -17,7 +19,8 @@ public:
         float rcas_attenuation{0.25f};
     };
 
-    void Create(vk::Device device, VmaAllocator allocator, u32 num_images);
+    void Create(vk::Device device, VmaAllocator allocator, u32 num_images,
+                std::span<const u32> queue_family_indices);
 
     vk::ImageView Render(vk::CommandBuffer cmdbuf, vk::ImageView input, vk::Extent2D input_size,
                          vk::Extent2D output_size, Settings settings, bool hdr);
@@ -39,6 +42,7 @@ private:
 
     vk::Device device{};
     u32 num_images{};
+    std::vector<u32> sharing_queue_families;
 
     vk::UniqueDescriptorSetLayout descriptor_set_layout{};
     vk::UniqueDescriptorSet easu_descriptor_set{};
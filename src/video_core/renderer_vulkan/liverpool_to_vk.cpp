@@ -15,54 +15,72 @@ namespace Vulkan::LiverpoolToVK {
 
 using DepthBuffer = AmdGpu::DepthBuffer;
 
+namespace {
+
+/// Dense lookup table for the per-draw register-to-Vulkan enum conversions, generated at
+/// compile time from (register value, Vulkan enum) pairs. The hot path becomes a single
+/// indexed load; the validity mask preserves the UNREACHABLE diagnostics the switch-based
+/// conversions emitted for register values without a mapping.
+template <typename VkEnum, size_t N>
+struct EnumTable {
+    static_assert(N <= 64, "Validity mask only covers 64 entries");
+    std::array<VkEnum, N> map{};
+    u64 valid_mask{};
+
+    template <typename AmdEnum>
+    constexpr void Set(AmdEnum reg, VkEnum vk) {
+        map[static_cast<size_t>(reg)] = vk;
+        valid_mask |= u64{1} << static_cast<size_t>(reg);
+    }
+
+    constexpr bool IsValid(u32 raw) const {
+        return raw < N && (valid_mask >> raw & 1) != 0;
+    }
+};
+
+} // Anonymous namespace
+
 vk::StencilOp StencilOp(AmdGpu::StencilFunc op) {
-    switch (op) {
-    case AmdGpu::StencilFunc::Keep:
-        return vk::StencilOp::eKeep;
-    case AmdGpu::StencilFunc::Zero:
-        return vk::StencilOp::eZero;
-    case AmdGpu::StencilFunc::ReplaceTest:
-        return vk::StencilOp::eReplace;
-    case AmdGpu::StencilFunc::AddClamp:
-        return vk::StencilOp::eIncrementAndClamp;
-    case AmdGpu::StencilFunc::SubClamp:
-        return vk::StencilOp::eDecrementAndClamp;
-    case AmdGpu::StencilFunc::Invert:
-        return vk::StencilOp::eInvert;
-    case AmdGpu::StencilFunc::AddWrap:
-        return vk::StencilOp::eIncrementAndWrap;
-    case AmdGpu::StencilFunc::SubWrap:
-        return vk::StencilOp::eDecrementAndWrap;
-    case AmdGpu::StencilFunc::ReplaceOp:
-        return vk::StencilOp::eReplace;
-    default:
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::StencilOp, 10> t{};
+        t.Set(AmdGpu::StencilFunc::Keep, vk::StencilOp::eKeep);
+        t.Set(AmdGpu::StencilFunc::Zero, vk::StencilOp::eZero);
+        t.Set(AmdGpu::StencilFunc::ReplaceTest, vk::StencilOp::eReplace);
+        t.Set(AmdGpu::StencilFunc::AddClamp, vk::StencilOp::eIncrementAndClamp);
+        t.Set(AmdGpu::StencilFunc::SubClamp, vk::StencilOp::eDecrementAndClamp);
+        t.Set(AmdGpu::StencilFunc::Invert, vk::StencilOp::eInvert);
+        t.Set(AmdGpu::StencilFunc::AddWrap, vk::StencilOp::eIncrementAndWrap);
+        t.Set(AmdGpu::StencilFunc::SubWrap, vk::StencilOp::eDecrementAndWrap);
+        t.Set(AmdGpu::StencilFunc::ReplaceOp, vk::StencilOp::eReplace);
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(op);
+    if (!table.IsValid(raw)) {
         UNREACHABLE();
         return vk::StencilOp::eKeep;
     }
+    return table.map[raw];
 }
 
 vk::CompareOp CompareOp(AmdGpu::CompareFunc func) {
-    switch (func) {
-    case AmdGpu::CompareFunc::Always:
-        return vk::CompareOp::eAlways;
-    case AmdGpu::CompareFunc::Equal:
-        return vk::CompareOp::eEqual;
-    case AmdGpu::CompareFunc::GreaterEqual:
-        return vk::CompareOp::eGreaterOrEqual;
-    case AmdGpu::CompareFunc::Greater:
-        return vk::CompareOp::eGreater;
-    case AmdGpu::CompareFunc::LessEqual:
-        return vk::CompareOp::eLessOrEqual;
-    case AmdGpu::CompareFunc::Less:
-        return vk::CompareOp::eLess;
-    case AmdGpu::CompareFunc::NotEqual:
-        return vk::CompareOp::eNotEqual;
-    case AmdGpu::CompareFunc::Never:
-        return vk::CompareOp::eNever;
-    default:
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::CompareOp, 8> t{};
+        t.Set(AmdGpu::CompareFunc::Never, vk::CompareOp::eNever);
+        t.Set(AmdGpu::CompareFunc::Less, vk::CompareOp::eLess);
+        t.Set(AmdGpu::CompareFunc::Equal, vk::CompareOp::eEqual);
+        t.Set(AmdGpu::CompareFunc::LessEqual, vk::CompareOp::eLessOrEqual);
+        t.Set(AmdGpu::CompareFunc::Greater, vk::CompareOp::eGreater);
+        t.Set(AmdGpu::CompareFunc::NotEqual, vk::CompareOp::eNotEqual);
+        t.Set(AmdGpu::CompareFunc::GreaterEqual, vk::CompareOp::eGreaterOrEqual);
+        t.Set(AmdGpu::CompareFunc::Always, vk::CompareOp::eAlways);
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(func);
+    if (!table.IsValid(raw)) {
         UNREACHABLE();
         return vk::CompareOp::eAlways;
     }
+    return table.map[raw];
 }
 
 bool IsPrimitiveCulled(AmdGpu::PrimitiveType type) {
@@ -127,91 +145,83 @@ vk::PrimitiveTopology PrimitiveType(AmdGpu::PrimitiveType type) {
 }
 
 vk::PolygonMode PolygonMode(AmdGpu::PolygonMode mode) {
-    switch (mode) {
-    case AmdGpu::PolygonMode::Point:
-        return vk::PolygonMode::ePoint;
-    case AmdGpu::PolygonMode::Line:
-        return vk::PolygonMode::eLine;
-    case AmdGpu::PolygonMode::Fill:
-        return vk::PolygonMode::eFill;
-    default:
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::PolygonMode, 3> t{};
+        t.Set(AmdGpu::PolygonMode::Point, vk::PolygonMode::ePoint);
+        t.Set(AmdGpu::PolygonMode::Line, vk::PolygonMode::eLine);
+        t.Set(AmdGpu::PolygonMode::Fill, vk::PolygonMode::eFill);
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(mode);
+    if (!table.IsValid(raw)) {
         UNREACHABLE();
         return vk::PolygonMode::eFill;
     }
+    return table.map[raw];
 }
 
 vk::CullModeFlags CullMode(AmdGpu::CullMode mode) {
-    switch (mode) {
-    case AmdGpu::CullMode::None:
-        return vk::CullModeFlagBits::eNone;
-    case AmdGpu::CullMode::Front:
-        return vk::CullModeFlagBits::eFront;
-    case AmdGpu::CullMode::Back:
-        return vk::CullModeFlagBits::eBack;
-    case AmdGpu::CullMode::FrontAndBack:
-        return vk::CullModeFlagBits::eFrontAndBack;
-    default:
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::CullModeFlags, 4> t{};
+        t.Set(AmdGpu::CullMode::None, vk::CullModeFlags{vk::CullModeFlagBits::eNone});
+        t.Set(AmdGpu::CullMode::Front, vk::CullModeFlags{vk::CullModeFlagBits::eFront});
+        t.Set(AmdGpu::CullMode::Back, vk::CullModeFlags{vk::CullModeFlagBits::eBack});
+        t.Set(AmdGpu::CullMode::FrontAndBack, vk::CullModeFlags{vk::CullModeFlagBits::eFrontAndBack});
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(mode);
+    if (!table.IsValid(raw)) {
         UNREACHABLE();
         return vk::CullModeFlagBits::eNone;
     }
+    return table.map[raw];
 }
 
 vk::FrontFace FrontFace(AmdGpu::FrontFace face) {
-    switch (face) {
-    case AmdGpu::FrontFace::Clockwise:
-        return vk::FrontFace::eClockwise;
-    case AmdGpu::FrontFace::CounterClockwise:
-        return vk::FrontFace::eCounterClockwise;
-    default:
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::FrontFace, 2> t{};
+        t.Set(AmdGpu::FrontFace::CounterClockwise, vk::FrontFace::eCounterClockwise);
+        t.Set(AmdGpu::FrontFace::Clockwise, vk::FrontFace::eClockwise);
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(face);
+    if (!table.IsValid(raw)) {
         UNREACHABLE();
         return vk::FrontFace::eClockwise;
     }
+    return table.map[raw];
 }
 
 vk::BlendFactor BlendFactor(AmdGpu::BlendControl::BlendFactor factor) {
     using BlendFactor = AmdGpu::BlendControl::BlendFactor;
-    switch (factor) {
-    case BlendFactor::Zero:
-        return vk::BlendFactor::eZero;
-    case BlendFactor::One:
-        return vk::BlendFactor::eOne;
-    case BlendFactor::SrcColor:
-        return vk::BlendFactor::eSrcColor;
-    case BlendFactor::OneMinusSrcColor:
-        return vk::BlendFactor::eOneMinusSrcColor;
-    case BlendFactor::SrcAlpha:
-        return vk::BlendFactor::eSrcAlpha;
-    case BlendFactor::OneMinusSrcAlpha:
-        return vk::BlendFactor::eOneMinusSrcAlpha;
-    case BlendFactor::DstAlpha:
-        return vk::BlendFactor::eDstAlpha;
-    case BlendFactor::OneMinusDstAlpha:
-        return vk::BlendFactor::eOneMinusDstAlpha;
-    case BlendFactor::DstColor:
-        return vk::BlendFactor::eDstColor;
-    case BlendFactor::OneMinusDstColor:
-        return vk::BlendFactor::eOneMinusDstColor;
-    case BlendFactor::SrcAlphaSaturate:
-        return vk::BlendFactor::eSrcAlphaSaturate;
-    case BlendFactor::ConstantColor:
-        return vk::BlendFactor::eConstantColor;
-    case BlendFactor::OneMinusConstantColor:
-        return vk::BlendFactor::eOneMinusConstantColor;
-    case BlendFactor::Src1Color:
-        return vk::BlendFactor::eSrc1Color;
-    case BlendFactor::InvSrc1Color:
-        return vk::BlendFactor::eOneMinusSrc1Color;
-    case BlendFactor::Src1Alpha:
-        return vk::BlendFactor::eSrc1Alpha;
-    case BlendFactor::InvSrc1Alpha:
-        return vk::BlendFactor::eOneMinusSrc1Alpha;
-    case BlendFactor::ConstantAlpha:
-        return vk::BlendFactor::eConstantAlpha;
-    case BlendFactor::OneMinusConstantAlpha:
-        return vk::BlendFactor::eOneMinusConstantAlpha;
-    default:
-        UNREACHABLE_MSG("Unknown blend factor: {}", static_cast<u32>(factor));
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::BlendFactor, 21> t{};
+        t.Set(BlendFactor::Zero, vk::BlendFactor::eZero);
+        t.Set(BlendFactor::One, vk::BlendFactor::eOne);
+        t.Set(BlendFactor::SrcColor, vk::BlendFactor::eSrcColor);
+        t.Set(BlendFactor::OneMinusSrcColor, vk::BlendFactor::eOneMinusSrcColor);
+        t.Set(BlendFactor::SrcAlpha, vk::BlendFactor::eSrcAlpha);
+        t.Set(BlendFactor::OneMinusSrcAlpha, vk::BlendFactor::eOneMinusSrcAlpha);
+        t.Set(BlendFactor::DstAlpha, vk::BlendFactor::eDstAlpha);
+        t.Set(BlendFactor::OneMinusDstAlpha, vk::BlendFactor::eOneMinusDstAlpha);
+        t.Set(BlendFactor::DstColor, vk::BlendFactor::eDstColor);
+        t.Set(BlendFactor::OneMinusDstColor, vk::BlendFactor::eOneMinusDstColor);
+        t.Set(BlendFactor::SrcAlphaSaturate, vk::BlendFactor::eSrcAlphaSaturate);
+        t.Set(BlendFactor::ConstantColor, vk::BlendFactor::eConstantColor);
+        t.Set(BlendFactor::OneMinusConstantColor, vk::BlendFactor::eOneMinusConstantColor);
+        t.Set(BlendFactor::Src1Color, vk::BlendFactor::eSrc1Color);
+        t.Set(BlendFactor::InvSrc1Color, vk::BlendFactor::eOneMinusSrc1Color);
+        t.Set(BlendFactor::Src1Alpha, vk::BlendFactor::eSrc1Alpha);
+        t.Set(BlendFactor::InvSrc1Alpha, vk::BlendFactor::eOneMinusSrc1Alpha);
+        t.Set(BlendFactor::ConstantAlpha, vk::BlendFactor::eConstantAlpha);
+        t.Set(BlendFactor::OneMinusConstantAlpha, vk::BlendFactor::eOneMinusConstantAlpha);
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(factor);
+    if (!table.IsValid(raw)) {
+        UNREACHABLE_MSG("Unknown blend factor: {}", raw);
     }
+    return table.map[raw];
 }
 
 bool IsDualSourceBlendFactor(AmdGpu::BlendControl::BlendFactor factor) {
@@ -229,20 +239,20 @@ bool IsDualSourceBlendFactor(AmdGpu::BlendControl::BlendFactor factor) {
 
 vk::BlendOp BlendOp(AmdGpu::BlendControl::BlendFunc func) {
     using BlendFunc = AmdGpu::BlendControl::BlendFunc;
-    switch (func) {
-    case BlendFunc::Add:
-        return vk::BlendOp::eAdd;
-    case BlendFunc::Subtract:
-        return vk::BlendOp::eSubtract;
-    case BlendFunc::Min:
-        return vk::BlendOp::eMin;
-    case BlendFunc::Max:
-        return vk::BlendOp::eMax;
-    case BlendFunc::ReverseSubtract:
-        return vk::BlendOp::eReverseSubtract;
-    default:
-        UNREACHABLE_MSG("Unknown blend op: {}", static_cast<u32>(func));
+    static constexpr auto table = []() constexpr {
+        EnumTable<vk::BlendOp, 5> t{};
+        t.Set(BlendFunc::Add, vk::BlendOp::eAdd);
+        t.Set(BlendFunc::Subtract, vk::BlendOp::eSubtract);
+        t.Set(BlendFunc::Min, vk::BlendOp::eMin);
+        t.Set(BlendFunc::Max, vk::BlendOp::eMax);
+        t.Set(BlendFunc::ReverseSubtract, vk::BlendOp::eReverseSubtract);
+        return t;
+    }();
+    const u32 raw = static_cast<u32>(func);
+    if (!table.IsValid(raw)) {
+        UNREACHABLE_MSG("Unknown blend op: {}", raw);
     }
+    return table.map[raw];
 }
 
 vk::LogicOp LogicOp(AmdGpu::ColorControl::LogicOp logic_op) {
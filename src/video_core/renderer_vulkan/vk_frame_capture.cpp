@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "common/path_util.h"
+#include "common/task_scheduler.h"
+#include "video_core/renderer_vulkan/vk_frame_capture.h"
+#include "video_core/renderer_vulkan/vk_instance.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+
+#include <vk_mem_alloc.h>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libswscale/swscale.h>
+}
+
+namespace Vulkan {
+
+FrameCapture::FrameCapture(const Instance& instance_) : instance{instance_} {}
+
+FrameCapture::~FrameCapture() {
+    // Workers hold slots busy only while the task scheduler runs them; by the
+    // time the presenter is torn down the emulator has stopped submitting.
+    for (auto& slot : slots) {
+        DestroySlot(slot);
+    }
+}
+
+void FrameCapture::SetEnabled(bool enable) {
+    if (enable && capture_dir.empty()) {
+        capture_dir = Common::FS::GetUserPath(Common::FS::PathType::ScreenshotsDir) / "capture";
+        std::filesystem::create_directories(capture_dir);
+    }
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool FrameCapture::EnsureSlotCapacity(Slot& slot, vk::DeviceSize size) {
+    if (slot.buffer && slot.capacity >= size) {
+        return true;
+    }
+    DestroySlot(slot);
+
+    const vk::BufferCreateInfo buffer_ci{
+        .size = size,
+        .usage = vk::BufferUsageFlagBits::eTransferDst,
+        .sharingMode = vk::SharingMode::eExclusive,
+    };
+    const VmaAllocationCreateInfo alloc_ci{
+        .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT,
+        .usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+    };
+
+    const VkBufferCreateInfo buffer_ci_unsafe = static_cast<VkBufferCreateInfo>(buffer_ci);
+    VkBuffer unsafe_buffer{};
+    VmaAllocationInfo alloc_info{};
+    const VkResult result = vmaCreateBuffer(instance.GetAllocator(), &buffer_ci_unsafe, &alloc_ci,
+                                            &unsafe_buffer, &slot.allocation, &alloc_info);
+    if (result != VK_SUCCESS) {
+        LOG_ERROR(Render_Vulkan, "Failed allocating capture buffer with error {}",
+                  vk::to_string(vk::Result{result}));
+        return false;
+    }
+    slot.buffer = vk::Buffer{unsafe_buffer};
+    slot.mapped = alloc_info.pMappedData;
+    slot.capacity = size;
+    return true;
+}
+
+void FrameCapture::DestroySlot(Slot& slot) {
+    if (slot.buffer) {
+        vmaDestroyBuffer(instance.GetAllocator(), slot.buffer, slot.allocation);
+        slot.buffer = nullptr;
+        slot.allocation = nullptr;
+        slot.mapped = nullptr;
+        slot.capacity = 0;
+    }
+}
+
+s32 FrameCapture::Record(vk::CommandBuffer cmdbuf, vk::Image image, vk::Extent2D extent,
+                         vk::Format format) {
+    bool is_bgra;
+    switch (format) {
+    case vk::Format::eB8G8R8A8Unorm:
+    case vk::Format::eB8G8R8A8Srgb:
+        is_bgra = true;
+        break;
+    case vk::Format::eR8G8B8A8Unorm:
+    case vk::Format::eR8G8B8A8Srgb:
+        is_bgra = false;
+        break;
+    default:
+        // HDR surfaces would need tonemapping on readback; not worth it here.
+        LOG_WARNING(Render_Vulkan, "Frame capture unsupported for format {}",
+                    vk::to_string(format));
+        return -1;
+    }
+
+    s32 slot_index = -1;
+    for (s32 i = 0; i < static_cast<s32>(NumSlots); ++i) {
+        bool expected = false;
+        if (slots[i].busy.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            slot_index = i;
+            break;
+        }
+    }
+    if (slot_index < 0) {
+        // Every slot is still encoding; drop the frame rather than stall.
+        return -1;
+    }
+
+    Slot& slot = slots[slot_index];
+    const vk::DeviceSize size = vk::DeviceSize(extent.width) * extent.height * 4;
+    if (!EnsureSlotCapacity(slot, size)) {
+        slot.busy.store(false, std::memory_order_release);
+        return -1;
+    }
+    slot.width = extent.width;
+    slot.height = extent.height;
+    slot.is_bgra = is_bgra;
+
+    const vk::ImageMemoryBarrier read_barrier{
+        .srcAccessMask = vk::AccessFlagBits::eColorAttachmentWrite,
+        .dstAccessMask = vk::AccessFlagBits::eTransferRead,
+        .oldLayout = vk::ImageLayout::eColorAttachmentOptimal,
+        .newLayout = vk::ImageLayout::eTransferSrcOptimal,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange{
+            .aspectMask = vk::ImageAspectFlagBits::eColor,
+            .levelCount = 1,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        },
+    };
+    cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput,
+                           vk::PipelineStageFlagBits::eTransfer, {}, {}, {}, read_barrier);
+
+    const vk::BufferImageCopy copy{
+        .imageSubresource{
+            .aspectMask = vk::ImageAspectFlagBits::eColor,
+            .layerCount = 1,
+        },
+        .imageExtent{
+            .width = extent.width,
+            .height = extent.height,
+            .depth = 1,
+        },
+    };
+    cmdbuf.copyImageToBuffer(image, vk::ImageLayout::eTransferSrcOptimal, slot.buffer, copy);
+
+    const vk::ImageMemoryBarrier restore_barrier{
+        .srcAccessMask = vk::AccessFlagBits::eTransferRead,
+        .dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite,
+        .oldLayout = vk::ImageLayout::eTransferSrcOptimal,
+        .newLayout = vk::ImageLayout::eColorAttachmentOptimal,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange{
+            .aspectMask = vk::ImageAspectFlagBits::eColor,
+            .levelCount = 1,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        },
+    };
+    cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer,
+                           vk::PipelineStageFlagBits::eColorAttachmentOutput, {}, {}, {},
+                           restore_barrier);
+    return slot_index;
+}
+
+void FrameCapture::Submit(s32 slot_index, MasterSemaphore* semaphore, u64 tick) {
+    const u32 frame_number = next_frame_number++;
+    Common::TaskScheduler::Instance().Submit(
+        [this, slot_index, semaphore, tick, frame_number] {
+            semaphore->Wait(tick);
+            Encode(slots[slot_index], frame_number);
+            slots[slot_index].busy.store(false, std::memory_order_release);
+        },
+        Common::TaskPriority::Low);
+}
+
+void FrameCapture::Encode(const Slot& slot, u32 frame_number) {
+    const auto codec = avcodec_find_encoder(AV_CODEC_ID_MJPEG);
+    if (codec == nullptr) {
+        LOG_ERROR(Render_Vulkan, "MJPEG encoder unavailable, dropping capture");
+        return;
+    }
+
+    const auto context = std::unique_ptr<AVCodecContext, void (*)(AVCodecContext*)>(
+        avcodec_alloc_context3(codec), [](AVCodecContext* ctx) { avcodec_free_context(&ctx); });
+    context->width = slot.width;
+    context->height = slot.height;
+    context->pix_fmt = AV_PIX_FMT_YUVJ420P;
+    context->time_base = {1, 60};
+    context->flags |= AV_CODEC_FLAG_QSCALE;
+    context->global_quality = FF_QP2LAMBDA * 3;
+    if (avcodec_open2(context.get(), codec, nullptr) < 0) {
+        LOG_ERROR(Render_Vulkan, "Could not open MJPEG encoder");
+        return;
+    }
+
+    const auto frame = std::unique_ptr<AVFrame, void (*)(AVFrame*)>(
+        av_frame_alloc(), [](AVFrame* ptr) { av_frame_free(&ptr); });
+    frame->format = context->pix_fmt;
+    frame->width = context->width;
+    frame->height = context->height;
+    frame->quality = context->global_quality;
+    if (av_frame_get_buffer(frame.get(), 0) < 0) {
+        return;
+    }
+
+    // swscale carries the SIMD conversion kernels, same as the sceJpegEnc path.
+    const auto sws = std::unique_ptr<SwsContext, void (*)(SwsContext*)>(
+        sws_getContext(slot.width, slot.height,
+                       slot.is_bgra ? AV_PIX_FMT_BGRA : AV_PIX_FMT_RGBA, frame->width,
+                       frame->height, AVPixelFormat(frame->format), SWS_FAST_BILINEAR, nullptr,
+                       nullptr, nullptr),
+        &sws_freeContext);
+    if (sws == nullptr) {
+        return;
+    }
+    const u8* src_data[1] = {static_cast<const u8*>(slot.mapped)};
+    const int src_linesize[1] = {static_cast<int>(slot.width * 4)};
+    if (sws_scale(sws.get(), src_data, src_linesize, 0, slot.height, frame->data,
+                  frame->linesize) < 0) {
+        return;
+    }
+
+    if (avcodec_send_frame(context.get(), frame.get()) < 0) {
+        return;
+    }
+    const auto packet = std::unique_ptr<AVPacket, void (*)(AVPacket*)>(
+        av_packet_alloc(), [](AVPacket* ptr) { av_packet_free(&ptr); });
+    if (avcodec_receive_packet(context.get(), packet.get()) < 0) {
+        return;
+    }
+
+    const auto path = capture_dir / fmt::format("frame_{:06}.jpg", frame_number);
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Create};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Render_Vulkan, "Failed to open {} for capture", path.string());
+        return;
+    }
+    file.WriteRaw<u8>(packet->data, packet->size);
+}
+
+} // namespace Vulkan
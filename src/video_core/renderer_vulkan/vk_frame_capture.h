@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+
+#include "common/types.h"
+#include "video_core/renderer_vulkan/vk_common.h"
+
+namespace Vulkan {
+
+class Instance;
+class MasterSemaphore;
+
+/// Copies presented swapchain images into a ring of host-visible buffers and
+/// encodes them to JPEG on worker threads, so recording gameplay video never
+/// stalls the present path.
+class FrameCapture {
+public:
+    static constexpr size_t NumSlots = 4;
+
+    explicit FrameCapture(const Instance& instance);
+    ~FrameCapture();
+
+    bool IsEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    void SetEnabled(bool enable);
+
+    /// Records a copy of the image into a free slot. The image must be in
+    /// color-attachment layout; it is returned to that layout afterwards.
+    /// Returns the slot index, or -1 when the surface format is unsupported
+    /// or every slot is still being encoded.
+    s32 Record(vk::CommandBuffer cmdbuf, vk::Image image, vk::Extent2D extent, vk::Format format);
+
+    /// Hands a recorded slot to a worker, which encodes it once the GPU has
+    /// signalled the tick of the submission carrying the copy.
+    void Submit(s32 slot_index, MasterSemaphore* semaphore, u64 tick);
+
+private:
+    struct Slot {
+        vk::Buffer buffer{};
+        VmaAllocation allocation{};
+        void* mapped{};
+        vk::DeviceSize capacity{};
+        u32 width{};
+        u32 height{};
+        bool is_bgra{};
+        std::atomic_bool busy{};
+    };
+
+    bool EnsureSlotCapacity(Slot& slot, vk::DeviceSize size);
+    void DestroySlot(Slot& slot);
+    void Encode(const Slot& slot, u32 frame_number);
+
+    const Instance& instance;
+    std::atomic_bool enabled{};
+    std::array<Slot, NumSlots> slots{};
+    u32 next_frame_number{};
+    std::filesystem::path capture_dir;
+};
+
+} // namespace Vulkan
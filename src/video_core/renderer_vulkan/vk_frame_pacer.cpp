@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include "common/config.h"
+#include "common/thread.h"
+#include "video_core/renderer_vulkan/vk_frame_pacer.h"
+
+namespace Vulkan {
+
+// Samples larger than this are pauses (loading screens, debugger stops) and would
+// poison the cadence estimate, so they reset the history instead.
+constexpr u64 MaxFlipDeltaNs = 250'000'000ULL;
+
+// Allowed mean deviation from the snapped period before pacing is suspended.
+constexpr u64 MaxJitterNs = 4'000'000ULL;
+
+FramePacer::FramePacer() = default;
+
+void FramePacer::RecordFlipRequest() {
+    const u64 now = clock.GetTimeNS();
+    std::scoped_lock lk{sample_mutex};
+    if (last_flip_request_ns != 0) {
+        const u64 delta = now - last_flip_request_ns;
+        if (delta < MaxFlipDeltaNs) {
+            flip_deltas[sample_index] = delta;
+            sample_index = (sample_index + 1) % NumFlipSamples;
+            num_samples = std::min(num_samples + 1, NumFlipSamples);
+        } else {
+            sample_index = 0;
+            num_samples = 0;
+        }
+    }
+    last_flip_request_ns = now;
+}
+
+u64 FramePacer::PredictFramePeriod() {
+    std::scoped_lock lk{sample_mutex};
+    if (num_samples < NumFlipSamples / 2) {
+        return 0;
+    }
+    u64 sum = 0;
+    for (size_t i = 0; i < num_samples; ++i) {
+        sum += flip_deltas[i];
+    }
+    const u64 mean = sum / num_samples;
+
+    // Snap the measured cadence to a whole number of vblanks; games that flip every
+    // other vblank (30 FPS with flip_rate 1) land on the doubled period.
+    const u64 vblank_period = 1'000'000'000ULL / Config::vblankFreq();
+    const u64 num_vblanks = std::clamp<u64>((mean + vblank_period / 2) / vblank_period, 1, 4);
+    const u64 period = num_vblanks * vblank_period;
+
+    u64 deviation = 0;
+    for (size_t i = 0; i < num_samples; ++i) {
+        const u64 sample = flip_deltas[i];
+        deviation += sample > period ? sample - period : period - sample;
+    }
+    if (deviation / num_samples > MaxJitterNs) {
+        // Unstable frame times; pacing would only add latency on top of the stutter.
+        return 0;
+    }
+    return period;
+}
+
+void FramePacer::WaitPresentSlot() {
+    const u64 period = PredictFramePeriod();
+    const u64 now = clock.GetTimeNS();
+    if (period == 0) {
+        next_present_ns = now;
+        return;
+    }
+    u64 target = next_present_ns + period;
+    if (target <= now) {
+        // The frame missed its slot; show it immediately and rebase the schedule.
+        next_present_ns = now;
+        return;
+    }
+    target = std::min(target, now + period);
+    Common::AccurateSleep(std::chrono::nanoseconds(target - now), nullptr, false);
+    next_present_ns = target;
+}
+
+} // namespace Vulkan
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include "common/native_clock.h"
+#include "common/types.h"
+
+namespace Vulkan {
+
+/// Smooths presentation cadence on fixed-refresh displays. Guest flips arrive with scheduling
+/// jitter from the GPU and present threads and beat against host vsync, which is perceived as
+/// judder. The pacer measures the recent flip request cadence, snaps it to the nearest multiple
+/// of the vblank period and delays each present to hit the predicted slot.
+class FramePacer {
+public:
+    explicit FramePacer();
+
+    /// Records the submission time of a guest flip request; called from any thread.
+    void RecordFlipRequest();
+
+    /// Blocks the present thread until the predicted presentation slot of the next frame.
+    /// Frames that are already late are presented immediately rather than delayed further.
+    void WaitPresentSlot();
+
+private:
+    /// Returns the predicted frame period in nanoseconds, or 0 when the measured
+    /// cadence is too unstable to pace against.
+    u64 PredictFramePeriod();
+
+    static constexpr size_t NumFlipSamples = 16;
+
+    Common::NativeClock clock;
+    std::mutex sample_mutex;
+    std::array<u64, NumFlipSamples> flip_deltas{};
+    size_t sample_index{};
+    size_t num_samples{};
+    u64 last_flip_request_ns{};
+    u64 next_present_ns{};
+};
+
+} // namespace Vulkan
@@ -337,6 +337,8 @@ bool Instance::CreateDevice() {
 #endif
 
     supports_memory_budget = add_extension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    swapchain_maintenance1 = add_extension(VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME);
+    global_priority = add_extension(VK_KHR_GLOBAL_PRIORITY_EXTENSION_NAME);
 
     const auto family_properties = physical_device.getQueueFamilyProperties();
     if (family_properties.empty()) {
@@ -345,11 +347,19 @@ bool Instance::CreateDevice() {
     }
 
     bool graphics_queue_found = false;
+    bool compute_queue_found = false;
     for (std::size_t i = 0; i < family_properties.size(); i++) {
         const u32 index = static_cast<u32>(i);
         if (family_properties[i].queueFlags & vk::QueueFlagBits::eGraphics) {
             queue_family_index = index;
             graphics_queue_found = true;
+        } else if (family_properties[i].queueFlags & vk::QueueFlagBits::eCompute) {
+            // Prefer a compute-only family for ASC submissions so async compute
+            // workloads can overlap graphics on the host GPU.
+            if (!compute_queue_found) {
+                compute_queue_family_index = index;
+                compute_queue_found = true;
+            }
         }
     }
 
@@ -358,12 +368,32 @@ bool Instance::CreateDevice() {
         return false;
     }
 
+    has_dedicated_compute_queue = compute_queue_found;
+    if (!compute_queue_found) {
+        compute_queue_family_index = queue_family_index;
+    }
+
     static constexpr std::array queue_priorities = {1.0f};
-    const vk::DeviceQueueCreateInfo queue_info = {
+    // Request device-level scheduling priority over other processes when the driver
+    // supports it, so guest CPU load sharing the machine cannot starve our queues.
+    static constexpr vk::DeviceQueueGlobalPriorityCreateInfoKHR global_priority_ci = {
+        .globalPriority = vk::QueueGlobalPriorityKHR::eHigh,
+    };
+    boost::container::static_vector<vk::DeviceQueueCreateInfo, 2> queue_infos;
+    queue_infos.push_back({
+        .pNext = global_priority ? &global_priority_ci : nullptr,
         .queueFamilyIndex = queue_family_index,
         .queueCount = static_cast<u32>(queue_priorities.size()),
         .pQueuePriorities = queue_priorities.data(),
-    };
+    });
+    if (has_dedicated_compute_queue) {
+        queue_infos.push_back({
+            .pNext = global_priority ? &global_priority_ci : nullptr,
+            .queueFamilyIndex = compute_queue_family_index,
+            .queueCount = 1u,
+            .pQueuePriorities = queue_priorities.data(),
+        });
+    }
 
     const auto topology_list_restart_features =
         feature_chain.get<vk::PhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>();
@@ -372,8 +402,8 @@ bool Instance::CreateDevice() {
     vk13_features = feature_chain.get<vk::PhysicalDeviceVulkan13Features>();
     vk::StructureChain device_chain = {
         vk::DeviceCreateInfo{
-            .queueCreateInfoCount = 1u,
-            .pQueueCreateInfos = &queue_info,
+            .queueCreateInfoCount = static_cast<u32>(queue_infos.size()),
+            .pQueueCreateInfos = queue_infos.data(),
             .enabledExtensionCount = static_cast<u32>(enabled_extensions.size()),
             .ppEnabledExtensionNames = enabled_extensions.data(),
         },
@@ -491,6 +521,9 @@ bool Instance::CreateDevice() {
             .shaderImageFloat32AtomicMinMax =
                 shader_atomic_float2_features.shaderImageFloat32AtomicMinMax,
         },
+        vk::PhysicalDeviceSwapchainMaintenance1FeaturesEXT{
+            .swapchainMaintenance1 = true,
+        },
         vk::PhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR{
             .workgroupMemoryExplicitLayout =
                 workgroup_memory_explicit_layout_features.workgroupMemoryExplicitLayout,
@@ -566,8 +599,23 @@ bool Instance::CreateDevice() {
     if (!workgroup_memory_explicit_layout) {
         device_chain.unlink<vk::PhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>();
     }
+    if (!swapchain_maintenance1) {
+        device_chain.unlink<vk::PhysicalDeviceSwapchainMaintenance1FeaturesEXT>();
+    }
 
     auto [device_result, dev] = physical_device.createDeviceUnique(device_chain.get());
+    if (device_result == vk::Result::eErrorNotPermittedKHR && global_priority) {
+        // Drivers may refuse an elevated queue priority to unprivileged processes;
+        // fall back to the default priority instead of failing device creation.
+        LOG_WARNING(Render_Vulkan, "High queue global priority denied, using default priority");
+        global_priority = false;
+        for (auto& queue_info : queue_infos) {
+            queue_info.pNext = nullptr;
+        }
+        auto retry = physical_device.createDeviceUnique(device_chain.get());
+        device_result = retry.result;
+        dev = std::move(retry.value);
+    }
     if (device_result != vk::Result::eSuccess) {
         LOG_CRITICAL(Render_Vulkan, "Failed to create device: {}", vk::to_string(device_result));
         return false;
@@ -578,6 +626,7 @@ bool Instance::CreateDevice() {
 
     graphics_queue = device->getQueue(queue_family_index, 0);
     present_queue = device->getQueue(queue_family_index, 0);
+    compute_queue = device->getQueue(compute_queue_family_index, 0);
 
     if (calibrated_timestamps) {
         const auto [time_domains_result, time_domains] =
@@ -736,6 +785,22 @@ u64 Instance::GetDeviceMemoryUsage() const {
     return total_usage;
 }
 
+u64 Instance::GetCurrentMemoryBudget() const {
+    vk::PhysicalDeviceMemoryBudgetPropertiesEXT memory_budget_props{};
+    vk::PhysicalDeviceMemoryProperties2 props = {
+        .pNext = &memory_budget_props,
+    };
+    physical_device.getMemoryProperties2(&props);
+
+    u64 total_budget = 0;
+    for (const size_t heap : valid_heaps) {
+        total_budget += memory_budget_props.heapBudget[heap];
+    }
+    // Keep the same system reservation that is applied to the construction-time budget.
+    const u64 system_memory = std::min<u64>(total_budget / 8, 1_GB);
+    return total_budget - system_memory;
+}
+
 vk::FormatFeatureFlags2 Instance::GetFormatFeatureFlags(vk::Format format) const {
     const auto it = format_properties.find(format);
     if (it == format_properties.end()) {
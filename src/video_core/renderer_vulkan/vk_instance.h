@@ -75,6 +75,20 @@ public:
         return present_queue;
     }
 
+    u32 GetComputeQueueFamilyIndex() const {
+        return compute_queue_family_index;
+    }
+
+    /// Queue used for ASC submissions; aliases the graphics queue when the device
+    /// has no compute-only family.
+    vk::Queue GetComputeQueue() const {
+        return compute_queue;
+    }
+
+    bool HasDedicatedComputeQueue() const {
+        return has_dedicated_compute_queue;
+    }
+
     TracyVkCtx GetProfilerContext() const {
         return profiler_context;
     }
@@ -129,6 +143,11 @@ public:
         return custom_border_color;
     }
 
+    /// Returns true when VK_EXT_swapchain_maintenance1 is supported
+    bool IsSwapchainMaintenance1Supported() const {
+        return swapchain_maintenance1;
+    }
+
     /// Returns true when VK_EXT_shader_stencil_export is supported
     bool IsShaderStencilExportSupported() const {
         return shader_stencil_export;
@@ -370,6 +389,16 @@ public:
         return push_descriptor_props.maxPushDescriptors;
     }
 
+    /// Returns the number of nanoseconds a timestamp query tick corresponds to.
+    float GetTimestampPeriod() const {
+        return properties.limits.timestampPeriod;
+    }
+
+    /// Returns true when host query reset is supported.
+    bool IsHostQueryResetSupported() const {
+        return vk12_features.hostQueryReset;
+    }
+
     /// Returns the vulkan 1.2 physical device properties.
     const vk::PhysicalDeviceVulkan12Properties& GetVk12Properties() const noexcept {
         return vk12_props;
@@ -434,6 +463,10 @@ public:
         return total_memory_budget;
     }
 
+    /// Returns a fresh memory budget from the driver. Unlike the construction-time total,
+    /// this shrinks when other processes claim device memory.
+    [[nodiscard]] u64 GetCurrentMemoryBudget() const;
+
     /// Determines if a format is supported for a set of feature flags.
     [[nodiscard]] bool IsFormatSupported(vk::Format format, vk::FormatFeatureFlags2 flags) const;
 
@@ -477,11 +510,14 @@ private:
     VmaAllocator allocator{};
     vk::Queue present_queue;
     vk::Queue graphics_queue;
+    vk::Queue compute_queue;
     std::vector<vk::PhysicalDevice> physical_devices;
     std::vector<std::string> available_extensions;
     std::unordered_map<vk::Format, vk::FormatProperties3> format_properties;
     TracyVkCtx profiler_context{};
     u32 queue_family_index{0};
+    u32 compute_queue_family_index{0};
+    bool has_dedicated_compute_queue{};
     bool custom_border_color{};
     bool fragment_shader_barycentric{};
     bool amd_shader_explicit_vertex_parameter{};
@@ -505,8 +541,10 @@ private:
     bool workgroup_memory_explicit_layout{};
     bool portability_subset{};
     bool maintenance_8{};
+    bool swapchain_maintenance1{};
     bool attachment_feedback_loop{};
     bool supports_memory_budget{};
+    bool global_priority{};
     u64 total_memory_budget{};
     std::vector<size_t> valid_heaps;
 };
@@ -1,12 +1,21 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <ranges>
 
 #include "common/config.h"
 #include "common/hash.h"
 #include "common/io_file.h"
 #include "common/path_util.h"
+#include "common/polyfill_thread.h"
+#include "common/scope_exit.h"
+#include "common/serdes.h"
+#include "common/thread.h"
+#include "common/trace_profiler.h"
 #include "core/debug_state.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/info.h"
@@ -273,18 +282,77 @@ PipelineCache::PipelineCache(const Instance& instance_, Scheduler& scheduler_,
         .needs_clip_distance_emulation = instance.GetDriverID() == vk::DriverId::eNvidiaProprietary,
     };
 
-    WarmUp();
+    if (Config::isPipelineCacheEnabled()) {
+        Storage::DataBase::Instance().Open();
+    }
+    // Prime the driver cache with the blob from the previous session before the warm-up,
+    // so the preloaded pipelines compile through it instead of from scratch.
+    pipeline_cache =
+        CreatePrimedPipelineCache(instance.GetPhysicalDevice(), instance.GetDevice(), "driver");
 
-    auto [cache_result, cache] = instance.GetDevice().createPipelineCacheUnique({});
-    ASSERT_MSG(cache_result == vk::Result::eSuccess, "Failed to create pipeline cache: {}",
-               vk::to_string(cache_result));
-    pipeline_cache = std::move(cache);
+    WarmUp();
 }
 
 PipelineCache::~PipelineCache() = default;
 
+void PipelineCache::DrainAsyncResults() {
+    std::vector<AsyncGraphicsResult> done;
+    std::vector<AsyncPermutResult> permuts;
+    {
+        std::scoped_lock lk{async_mutex};
+        if (async_results.empty() && async_permuts.empty()) {
+            return;
+        }
+        done.swap(async_results);
+        permuts.swap(async_permuts);
+    }
+    for (auto& permut : permuts) {
+        const auto it_pgm = program_cache.find(permut.pgm_hash);
+        if (it_pgm == program_cache.end()) {
+            instance.GetDevice().destroyShaderModule(permut.module);
+            continue;
+        }
+        auto& program = it_pgm.value();
+        permut.spec.info = &program->info;
+        const auto it = std::ranges::find(program->modules, permut.spec, &Program::Module::spec);
+        const bool slot_taken =
+            program->modules.size() > permut.perm_idx && program->modules[permut.perm_idx].module;
+        if (it != program->modules.end() || slot_taken) {
+            // The draw thread got there first, the speculative module is redundant.
+            instance.GetDevice().destroyShaderModule(permut.module);
+            continue;
+        }
+        program->InsertPermut(permut.module, std::move(permut.spec), permut.perm_idx);
+    }
+    for (auto& result : done) {
+        RegisterPipelineData(result.key, result.pipeline_hash, result.sdata);
+        ++num_new_pipelines;
+
+        if (Config::collectShadersForDebug()) {
+            for (auto stage = 0; stage < MaxShaderStages; ++stage) {
+                if (result.infos[stage]) {
+                    module_related_pipelines[result.modules[stage]].emplace_back(result.key);
+                }
+            }
+        }
+        result.pipeline->SetLRUId(graphics_lru.Insert(result.key, gc_tick));
+        graphics_pipelines[result.key] = std::move(result.pipeline);
+    }
+}
+
 const GraphicsPipeline* PipelineCache::GetGraphicsPipeline() {
+    PROFILE_SCOPE("PipelineCache::GetGraphicsPipeline");
+    DrainAsyncResults();
+    // Fast path: consecutive draws without a single register change reuse the previous
+    // pipeline outright instead of rebuilding and rehashing the whole key.
+    last_pipeline_reused = !liverpool->AckGraphicsStateDirty() && last_graphics_pipeline;
+    if (last_pipeline_reused) {
+        graphics_lru.Touch(last_graphics_pipeline->LRUId(), gc_tick);
+        last_graphics_pipeline->AddUsage();
+        return last_graphics_pipeline;
+    }
     if (!RefreshGraphicsKey()) {
+        last_graphics_pipeline = nullptr;
         return nullptr;
     }
     const auto [it, is_new] = graphics_pipelines.try_emplace(graphics_key);
@@ -292,10 +360,51 @@ const GraphicsPipeline* PipelineCache::GetGraphicsPipeline() {
         const auto pipeline_hash = std::hash<GraphicsPipelineKey>{}(graphics_key);
         LOG_DEBUG(Render_Vulkan, "Compiling graphics pipeline {:#x}", pipeline_hash);
 
+        if (Config::getAsyncShaderCompilation()) {
+            // The null map entry marks the pipeline as in-flight; draws hitting it are
+            // skipped until a later DrainAsyncResults() publishes the compiled pipeline.
+            compiler.Enqueue([this, key = graphics_key, pipeline_hash, infos = infos,
+                              runtime_infos = runtime_infos, fetch_shader = fetch_shader,
+                              modules = modules]() mutable {
+                AsyncGraphicsResult result{
+                    .key = key,
+                    .pipeline_hash = pipeline_hash,
+                    .infos = infos,
+                    .modules = modules,
+                };
+                const auto start = std::chrono::steady_clock::now();
+                result.pipeline = std::make_unique<GraphicsPipeline>(
+                    instance, scheduler, desc_heap, profile, result.key, *pipeline_cache, infos,
+                    runtime_infos, fetch_shader, modules, result.sdata, false);
+                DebugState.RecordPipelineCompileTime(
+                    std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() -
+                                                             start)
+                        .count());
+                std::scoped_lock lk{async_mutex};
+                async_results.emplace_back(std::move(result));
+            });
+            fetch_shader.reset();
+            last_graphics_pipeline = nullptr;
+            return nullptr;
+        }
+
         GraphicsPipeline::SerializationSupport sdata{};
-        it.value() = std::make_unique<GraphicsPipeline>(
-            instance, scheduler, desc_heap, profile, graphics_key, *pipeline_cache, infos,
-            runtime_infos, fetch_shader, modules, sdata, false);
+        // Hand construction off to the compile workers so expensive vkCreateGraphicsPipelines
+        // calls never run on the GPU emulation thread. The first draw with a new key still
+        // blocks on the result, but warm-up and preloading can issue many jobs at once.
+        auto future = compiler.EnqueueWithResult([&] {
+            const auto start = std::chrono::steady_clock::now();
+            auto pipeline = std::make_unique<GraphicsPipeline>(instance, scheduler, desc_heap,
+                                                               profile, graphics_key,
+                                                               *pipeline_cache, infos,
+                                                               runtime_infos, fetch_shader, modules,
+                                                               sdata, false);
+            DebugState.RecordPipelineCompileTime(
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start)
+                    .count());
+            return pipeline;
+        });
+        it.value() = future.get();
 
         RegisterPipelineData(graphics_key, pipeline_hash, sdata);
         ++num_new_pipelines;
@@ -309,11 +418,19 @@ const GraphicsPipeline* PipelineCache::GetGraphicsPipeline() {
             }
         }
         fetch_shader.reset();
+        it.value()->SetLRUId(graphics_lru.Insert(graphics_key, gc_tick));
+    } else if (it->second) {
+        graphics_lru.Touch(it->second->LRUId(), gc_tick);
     }
-    return it->second.get();
+    last_graphics_pipeline = it->second.get();
+    if (last_graphics_pipeline) {
+        last_graphics_pipeline->AddUsage();
+    }
+    return last_graphics_pipeline;
 }
 
 const ComputePipeline* PipelineCache::GetComputePipeline() {
+    PROFILE_SCOPE("PipelineCache::GetComputePipeline");
     if (!RefreshComputeKey()) {
         return nullptr;
     }
@@ -323,9 +440,17 @@ const ComputePipeline* PipelineCache::GetComputePipeline() {
         LOG_INFO(Render_Vulkan, "Compiling compute pipeline {:#x}", pipeline_hash);
 
         ComputePipeline::SerializationSupport sdata{};
-        it.value() = std::make_unique<ComputePipeline>(instance, scheduler, desc_heap, profile,
-                                                       *pipeline_cache, compute_key, *infos[0],
-                                                       modules[0], sdata, false);
+        auto future = compiler.EnqueueWithResult([&] {
+            const auto start = std::chrono::steady_clock::now();
+            auto pipeline = std::make_unique<ComputePipeline>(instance, scheduler, desc_heap,
+                                                              profile, *pipeline_cache, compute_key,
+                                                              *infos[0], modules[0], sdata, false);
+            DebugState.RecordPipelineCompileTime(
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start)
+                    .count());
+            return pipeline;
+        });
+        it.value() = future.get();
         RegisterPipelineData(compute_key, sdata);
         ++num_new_pipelines;
 
@@ -333,10 +458,69 @@ const ComputePipeline* PipelineCache::GetComputePipeline() {
             auto& m = modules[0];
             module_related_pipelines[m].emplace_back(compute_key);
         }
+        it.value()->SetLRUId(compute_lru.Insert(compute_key, gc_tick));
+    } else if (it->second) {
+        compute_lru.Touch(it->second->LRUId(), gc_tick);
     }
     return it->second.get();
 }
 
+void PipelineCache::RunGarbageCollector() {
+    SCOPE_EXIT {
+        ++gc_tick;
+    };
+    // The emulator terminates through quick_exit, so no destructor gets a chance to flush
+    // the driver cache blob on shutdown; persist it periodically once new pipelines arrive.
+    static constexpr u64 DriverCacheFlushInterval = 1024;
+    if (num_new_pipelines != num_flushed_pipelines && gc_tick % DriverCacheFlushInterval == 0) {
+        SavePipelineCache(instance.GetDevice(), *pipeline_cache, "driver");
+        num_flushed_pipelines = num_new_pipelines;
+    }
+    // Long sessions in open-world titles accumulate tens of thousands of pipelines, most
+    // of which are never bound again. Once over budget, retire the ones that have not been
+    // used for many submits; a later cache miss simply rebuilds them (or reloads from the
+    // archive). Destruction is deferred so in-flight command buffers keep their handles.
+    static constexpr size_t MaxLivePipelines = 4096;
+    static constexpr u64 TicksToDestroy = 512;
+    static constexpr size_t MaxDeletionsPerTick = 32;
+    if (gc_tick < TicksToDestroy ||
+        graphics_pipelines.size() + compute_pipelines.size() < MaxLivePipelines) {
+        return;
+    }
+    size_t num_deletions = MaxDeletionsPerTick;
+    const auto evict_graphics = [&](const GraphicsPipelineKey& key) {
+        if (num_deletions == 0) {
+            return;
+        }
+        const auto it = graphics_pipelines.find(key);
+        if (it == graphics_pipelines.end() || !it->second ||
+            it->second.get() == last_graphics_pipeline) {
+            return;
+        }
+        graphics_lru.Free(it->second->LRUId());
+        scheduler.DeferOperation(
+            [pipeline = std::move(it.value())]() mutable { pipeline.reset(); });
+        graphics_pipelines.erase(it);
+        --num_deletions;
+    };
+    graphics_lru.ForEachItemBelow(gc_tick - TicksToDestroy, evict_graphics);
+    const auto evict_compute = [&](const ComputePipelineKey& key) {
+        if (num_deletions == 0) {
+            return;
+        }
+        const auto it = compute_pipelines.find(key);
+        if (it == compute_pipelines.end() || !it->second) {
+            return;
+        }
+        compute_lru.Free(it->second->LRUId());
+        scheduler.DeferOperation(
+            [pipeline = std::move(it.value())]() mutable { pipeline.reset(); });
+        compute_pipelines.erase(it);
+        --num_deletions;
+    };
+    compute_lru.ForEachItemBelow(gc_tick - TicksToDestroy, evict_compute);
+}
+
 bool ShouldSkipShader(u64 shader_hash, const char* shader_type) {
     std::vector<u64> skip_hashes = Config::hashesToSkip();
     shader_hash = shader_hash & INT64_MAX;
@@ -564,8 +748,18 @@ vk::ShaderModule PipelineCache::CompileModule(Shader::Info& info, Shader::Runtim
              perm_idx != 0 ? "(permutation)" : "");
     DumpShader(code, info.pgm_hash, info.stage, perm_idx, "bin");
 
-    const auto ir_program = Shader::TranslateProgram(code, pools, info, runtime_info, profile);
+    Shader::TranslateTimes times{};
+    const auto ir_program =
+        Shader::TranslateProgram(code, pools, info, runtime_info, profile, &times);
+    const auto emit_start = std::chrono::steady_clock::now();
     auto spv = Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, ir_program, binding);
+    const auto emit_ms =
+        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - emit_start)
+            .count();
+    DebugState.RecordShaderCompileTime(times.frontend_ms, times.passes_ms, emit_ms);
+    for (const auto& pass : times.passes) {
+        DebugState.RecordPassStat(pass.name, pass.time_ms, pass.inst_delta);
+    }
     DumpShader(spv, info.pgm_hash, info.stage, perm_idx, "spv");
 
     vk::ShaderModule module;
@@ -596,6 +790,18 @@ PipelineCache::Result PipelineCache::GetProgram(Stage stage, LogicalStage l_stag
     auto runtime_info = BuildRuntimeInfo(stage, l_stage);
     auto [it_pgm, new_program] = program_cache.try_emplace(params.hash);
     if (new_program) {
+        // Engines duplicate shader bodies across PRTs with only the header differing.
+        // If the instruction bytes match an already-translated program, alias to it;
+        // the existing-program path below re-actualizes base address and user data
+        // per draw anyway, so a byte-identical body is the same program.
+        const u64 code_hash = XXH3_64bits(params.code.data(), params.code.size_bytes());
+        const auto [alias_it, code_is_new] = program_code_aliases.try_emplace(code_hash, params.hash);
+        if (!code_is_new && alias_it->second != params.hash) {
+            program_cache.erase(params.hash);
+            auto canonical_params = params;
+            canonical_params.hash = alias_it->second;
+            return GetProgram(stage, l_stage, canonical_params, binding);
+        }
         it_pgm.value() = std::make_unique<Program>(stage, l_stage, params);
         auto& program = it_pgm.value();
         auto start = binding;
@@ -605,6 +811,7 @@ PipelineCache::Result PipelineCache::GetProgram(Stage stage, LogicalStage l_stag
 
         RegisterShaderMeta(program->info, spec.fetch_shader_data, spec, perm_hash, 0);
         program->AddPermut(module, std::move(spec));
+        SchedulePermutationPrefetch(params.hash);
         return std::make_tuple(&program->info, module, program->modules[0].spec.fetch_shader_data,
                                perm_hash);
     }
@@ -638,6 +845,53 @@ PipelineCache::Result PipelineCache::GetProgram(Stage stage, LogicalStage l_stag
                            program->modules[perm_idx].spec.fetch_shader_data, perm_hash);
 }
 
+void PipelineCache::SchedulePermutationPrefetch(u64 pgm_hash) {
+    if (!Storage::DataBase::Instance().IsOpened()) {
+        return;
+    }
+    // Permutation indices recorded by previous runs are dense, so probing stops at the
+    // first missing meta entry. Archive reads stay on this thread (the zip reader is not
+    // thread-safe); only the module compilation is pushed to the workers.
+    for (size_t perm_idx = 1; perm_idx < Program::MaxPermutations; ++perm_idx) {
+        std::vector<u8> meta_blob;
+        Storage::DataBase::Instance().Load(Storage::BlobType::ShaderMeta,
+                                           fmt::format("{:#018x}", HashCombine(pgm_hash, perm_idx)),
+                                           meta_blob);
+        if (meta_blob.empty()) {
+            break;
+        }
+        auto meta = std::make_unique<Program>();
+        Shader::StageSpecialization spec{};
+        spec.info = &meta->info;
+        std::optional<Shader::Gcn::FetchShaderData> fetch_shader_data{};
+        size_t stored_idx{};
+        Serialization::Archive ar{std::move(meta_blob)};
+        if (!LoadShaderMeta(ar, meta->info, fetch_shader_data, spec, stored_idx)) {
+            break;
+        }
+        std::vector<u32> spv;
+        Storage::DataBase::Instance().Load(Storage::BlobType::ShaderBinary,
+                                           fmt::format("{:#018x}_{}", pgm_hash, perm_idx), spv);
+        if (spv.empty()) {
+            continue;
+        }
+        LOG_DEBUG(Render_Vulkan, "Speculatively compiling permutation {} of shader {:#x}", perm_idx,
+                  pgm_hash);
+        compiler.Enqueue([this, pgm_hash, perm_idx, spv = std::move(spv), meta = std::move(meta),
+                          spec = std::move(spec)]() mutable {
+            AsyncPermutResult result{
+                .pgm_hash = pgm_hash,
+                .perm_idx = perm_idx,
+                .module = CompileSPV(spv, instance.GetDevice()),
+                .meta = std::move(meta),
+                .spec = std::move(spec),
+            };
+            std::scoped_lock lk{async_mutex};
+            async_permuts.emplace_back(std::move(result));
+        });
+    }
+}
+
 std::optional<vk::ShaderModule> PipelineCache::ReplaceShader(vk::ShaderModule module,
                                                              std::span<const u32> spv_code) {
     std::optional<vk::ShaderModule> new_module{};
@@ -652,14 +906,28 @@ std::optional<vk::ShaderModule> PipelineCache::ReplaceShader(vk::ShaderModule mo
         }
     }
     if (module_related_pipelines.contains(module)) {
+        // The previous pipeline may be among the erased ones, drop the fast-path entry.
+        last_graphics_pipeline = nullptr;
         auto& pipeline_keys = module_related_pipelines[module];
         for (auto& key : pipeline_keys) {
             if (std::holds_alternative<GraphicsPipelineKey>(key)) {
                 auto& graphics_key = std::get<GraphicsPipelineKey>(key);
-                graphics_pipelines.erase(graphics_key);
+                if (const auto it = graphics_pipelines.find(graphics_key);
+                    it != graphics_pipelines.end()) {
+                    if (it->second) {
+                        graphics_lru.Free(it->second->LRUId());
+                    }
+                    graphics_pipelines.erase(it);
+                }
             } else if (std::holds_alternative<ComputePipelineKey>(key)) {
                 auto& compute_key = std::get<ComputePipelineKey>(key);
-                compute_pipelines.erase(compute_key);
+                if (const auto it = compute_pipelines.find(compute_key);
+                    it != compute_pipelines.end()) {
+                    if (it->second) {
+                        compute_lru.Free(it->second->LRUId());
+                    }
+                    compute_pipelines.erase(it);
+                }
             }
         }
     }
@@ -674,6 +942,54 @@ std::string PipelineCache::GetShaderName(Shader::Stage stage, u64 hash,
     return fmt::format("{}_{:#018x}", stage, hash);
 }
 
+namespace {
+
+// Dump requests come from the compile workers; the file I/O runs on a dedicated low
+// priority writer so enabling dumps for triage doesn't perturb compilation timing.
+std::mutex dump_mutex;
+std::condition_variable_any dump_cv;
+std::deque<std::pair<std::filesystem::path, std::vector<u32>>> dump_queue;
+std::jthread dump_writer;
+
+void WriteShaderDump(const std::filesystem::path& path, std::span<const u32> code) {
+    using namespace Common::FS;
+    std::error_code ec{};
+    std::filesystem::create_directories(path.parent_path(), ec);
+    const auto file = IOFile{path, FileAccessMode::Create};
+    file.WriteSpan(code);
+}
+
+void ShaderDumpThread(std::stop_token stoken) {
+    Common::SetCurrentThreadName("shadPS4:ShaderDumpWriter");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::Low);
+
+    std::unique_lock lk{dump_mutex};
+    while (true) {
+        Common::CondvarWait(dump_cv, lk, stoken, [] { return !dump_queue.empty(); });
+        if (stoken.stop_requested() && dump_queue.empty()) {
+            break;
+        }
+        while (!dump_queue.empty()) {
+            const auto [path, code] = std::move(dump_queue.front());
+            dump_queue.pop_front();
+            lk.unlock();
+            WriteShaderDump(path, code);
+            lk.lock();
+        }
+    }
+}
+
+void EnqueueShaderDump(std::filesystem::path&& path, std::vector<u32>&& code) {
+    std::scoped_lock lock{dump_mutex};
+    if (!dump_writer.joinable()) {
+        dump_writer = std::jthread{ShaderDumpThread};
+    }
+    dump_queue.emplace_back(std::move(path), std::move(code));
+    dump_cv.notify_one();
+}
+
+} // Anonymous namespace
+
 void PipelineCache::DumpShader(std::span<const u32> code, u64 hash, Shader::Stage stage,
                                size_t perm_idx, std::string_view ext) {
     if (!Config::dumpShaders()) {
@@ -682,12 +998,46 @@ void PipelineCache::DumpShader(std::span<const u32> code, u64 hash, Shader::Stag
 
     using namespace Common::FS;
     const auto dump_dir = GetUserPath(PathType::ShaderDir) / "dumps";
-    if (!std::filesystem::exists(dump_dir)) {
-        std::filesystem::create_directories(dump_dir);
-    }
     const auto filename = fmt::format("{}.{}", GetShaderName(stage, hash, perm_idx), ext);
-    const auto file = IOFile{dump_dir / filename, FileAccessMode::Create};
-    file.WriteSpan(code);
+    EnqueueShaderDump(dump_dir / filename, std::vector<u32>(code.begin(), code.end()));
+}
+
+// Packs all loose .spv patches into a single mapped file so cold boots don't pay for
+// thousands of tiny file opens. Keys are hashes of the shader name used for the loose files.
+static void BuildPatchPack(const std::filesystem::path& patch_dir,
+                           const std::filesystem::path& pack_path) {
+    std::filesystem::file_time_type pack_time{};
+    if (std::filesystem::exists(pack_path)) {
+        pack_time = std::filesystem::last_write_time(pack_path);
+    }
+    bool stale = false;
+    u32 num_patches = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(patch_dir)) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".spv") {
+            continue;
+        }
+        ++num_patches;
+        stale |= entry.last_write_time() > pack_time;
+    }
+    if (num_patches == 0 || !stale) {
+        return;
+    }
+
+    std::vector<std::pair<u64, std::vector<u32>>> shaders;
+    shaders.reserve(num_patches);
+    for (const auto& entry : std::filesystem::directory_iterator(patch_dir)) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".spv") {
+            continue;
+        }
+        const auto stem = entry.path().stem().string();
+        const Common::FS::IOFile file{entry.path(), Common::FS::FileAccessMode::Read};
+        std::vector<u32> code(file.GetSize() / sizeof(u32));
+        file.Read(code);
+        shaders.emplace_back(XXH3_64bits(stem.data(), stem.size()), std::move(code));
+    }
+    if (Storage::ShaderPack::Write(pack_path, shaders)) {
+        LOG_INFO(Render_Vulkan, "Packed {} shader patches", shaders.size());
+    }
 }
 
 std::optional<std::vector<u32>> PipelineCache::GetShaderPatch(u64 hash, Shader::Stage stage,
@@ -699,7 +1049,20 @@ std::optional<std::vector<u32>> PipelineCache::GetShaderPatch(u64 hash, Shader::
     if (!std::filesystem::exists(patch_dir)) {
         std::filesystem::create_directories(patch_dir);
     }
-    const auto filename = fmt::format("{}.{}", GetShaderName(stage, hash, perm_idx), ext);
+    const auto name = GetShaderName(stage, hash, perm_idx);
+    if (!patch_pack_checked) {
+        patch_pack_checked = true;
+        const auto pack_path = patch_dir / "patches.pack";
+        BuildPatchPack(patch_dir, pack_path);
+        patch_pack.Open(pack_path);
+    }
+    if (patch_pack.IsOpened()) {
+        const u64 key = XXH3_64bits(name.data(), name.size());
+        if (const auto code = patch_pack.Find(key); !code.empty()) {
+            return std::vector<u32>(code.begin(), code.end());
+        }
+    }
+    const auto filename = fmt::format("{}.{}", name, ext);
     const auto filepath = patch_dir / filename;
     if (!std::filesystem::exists(filepath)) {
         return {};
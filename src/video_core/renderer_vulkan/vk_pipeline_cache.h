@@ -3,14 +3,20 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <variant>
 #include <tsl/robin_map.h>
+#include "common/lru_cache.h"
 #include "shader_recompiler/profile.h"
 #include "shader_recompiler/recompiler.h"
 #include "shader_recompiler/specialization.h"
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
+#include "video_core/renderer_vulkan/vk_pipeline_compiler.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
+#include "video_core/shader_pack.h"
 
 template <>
 struct std::hash<vk::ShaderModule> {
@@ -71,6 +77,16 @@ public:
 
     void WarmUp();
     void Sync();
+    /// Persists the most-used pipelines of this session so the next warm-up compiles them first.
+    void SaveHotList();
+
+    /// Warm-up progress the GUI can poll while the archive is pre-compiled.
+    struct WarmUpProgress {
+        std::atomic<u32> total{};
+        std::atomic<u32> done{};
+        std::atomic<bool> active{};
+    };
+    static const WarmUpProgress& GetWarmUpProgress();
 
     bool LoadComputePipeline(Serialization::Archive& ar);
     bool LoadGraphicsPipeline(Serialization::Archive& ar);
@@ -78,8 +94,18 @@ public:
 
     const GraphicsPipeline* GetGraphicsPipeline();
 
+    /// Whether the last GetGraphicsPipeline call reused the previous pipeline without a
+    /// single draw-state register changing; the rasterizer skips redundant per-draw state
+    /// recomputation when set.
+    bool IsLastPipelineReused() const {
+        return last_pipeline_reused;
+    }
+
     const ComputePipeline* GetComputePipeline();
 
+    /// Evicts host pipelines that have not been bound for many submissions.
+    void RunGarbageCollector();
+
     using Result = std::tuple<const Shader::Info*, vk::ShaderModule,
                               std::optional<Shader::Gcn::FetchShaderData>, u64>;
     Result GetProgram(Shader::Stage stage, Shader::LogicalStage l_stage,
@@ -100,6 +126,9 @@ private:
     bool RefreshGraphicsStages();
     bool RefreshComputeKey();
 
+    void DrainAsyncResults();
+    void SchedulePermutationPrefetch(u64 pgm_hash);
+
     void DumpShader(std::span<const u32> code, u64 hash, Shader::Stage stage, size_t perm_idx,
                     std::string_view ext);
     std::optional<std::vector<u32>> GetShaderPatch(u64 hash, Shader::Stage stage, size_t perm_idx,
@@ -118,11 +147,15 @@ private:
     Scheduler& scheduler;
     AmdGpu::Liverpool* liverpool;
     DescriptorHeap desc_heap;
+    PipelineCompiler compiler;
     vk::UniquePipelineCache pipeline_cache;
     vk::UniquePipelineLayout pipeline_layout;
     Shader::Profile profile{};
     Shader::Pools pools;
     tsl::robin_map<size_t, std::unique_ptr<Program>> program_cache;
+    // Canonical embedded hash per raw-bytecode hash; duplicate shader bodies that only
+    // differ in their headers share one program instead of recompiling.
+    tsl::robin_map<u64, u64> program_code_aliases;
     tsl::robin_map<ComputePipelineKey, std::unique_ptr<ComputePipeline>> compute_pipelines;
     tsl::robin_map<GraphicsPipelineKey, std::unique_ptr<GraphicsPipeline>> graphics_pipelines;
     std::array<Shader::RuntimeInfo, MaxShaderStages> runtime_infos{};
@@ -131,7 +164,45 @@ private:
     std::optional<Shader::Gcn::FetchShaderData> fetch_shader{};
     GraphicsPipelineKey graphics_key{};
     ComputePipelineKey compute_key{};
-    u32 num_new_pipelines{}; // new pipelines added to the cache since the game start
+    // Result of the previous lookup, reused while no draw-state register changed
+    const GraphicsPipeline* last_graphics_pipeline{};
+    // True when the last GetGraphicsPipeline call hit the reuse fast path
+    bool last_pipeline_reused{};
+    // LRU state driving eviction of long-unused host pipelines
+    Common::LeastRecentlyUsedCache<GraphicsPipelineKey, u64> graphics_lru;
+    Common::LeastRecentlyUsedCache<ComputePipelineKey, u64> compute_lru;
+    u64 gc_tick{};
+    u32 num_new_pipelines{};     // new pipelines added to the cache since the game start
+    u32 num_flushed_pipelines{}; // pipeline count at the last driver cache blob flush
+
+    // Pipelines built by warm-up jobs, moved into the caches once all workers are idle
+    std::deque<std::pair<GraphicsPipelineKey, std::unique_ptr<GraphicsPipeline>>> pending_graphics;
+    std::deque<std::pair<ComputePipelineKey, std::unique_ptr<ComputePipeline>>> pending_compute;
+
+    // Results of asynchronously compiled pipelines, drained on the GPU thread
+    struct AsyncGraphicsResult {
+        GraphicsPipelineKey key;
+        u64 pipeline_hash;
+        GraphicsPipeline::SerializationSupport sdata;
+        std::array<const Shader::Info*, MaxShaderStages> infos;
+        std::array<vk::ShaderModule, MaxShaderStages> modules;
+        std::unique_ptr<GraphicsPipeline> pipeline;
+    };
+    // Sibling permutations compiled speculatively from the archive
+    struct AsyncPermutResult {
+        u64 pgm_hash;
+        size_t perm_idx;
+        vk::ShaderModule module;
+        std::unique_ptr<Program> meta; // owns the info the specialization points at
+        Shader::StageSpecialization spec;
+    };
+    std::mutex async_mutex;
+    std::vector<AsyncGraphicsResult> async_results;
+    std::vector<AsyncPermutResult> async_permuts;
+
+    // Memory-mapped pack of shader patches, preferred over per-shader file opens
+    Storage::ShaderPack patch_pack;
+    bool patch_pack_checked{};
 
     // Only if Config::collectShadersForDebug()
     tsl::robin_map<vk::ShaderModule,
@@ -3,6 +3,7 @@
 
 #include <boost/container/static_vector.hpp>
 
+#include "common/hash.h"
 #include "shader_recompiler/resource.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_pipeline_cache.h"
@@ -19,6 +20,31 @@ Pipeline::Pipeline(const Instance& instance_, Scheduler& scheduler_, DescriptorH
 
 Pipeline::~Pipeline() = default;
 
+/// Fingerprints the resource table described by the descriptor writes. Sets whose
+/// fingerprints match bind the same buffers and images and can share a descriptor set.
+static u64 FingerprintSetWrites(vk::DescriptorSetLayout set_layout,
+                                const Pipeline::DescriptorWrites& set_writes) {
+    u64 hash = std::bit_cast<u64>(set_layout);
+    for (const auto& set_write : set_writes) {
+        hash = HashCombine(hash, (u64(set_write.dstBinding) << 32) |
+                                     u64(static_cast<u32>(set_write.descriptorType)));
+        for (u32 i = 0; i < set_write.descriptorCount; ++i) {
+            if (set_write.pBufferInfo) {
+                const auto& info = set_write.pBufferInfo[i];
+                hash = HashCombine(hash, std::bit_cast<u64>(info.buffer));
+                hash = HashCombine(hash, info.offset);
+                hash = HashCombine(hash, info.range);
+            } else if (set_write.pImageInfo) {
+                const auto& info = set_write.pImageInfo[i];
+                hash = HashCombine(hash, std::bit_cast<u64>(info.sampler));
+                hash = HashCombine(hash, std::bit_cast<u64>(info.imageView));
+                hash = HashCombine(hash, static_cast<u64>(info.imageLayout));
+            }
+        }
+    }
+    return hash;
+}
+
 void Pipeline::BindResources(DescriptorWrites& set_writes, const BufferBarriers& buffer_barriers,
                              const Shader::PushData& push_data) const {
     const auto cmdbuf = scheduler.CommandBuffer();
@@ -48,11 +74,17 @@ void Pipeline::BindResources(DescriptorWrites& set_writes, const BufferBarriers&
         return;
     }
 
-    const auto desc_set = desc_heap.Commit(*desc_layout);
-    for (auto& set_write : set_writes) {
-        set_write.dstSet = desc_set;
+    // Guest draws re-bind identical resource tables constantly; reuse the previously
+    // written descriptor set when the fingerprint of the writes is unchanged.
+    bool is_new{};
+    const auto desc_set =
+        desc_heap.CommitCached(*desc_layout, FingerprintSetWrites(*desc_layout, set_writes), is_new);
+    if (is_new) {
+        for (auto& set_write : set_writes) {
+            set_write.dstSet = desc_set;
+        }
+        instance.GetDevice().updateDescriptorSets(set_writes, {});
     }
-    instance.GetDevice().updateDescriptorSets(set_writes, {});
     cmdbuf.bindDescriptorSets(bind_point, *pipeline_layout, 0, desc_set, {});
 }
 
@@ -57,6 +57,23 @@ public:
         return is_compute;
     }
 
+    size_t LRUId() const noexcept {
+        return lru_id;
+    }
+
+    void SetLRUId(size_t id) noexcept {
+        lru_id = id;
+    }
+
+    size_t UseCount() const noexcept {
+        return use_count;
+    }
+
+    /// Bumps the per-session usage statistic; drives the warm-up hot list.
+    void AddUsage() const noexcept {
+        ++use_count;
+    }
+
     using DescriptorWrites = boost::container::small_vector<vk::WriteDescriptorSet, 16>;
     using BufferBarriers = boost::container::small_vector<vk::BufferMemoryBarrier2, 16>;
 
@@ -74,6 +91,8 @@ protected:
     vk::UniquePipelineLayout pipeline_layout;
     vk::UniqueDescriptorSetLayout desc_layout;
     std::array<const Shader::Info*, Shader::MaxStageTypes> stages{};
+    size_t lru_id{};
+    mutable size_t use_count{};
     bool uses_push_descriptors{};
     bool is_compute;
 };
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/logging/log.h"
+#include "common/task_scheduler.h"
+#include "video_core/renderer_vulkan/vk_pipeline_compiler.h"
+
+namespace Vulkan {
+
+PipelineCompiler::PipelineCompiler() {
+    LOG_INFO(Render_Vulkan, "Pipeline compiler using shared task pool with {} workers",
+             NumWorkers());
+}
+
+PipelineCompiler::~PipelineCompiler() {
+    // Queued jobs capture this object; let them drain before tearing it down.
+    WaitIdle();
+}
+
+void PipelineCompiler::Enqueue(Job job) {
+    num_pending.fetch_add(1, std::memory_order::acq_rel);
+    Common::TaskScheduler::Instance().Submit(
+        [this, job = std::move(job)]() mutable {
+            job();
+            if (num_pending.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+                std::scoped_lock lk{idle_mutex};
+                idle_cv.notify_all();
+            }
+        },
+        Common::TaskPriority::High);
+}
+
+void PipelineCompiler::WaitIdle() {
+    std::unique_lock lk{idle_mutex};
+    idle_cv.wait(lk, [this] { return num_pending.load(std::memory_order::acquire) == 0; });
+}
+
+u32 PipelineCompiler::NumWorkers() const noexcept {
+    return Common::TaskScheduler::Instance().NumWorkers();
+}
+
+} // namespace Vulkan
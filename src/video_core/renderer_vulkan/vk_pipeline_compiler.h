@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include "common/types.h"
+#include "common/unique_function.h"
+
+namespace Vulkan {
+
+/// Executes pipeline and shader module compile jobs off the GPU emulation thread on the shared
+/// Common::TaskScheduler pool, at high priority since draws block on the results. A shared
+/// VkPipelineCache may be used from all workers as the object is internally synchronized by the
+/// driver. This type only tracks completion so callers can wait for outstanding jobs.
+class PipelineCompiler {
+public:
+    using Job = Common::UniqueFunction<void>;
+
+    PipelineCompiler();
+    ~PipelineCompiler();
+
+    /// Schedules a compile job for execution on one of the worker threads.
+    void Enqueue(Job job);
+
+    /// Schedules a job and returns a future with its result.
+    template <typename F>
+    auto EnqueueWithResult(F&& func) {
+        using Result = std::invoke_result_t<F>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+        auto future = task->get_future();
+        Enqueue([task = std::move(task)] { (*task)(); });
+        return future;
+    }
+
+    /// Blocks until every queued job has finished executing.
+    void WaitIdle();
+
+    u32 NumWorkers() const noexcept;
+
+private:
+    std::atomic<u32> num_pending{};
+    std::mutex idle_mutex;
+    std::condition_variable idle_cv;
+};
+
+} // namespace Vulkan
@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
 #include "common/config.h"
 #include "common/serdes.h"
 #include "shader_recompiler/frontend/fetch_shader.h"
@@ -13,12 +17,19 @@
 namespace Serialization {
 /* You should increment versions below once corresponding serialization scheme is changed. */
 static constexpr u32 ShaderBinaryVersion = 1u;
-static constexpr u32 ShaderMetaVersion = 1u;
+static constexpr u32 ShaderMetaVersion = 2u;
 static constexpr u32 PipelineKeyVersion = 1u;
+static constexpr u32 PipelineHotListVersion = 1u;
 } // namespace Serialization
 
 namespace Vulkan {
 
+static PipelineCache::WarmUpProgress warmup_progress{};
+
+const PipelineCache::WarmUpProgress& PipelineCache::GetWarmUpProgress() {
+    return warmup_progress;
+}
+
 void RegisterPipelineData(const ComputePipelineKey& key,
                           ComputePipeline::SerializationSupport& sdata) {
     if (!Storage::DataBase::Instance().IsOpened()) {
@@ -159,12 +170,15 @@ bool PipelineCache::LoadComputePipeline(Serialization::Archive& ar) {
         return false;
     }
 
-    const auto [it, is_new] = compute_pipelines.try_emplace(compute_key);
-    ASSERT(is_new);
-
-    it.value() =
-        std::make_unique<ComputePipeline>(instance, scheduler, desc_heap, profile, *pipeline_cache,
-                                          compute_key, *infos[0], modules[0], sdata, true);
+    // The expensive pipeline construction runs on the compile workers; the result is
+    // moved into the cache once WarmUp() drains the pool.
+    auto& slot = pending_compute.emplace_back(compute_key, nullptr);
+    compiler.Enqueue([this, &slot, sdata, info = infos[0], module = modules[0]]() mutable {
+        slot.second = std::make_unique<ComputePipeline>(instance, scheduler, desc_heap, profile,
+                                                        *pipeline_cache, slot.first, *info, module,
+                                                        sdata, true);
+        ++warmup_progress.done;
+    });
 
     infos.fill(nullptr);
     modules.fill(nullptr);
@@ -234,12 +248,15 @@ bool PipelineCache::LoadGraphicsPipeline(Serialization::Archive& ar) {
         }
     }
 
-    const auto [it, is_new] = graphics_pipelines.try_emplace(graphics_key);
-    ASSERT(is_new);
-
-    it.value() = std::make_unique<GraphicsPipeline>(
-        instance, scheduler, desc_heap, profile, graphics_key, *pipeline_cache, infos,
-        runtime_infos, fetch_shader, modules, sdata, true);
+    auto& slot = pending_graphics.emplace_back(graphics_key, nullptr);
+    compiler.Enqueue([this, &slot, sdata, infos = infos, runtime_infos = runtime_infos,
+                      fetch_shader = fetch_shader, modules = modules]() mutable {
+        slot.second = std::make_unique<GraphicsPipeline>(instance, scheduler, desc_heap, profile,
+                                                         slot.first, *pipeline_cache, infos,
+                                                         runtime_infos, fetch_shader, modules,
+                                                         sdata, true);
+        ++warmup_progress.done;
+    });
 
     infos.fill(nullptr);
     modules.fill(nullptr);
@@ -322,33 +339,90 @@ void PipelineCache::WarmUp() {
     u32 num_pipelines{};
     u32 num_total_pipelines{};
 
+    // Ranks recorded at the end of the previous session; unranked pipelines keep their
+    // discovery order behind the ranked ones.
+    std::unordered_map<std::string, u32> hot_ranks{};
+    std::vector<u8> hot_blob{};
+    Storage::DataBase::Instance().Load(Storage::BlobType::PipelineHotList, "hotlist", hot_blob);
+    if (!hot_blob.empty()) {
+        Serialization::Archive hot_ar{std::move(hot_blob)};
+        Serialization::Reader hot{hot_ar};
+        u32 version{};
+        hot.Read(version);
+        if (version == Serialization::PipelineHotListVersion) {
+            u32 num_entries{};
+            hot.Read(num_entries);
+            for (u32 rank = 0; rank < num_entries; ++rank) {
+                u64 hash{};
+                hot.Read(hash);
+                hot_ranks.emplace(fmt::format("g_{:#018x}", hash), rank);
+            }
+        }
+    }
+
+    // Gather all recorded pipelines first so the total is known for progress reporting,
+    // then feed the compile workers with construction jobs, most-used pipelines first.
+    std::vector<std::pair<u32, std::vector<u8>>> blobs{};
     Storage::DataBase::Instance().ForEachBlob(
-        Storage::BlobType::PipelineKey, [&](std::vector<u8>&& data) {
-            ++num_total_pipelines;
+        Storage::BlobType::PipelineKey, [&](const std::string& name, std::vector<u8>&& data) {
+            const auto it = hot_ranks.find(name);
+            const u32 rank = it != hot_ranks.end() ? it->second : std::numeric_limits<u32>::max();
+            blobs.emplace_back(rank, std::move(data));
+        });
+    std::ranges::stable_sort(blobs, {}, &std::pair<u32, std::vector<u8>>::first);
 
-            Serialization::Archive ar{std::move(data)};
-            Serialization::Reader pldata{ar};
+    warmup_progress.total = static_cast<u32>(blobs.size());
+    warmup_progress.done = 0;
+    warmup_progress.active = true;
 
-            u32 version{};
-            pldata.Read(version);
-            if (version != Serialization::PipelineKeyVersion) {
-                return;
-            }
+    for (auto& [rank, blob] : blobs) {
+        ++num_total_pipelines;
 
-            u32 is_compute{};
-            pldata.Read(is_compute);
+        Serialization::Archive ar{std::move(blob)};
+        Serialization::Reader pldata{ar};
 
-            bool result{};
-            if (is_compute) {
-                result = LoadComputePipeline(ar);
-            } else {
-                result = LoadGraphicsPipeline(ar);
-            }
+        u32 version{};
+        pldata.Read(version);
+        if (version != Serialization::PipelineKeyVersion) {
+            ++warmup_progress.done;
+            continue;
+        }
 
-            if (result) {
-                ++num_pipelines;
-            }
-        });
+        u32 is_compute{};
+        pldata.Read(is_compute);
+
+        bool result{};
+        if (is_compute) {
+            result = LoadComputePipeline(ar);
+        } else {
+            result = LoadGraphicsPipeline(ar);
+        }
+
+        if (result) {
+            ++num_pipelines;
+        } else {
+            ++warmup_progress.done;
+        }
+    }
+
+    compiler.WaitIdle();
+
+    for (auto& [key, pipeline] : pending_graphics) {
+        const auto [it, is_new] = graphics_pipelines.try_emplace(key);
+        ASSERT(is_new);
+        pipeline->SetLRUId(graphics_lru.Insert(key, gc_tick));
+        it.value() = std::move(pipeline);
+    }
+    pending_graphics.clear();
+    for (auto& [key, pipeline] : pending_compute) {
+        const auto [it, is_new] = compute_pipelines.try_emplace(key);
+        ASSERT(is_new);
+        pipeline->SetLRUId(compute_lru.Insert(key, gc_tick));
+        it.value() = std::move(pipeline);
+    }
+    pending_compute.clear();
+
+    warmup_progress.active = false;
 
     LOG_INFO(Render, "Preloaded {} pipelines", num_pipelines);
     if (num_total_pipelines > num_pipelines) {
@@ -359,7 +433,38 @@ void PipelineCache::WarmUp() {
     Storage::DataBase::Instance().FinishPreload();
 }
 
+void PipelineCache::SaveHotList() {
+    if (!Storage::DataBase::Instance().IsOpened()) {
+        return;
+    }
+
+    // Most-used first; capped so one pathological session cannot bloat the blob.
+    static constexpr size_t MaxHotPipelines = 512;
+    std::vector<std::pair<size_t, u64>> counts{};
+    counts.reserve(graphics_pipelines.size());
+    for (const auto& [key, pipeline] : graphics_pipelines) {
+        if (pipeline && pipeline->UseCount() != 0) {
+            counts.emplace_back(pipeline->UseCount(), std::hash<GraphicsPipelineKey>{}(key));
+        }
+    }
+    if (counts.empty()) {
+        return;
+    }
+    std::ranges::sort(counts, std::ranges::greater{});
+    counts.resize(std::min(counts.size(), MaxHotPipelines));
+
+    Serialization::Archive ar{};
+    Serialization::Writer hot{ar};
+    hot.Write(Serialization::PipelineHotListVersion);
+    hot.Write(static_cast<u32>(counts.size()));
+    for (const auto& [count, hash] : counts) {
+        hot.Write(hash);
+    }
+    Storage::DataBase::Instance().Save(Storage::BlobType::PipelineHotList, "hotlist", ar.TakeOff());
+}
+
 void PipelineCache::Sync() {
+    SaveHotList();
     Storage::DataBase::Instance().Close();
 }
 
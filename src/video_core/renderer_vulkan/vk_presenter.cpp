@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/config.h"
+#include "common/config_watch.h"
 #include "common/debug.h"
 #include "common/elf_info.h"
 #include "common/singleton.h"
@@ -107,15 +108,19 @@ Presenter::Presenter(Frontend::WindowSDL& window_, AmdGpu::Liverpool* liverpool_
       instance{window, Config::getGpuId(), Config::vkValidationEnabled(),
                Config::getVkCrashDiagnosticEnabled()},
       draw_scheduler{instance}, present_scheduler{instance}, flip_scheduler{instance},
-      swapchain{instance, window},
+      compute_scheduler{instance, Scheduler::QueueType::AsyncCompute},
+      swapchain{instance, window}, frame_capture{instance},
       rasterizer{std::make_unique<Rasterizer>(instance, draw_scheduler, liverpool)},
       texture_cache{rasterizer->GetTextureCache()} {
-    const u32 num_images = swapchain.GetImageCount();
     const vk::Device device = instance.GetDevice();
 
-    // Create presentation frames.
-    present_frames.resize(num_images);
-    for (u32 i = 0; i < num_images; i++) {
+    // Create presentation frames. The pool is sized independently of the swapchain: with
+    // only two swapchain images the GPU thread would block in GetRenderFrame until
+    // presentation released one, feeding present pacing straight back into guest flip
+    // timing. Triple buffering the handoff keeps frame preparation decoupled.
+    const u32 num_frames = std::max(swapchain.GetImageCount(), 3U);
+    present_frames.resize(num_frames);
+    for (u32 i = 0; i < num_frames; i++) {
         Frame& frame = present_frames[i];
         frame.id = i;
         auto fence = Check<"create present done fence">(
@@ -128,16 +133,28 @@ Presenter::Presenter(Frontend::WindowSDL& window_, AmdGpu::Liverpool* liverpool_
     fsr_settings.use_rcas = Config::getRcasEnabled();
     fsr_settings.rcas_attenuation = static_cast<float>(Config::getRcasAttenuation() / 1000.f);
 
-    fsr_pass.Create(device, instance.GetAllocator(), num_images);
+    const std::array fsr_queue_families{instance.GetGraphicsQueueFamilyIndex(),
+                                        instance.GetComputeQueueFamilyIndex()};
+    fsr_pass.Create(device, instance.GetAllocator(), num_frames, fsr_queue_families);
     pp_pass.Create(device, swapchain.GetSurfaceFormat().format);
 
+    // Apply present mode changes from a config reload on the next present, since the
+    // notification arrives on the watch thread.
+    present_mode_watch = Config::Subscribe(Config::WatchField::PresentMode, [this](auto) {
+        present_mode_dirty.store(true, std::memory_order_relaxed);
+    });
+
     ImGui::Layer::AddLayer(Common::Singleton<Core::Devtools::Layer>::Instance());
 }
 
 Presenter::~Presenter() {
+    Config::Unsubscribe(present_mode_watch);
     ImGui::Layer::RemoveLayer(Common::Singleton<Core::Devtools::Layer>::Instance());
     draw_scheduler.Finish();
     const vk::Device device = instance.GetDevice();
+    for (const auto& [addr, entry] : direct_present_textures) {
+        ImGui::Vulkan::RemoveTexture(entry.texture);
+    }
     for (auto& frame : present_frames) {
         vmaDestroyImage(instance.GetAllocator(), frame.image, frame.allocation);
         device.destroyImageView(frame.image_view);
@@ -218,6 +235,25 @@ void Presenter::RecreateFrame(Frame* frame, u32 width, u32 height) {
     frame->is_hdr = swapchain.GetHDR();
 }
 
+ImTextureID Presenter::GetDirectTexture(VAddr cpu_address, vk::ImageView image_view) {
+    const auto [it, is_new] = direct_present_textures.try_emplace(cpu_address);
+    if (!is_new && it->second.view != image_view) {
+        // The texture cache recreated the guest image, so the cached descriptor refers to a
+        // destroyed view, possibly with its handle value recycled for an unrelated one. This
+        // is rare enough that draining the device before rebuilding is cheaper than tracking
+        // descriptor lifetimes against in-flight presents.
+        Check<"wait before direct texture rebuild">(instance.GetDevice().waitIdle());
+        ImGui::Vulkan::RemoveTexture(it->second.texture);
+        it->second = {};
+    }
+    if (!it->second.texture) {
+        it->second.view = image_view;
+        it->second.texture =
+            ImGui::Vulkan::AddTexture(image_view, vk::ImageLayout::eShaderReadOnlyOptimal);
+    }
+    return it->second.texture;
+}
+
 Frame* Presenter::PrepareLastFrame() {
     if (last_submit_frame == nullptr) {
         return nullptr;
@@ -260,10 +296,13 @@ Frame* Presenter::PrepareLastFrame() {
                                 .image = frame->image,
                                 .subresourceRange{frame_subresources}};
 
-    cmdbuf.pipelineBarrier2(vk::DependencyInfo{
-        .imageMemoryBarrierCount = 1,
-        .pImageMemoryBarriers = &pre_barrier,
-    });
+    // Direct frames are sampled straight from the guest image and never touch the frame image.
+    if (!frame->direct_texture) {
+        cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+            .imageMemoryBarrierCount = 1,
+            .pImageMemoryBarriers = &pre_barrier,
+        });
+    }
 
     // Flush frame creation commands.
     frame->ready_semaphore = scheduler.GetMasterSemaphore()->Handle();
@@ -319,10 +358,6 @@ Frame* Presenter::PrepareFrame(const Libraries::VideoOut::BufferAttributeGroup&
 
     draw_scheduler.EndRendering();
     const auto cmdbuf = draw_scheduler.CommandBuffer();
-    cmdbuf.pipelineBarrier2(vk::DependencyInfo{
-        .imageMemoryBarrierCount = 1,
-        .pImageMemoryBarriers = &pre_barrier,
-    });
 
     VideoCore::ImageViewInfo view_info{};
     view_info.format = GetFrameViewFormat(attribute.attrib.pixel_format);
@@ -336,24 +371,146 @@ Frame* Presenter::PrepareFrame(const Libraries::VideoOut::BufferAttributeGroup&
     const vk::Extent2D image_size = {image.info.size.width, image.info.size.height};
     expected_ratio = static_cast<float>(image_size.width) / static_cast<float>(image_size.height);
 
-    image_view = fsr_pass.Render(cmdbuf, image_view, image_size, {frame->width, frame->height},
-                                 fsr_settings, frame->is_hdr);
-    pp_pass.Render(cmdbuf, image_view, image_size, *frame, pp_settings);
-
     DebugState.game_resolution = {image_size.width, image_size.height};
     DebugState.output_resolution = {frame->width, frame->height};
 
+    // Guest buffers that already match the output surface and need no post-processing can be
+    // sampled by the present draw directly, skipping the intermediate frame copy.
+    frame->direct_texture = {};
+    const bool direct_present =
+        image_size.width == frame->width && image_size.height == frame->height &&
+        view_info.format == swapchain.GetSurfaceFormat().format && pp_settings.gamma == 1.0f &&
+        !frame->is_hdr;
+    if (direct_present) {
+        frame->direct_texture = GetDirectTexture(cpu_address, image_view);
+        frame->ready_semaphore = draw_scheduler.GetMasterSemaphore()->Handle();
+        frame->ready_tick = draw_scheduler.CurrentTick();
+        SubmitInfo info{};
+        draw_scheduler.Flush(info);
+        return frame;
+    }
+
+    // Hand the upscaling chain to the dedicated compute queue when one exists, so it overlaps
+    // with the next frame's rendering instead of serializing the graphics stream behind it.
+    const bool async_upscale =
+        instance.HasDedicatedComputeQueue() && fsr_settings.enable &&
+        (image_size.width < frame->width || image_size.height < frame->height);
+    if (!async_upscale) {
+        cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+            .imageMemoryBarrierCount = 1,
+            .pImageMemoryBarriers = &pre_barrier,
+        });
+
+        image_view = fsr_pass.Render(cmdbuf, image_view, image_size, {frame->width, frame->height},
+                                     fsr_settings, frame->is_hdr);
+        pp_pass.Render(cmdbuf, image_view, image_size, *frame, pp_settings);
+
+        // Flush frame creation commands.
+        frame->ready_semaphore = draw_scheduler.GetMasterSemaphore()->Handle();
+        frame->ready_tick = draw_scheduler.CurrentTick();
+        SubmitInfo info{};
+        draw_scheduler.Flush(info);
+        return frame;
+    }
+
+    // Release the guest image to the compute family. The FSR images themselves use concurrent
+    // sharing and need no ownership transfer.
+    const auto release_to_compute = vk::ImageMemoryBarrier2{
+        .srcStageMask = vk::PipelineStageFlagBits2::eAllCommands,
+        .srcAccessMask = vk::AccessFlagBits2::eMemoryWrite,
+        .dstStageMask = vk::PipelineStageFlagBits2::eAllCommands,
+        .dstAccessMask = vk::AccessFlagBits2::eNone,
+        .oldLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .newLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .srcQueueFamilyIndex = instance.GetGraphicsQueueFamilyIndex(),
+        .dstQueueFamilyIndex = instance.GetComputeQueueFamilyIndex(),
+        .image = image.GetImage(),
+        .subresourceRange{frame_subresources},
+    };
+    cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+        .imageMemoryBarrierCount = 1,
+        .pImageMemoryBarriers = &release_to_compute,
+    });
+    const u64 draw_tick = draw_scheduler.CurrentTick();
+    SubmitInfo draw_info{};
+    draw_scheduler.Flush(draw_info);
+
+    // Upscale on the compute queue, gated on the guest rendering through the draw timeline.
+    const auto compute_cmdbuf = compute_scheduler.CommandBuffer();
+    const auto acquire_on_compute = vk::ImageMemoryBarrier2{
+        .srcStageMask = vk::PipelineStageFlagBits2::eAllCommands,
+        .srcAccessMask = vk::AccessFlagBits2::eNone,
+        .dstStageMask = vk::PipelineStageFlagBits2::eComputeShader,
+        .dstAccessMask = vk::AccessFlagBits2::eShaderRead,
+        .oldLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .newLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .srcQueueFamilyIndex = instance.GetGraphicsQueueFamilyIndex(),
+        .dstQueueFamilyIndex = instance.GetComputeQueueFamilyIndex(),
+        .image = image.GetImage(),
+        .subresourceRange{frame_subresources},
+    };
+    compute_cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+        .imageMemoryBarrierCount = 1,
+        .pImageMemoryBarriers = &acquire_on_compute,
+    });
+    image_view = fsr_pass.Render(compute_cmdbuf, image_view, image_size,
+                                 {frame->width, frame->height}, fsr_settings, frame->is_hdr);
+    const auto release_to_graphics = vk::ImageMemoryBarrier2{
+        .srcStageMask = vk::PipelineStageFlagBits2::eComputeShader,
+        .srcAccessMask = vk::AccessFlagBits2::eNone,
+        .dstStageMask = vk::PipelineStageFlagBits2::eAllCommands,
+        .dstAccessMask = vk::AccessFlagBits2::eNone,
+        .oldLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .newLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .srcQueueFamilyIndex = instance.GetComputeQueueFamilyIndex(),
+        .dstQueueFamilyIndex = instance.GetGraphicsQueueFamilyIndex(),
+        .image = image.GetImage(),
+        .subresourceRange{frame_subresources},
+    };
+    compute_cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+        .imageMemoryBarrierCount = 1,
+        .pImageMemoryBarriers = &release_to_graphics,
+    });
+    const u64 compute_tick = compute_scheduler.CurrentTick();
+    SubmitInfo compute_info{};
+    compute_info.AddWait(draw_scheduler.GetMasterSemaphore()->Handle(), draw_tick);
+    compute_scheduler.Flush(compute_info);
+
+    // Composite on the flip scheduler; the draw stream is already free to record the next frame.
+    flip_scheduler.EndRendering();
+    const auto flip_cmdbuf = flip_scheduler.CommandBuffer();
+    const auto acquire_on_graphics = vk::ImageMemoryBarrier2{
+        .srcStageMask = vk::PipelineStageFlagBits2::eAllCommands,
+        .srcAccessMask = vk::AccessFlagBits2::eNone,
+        .dstStageMask = vk::PipelineStageFlagBits2::eAllCommands,
+        .dstAccessMask = vk::AccessFlagBits2::eMemoryRead | vk::AccessFlagBits2::eMemoryWrite,
+        .oldLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .newLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+        .srcQueueFamilyIndex = instance.GetComputeQueueFamilyIndex(),
+        .dstQueueFamilyIndex = instance.GetGraphicsQueueFamilyIndex(),
+        .image = image.GetImage(),
+        .subresourceRange{frame_subresources},
+    };
+    const std::array flip_barriers{pre_barrier, acquire_on_graphics};
+    flip_cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+        .imageMemoryBarrierCount = flip_barriers.size(),
+        .pImageMemoryBarriers = flip_barriers.data(),
+    });
+    pp_pass.Render(flip_cmdbuf, image_view, image_size, *frame, pp_settings);
+
     // Flush frame creation commands.
-    frame->ready_semaphore = draw_scheduler.GetMasterSemaphore()->Handle();
-    frame->ready_tick = draw_scheduler.CurrentTick();
-    SubmitInfo info{};
-    draw_scheduler.Flush(info);
+    frame->ready_semaphore = flip_scheduler.GetMasterSemaphore()->Handle();
+    frame->ready_tick = flip_scheduler.CurrentTick();
+    SubmitInfo flip_info{};
+    flip_info.AddWait(compute_scheduler.GetMasterSemaphore()->Handle(), compute_tick);
+    flip_scheduler.Flush(flip_info);
     return frame;
 }
 
 Frame* Presenter::PrepareBlankFrame(bool present_thread) {
     // Request a free presentation frame.
     Frame* frame = GetRenderFrame();
+    frame->direct_texture = {};
 
     auto& scheduler = present_thread ? present_scheduler : draw_scheduler;
     scheduler.EndRendering();
@@ -440,6 +597,11 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
         swapchain.Recreate(window.GetWidth(), window.GetHeight());
     }
 
+    // Pick up a present mode change from a live config reload.
+    if (present_mode_dirty.exchange(false, std::memory_order_relaxed)) {
+        swapchain.RefreshPresentMode();
+    }
+
     if (!swapchain.AcquireNextImage()) {
         swapchain.Recreate(window.GetWidth(), window.GetHeight());
         if (!swapchain.AcquireNextImage()) {
@@ -464,6 +626,7 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
 
     auto& scheduler = present_scheduler;
     const auto cmdbuf = scheduler.CommandBuffer();
+    s32 capture_slot = -1;
 
     if (Config::getVkHostMarkersEnabled()) {
         cmdbuf.beginDebugUtilsLabelEXT(vk::DebugUtilsLabelEXT{
@@ -529,9 +692,13 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
             },
         };
 
+        // Direct frames never rendered into the frame image, so it keeps its old layout.
+        const u32 num_pre_barriers = frame->direct_texture ? 1u : 2u;
         cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput,
                                vk::PipelineStageFlagBits::eColorAttachmentOutput,
-                               vk::DependencyFlagBits::eByRegion, {}, {}, pre_barriers);
+                               vk::DependencyFlagBits::eByRegion, {}, {},
+                               vk::ArrayProxy<const vk::ImageMemoryBarrier>{
+                                   num_pre_barriers, pre_barriers.data()});
 
         { // Draw the game
             ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2{0.0f});
@@ -540,7 +707,8 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
             ImGui::PushStyleColor(ImGuiCol_WindowBg, ImVec4(0.0f, 0.0f, 0.0f, 1.0f));
             ImGui::SetNextWindowDockID(dockId, ImGuiCond_Once);
             if (ImGui::Begin("Display##game_display", nullptr, ImGuiWindowFlags_NoNav)) {
-                auto game_texture = frame->imgui_texture;
+                auto game_texture =
+                    frame->direct_texture ? frame->direct_texture : frame->imgui_texture;
                 auto game_width = frame->width;
                 auto game_height = frame->height;
 
@@ -587,6 +755,13 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
         }
         ImGui::Core::Render(cmdbuf, swapchain_image_view, swapchain.GetExtent());
 
+        // Queue a copy of the finished frame into a host-visible capture slot
+        // before the image transitions to the present layout.
+        if (frame_capture.IsEnabled()) {
+            capture_slot = frame_capture.Record(cmdbuf, swapchain_image, extent,
+                                                swapchain.GetSurfaceFormat().format);
+        }
+
         cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eAllCommands,
                                vk::PipelineStageFlagBits::eAllCommands,
                                vk::DependencyFlagBits::eByRegion, {}, {}, post_barrier);
@@ -606,8 +781,19 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
     info.AddWait(frame->ready_semaphore, frame->ready_tick);
     info.AddSignal(swapchain.GetPresentReadySemaphore());
     info.AddSignal(frame->present_done);
+    const u64 capture_tick = scheduler.CurrentTick();
     scheduler.Flush(info);
 
+    if (capture_slot >= 0) {
+        frame_capture.Submit(capture_slot, scheduler.GetMasterSemaphore(), capture_tick);
+    }
+
+    // Hold back the present until the predicted flip slot to keep a stable cadence.
+    // Reused frames are window redraws outside the guest flip stream, leave them alone.
+    if (!is_reusing_frame) {
+        frame_pacer.WaitPresentSlot();
+    }
+
     // Present to swapchain.
     std::scoped_lock submit_lock{Scheduler::submit_mutex};
     if (!swapchain.Present()) {
@@ -617,6 +803,7 @@ void Presenter::Present(Frame* frame, bool is_reusing_frame) {
     free_frame();
     if (!is_reusing_frame) {
         DebugState.IncFlipFrameNum();
+        texture_cache.CollectFrameStats();
     }
 }
 
@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <unordered_map>
 
 #include "core/libraries/videoout/buffer.h"
 #include "imgui/imgui_texture.h"
 #include "video_core/renderer_vulkan/host_passes/fsr_pass.h"
 #include "video_core/renderer_vulkan/host_passes/pp_pass.h"
+#include "video_core/renderer_vulkan/vk_frame_capture.h"
+#include "video_core/renderer_vulkan/vk_frame_pacer.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_swapchain.h"
@@ -37,6 +41,8 @@ struct Frame {
     u8 id{};
 
     ImTextureID imgui_texture;
+    // Guest image sampled by the present draw directly; skips the frame copy when set.
+    ImTextureID direct_texture{};
 };
 
 enum SchedulerType {
@@ -68,10 +74,26 @@ public:
         return *rasterizer.get();
     }
 
+    const Instance& GetInstance() const {
+        return instance;
+    }
+
+    FramePacer& GetFramePacer() {
+        return frame_pacer;
+    }
+
     bool IsHDRSupported() const {
         return swapchain.HasHDR();
     }
 
+    bool IsFrameCaptureEnabled() const {
+        return frame_capture.IsEnabled();
+    }
+
+    void SetFrameCapture(bool enable) {
+        frame_capture.SetEnabled(enable);
+    }
+
     void SetHDR(bool enable) {
         if (!IsHDRSupported()) {
             return;
@@ -105,6 +127,8 @@ private:
 
     void RecreateFrame(Frame* frame, u32 width, u32 height);
 
+    ImTextureID GetDirectTexture(VAddr cpu_address, vk::ImageView image_view);
+
     void SetExpectedGameSize(s32 width, s32 height);
 
 private:
@@ -122,7 +146,9 @@ private:
     Scheduler draw_scheduler;
     Scheduler present_scheduler;
     Scheduler flip_scheduler;
+    Scheduler compute_scheduler;
     Swapchain swapchain;
+    FrameCapture frame_capture;
     std::unique_ptr<Rasterizer> rasterizer;
     VideoCore::TextureCache& texture_cache;
     vk::UniqueCommandPool command_pool;
@@ -134,6 +160,14 @@ private:
     std::condition_variable_any frame_cv;
     std::optional<ImGui::RefCountedTexture> splash_img;
     std::vector<VAddr> vo_buffers_addr;
+    struct DirectPresentTexture {
+        vk::ImageView view{};
+        ImTextureID texture{};
+    };
+    std::unordered_map<VAddr, DirectPresentTexture> direct_present_textures;
+    FramePacer frame_pacer;
+    u64 present_mode_watch{};
+    std::atomic_bool present_mode_dirty{};
 };
 
 } // namespace Vulkan
@@ -3,6 +3,8 @@
 
 #include "common/config.h"
 #include "common/debug.h"
+#include "common/hash.h"
+#include "core/debug_state.h"
 #include "core/memory.h"
 #include "shader_recompiler/runtime_info.h"
 #include "video_core/amdgpu/liverpool.h"
@@ -125,7 +127,16 @@ void Rasterizer::PrepareRenderState(const GraphicsPipeline* pipeline) {
             continue;
         }
         const auto& hint = liverpool->last_cb_extent[cb];
-        std::construct_at(&desc, col_buf, hint);
+        u64 reg_hash = XXH3_64bits(&col_buf, sizeof(col_buf));
+        reg_hash = HashCombine(reg_hash, XXH3_64bits(&hint, sizeof(hint)));
+        auto& cached = cb_desc_cache[cb];
+        if (cached.reg_hash != reg_hash) {
+            std::construct_at(&cached.desc, col_buf, hint);
+            cached.reg_hash = reg_hash;
+        }
+        // FindImage may narrow the view to a subresource of the matched image, so hand it a
+        // copy and keep the cached description pristine.
+        desc = cached.desc;
         image_id = bound_images.emplace_back(texture_cache.FindImage(desc));
         auto& image = texture_cache.GetImage(image_id);
         image.binding.is_target = 1u;
@@ -136,8 +147,18 @@ void Rasterizer::PrepareRenderState(const GraphicsPipeline* pipeline) {
         const auto htile_address = regs.depth_htile_data_base.GetAddress();
         const auto& hint = liverpool->last_db_extent;
         auto& [image_id, desc] = db_desc;
-        std::construct_at(&desc, regs.depth_buffer, regs.depth_view, regs.depth_control,
-                          htile_address, hint);
+        u64 reg_hash = XXH3_64bits(&regs.depth_buffer, sizeof(regs.depth_buffer));
+        reg_hash = HashCombine(reg_hash, XXH3_64bits(&regs.depth_view, sizeof(regs.depth_view)));
+        reg_hash =
+            HashCombine(reg_hash, XXH3_64bits(&regs.depth_control, sizeof(regs.depth_control)));
+        reg_hash = HashCombine(reg_hash, htile_address);
+        reg_hash = HashCombine(reg_hash, XXH3_64bits(&hint, sizeof(hint)));
+        if (db_desc_cache.reg_hash != reg_hash) {
+            std::construct_at(&db_desc_cache.desc, regs.depth_buffer, regs.depth_view,
+                              regs.depth_control, htile_address, hint);
+            db_desc_cache.reg_hash = reg_hash;
+        }
+        desc = db_desc_cache.desc;
         image_id = bound_images.emplace_back(texture_cache.FindImage(desc));
         auto& image = texture_cache.GetImage(image_id);
         image.binding.is_target = 1u;
@@ -313,9 +334,16 @@ void Rasterizer::DispatchDirect() {
     }
 
     const auto& cs = pipeline->GetStage(Shader::LogicalStage::Compute);
+    const bool collect_stats = DebugState.IsGpuZoneProfilingEnabled();
     if (ExecuteShaderHLE(cs, liverpool->regs, cs_program, *this)) {
+        if (collect_stats) {
+            DebugState.RecordComputeDispatch(cs.pgm_hash, true);
+        }
         return;
     }
+    if (collect_stats) {
+        DebugState.RecordComputeDispatch(cs.pgm_hash, false);
+    }
 
     if (!BindResources(pipeline)) {
         return;
@@ -325,8 +353,12 @@ void Rasterizer::DispatchDirect() {
     pipeline->BindResources(set_writes, buffer_barriers, push_data);
 
     const auto cmdbuf = scheduler.CommandBuffer();
+    const bool gpu_zone = scheduler.BeginGpuZone("Compute dispatch", cs.pgm_hash);
     cmdbuf.bindPipeline(vk::PipelineBindPoint::eCompute, pipeline->Handle());
     cmdbuf.dispatch(cs_program.dim_x, cs_program.dim_y, cs_program.dim_z);
+    if (gpu_zone) {
+        scheduler.EndGpuZone();
+    }
 
     ResetBindings();
 }
@@ -345,6 +377,11 @@ void Rasterizer::DispatchIndirect(VAddr address, u32 offset, u32 size) {
     const auto [buffer, base] = buffer_cache.ObtainBuffer(address + offset, size, true);
     buffer_cache.GetPendingGpuModifiedRanges().Subtract(address + offset, size);
 
+    const auto& cs = pipeline->GetStage(Shader::LogicalStage::Compute);
+    if (DebugState.IsGpuZoneProfilingEnabled()) {
+        DebugState.RecordComputeDispatch(cs.pgm_hash, false);
+    }
+
     if (!BindResources(pipeline)) {
         return;
     }
@@ -352,8 +389,12 @@ void Rasterizer::DispatchIndirect(VAddr address, u32 offset, u32 size) {
     pipeline->BindResources(set_writes, buffer_barriers, push_data);
 
     const auto cmdbuf = scheduler.CommandBuffer();
+    const bool gpu_zone = scheduler.BeginGpuZone("Compute dispatch", cs.pgm_hash);
     cmdbuf.bindPipeline(vk::PipelineBindPoint::eCompute, pipeline->Handle());
     cmdbuf.dispatchIndirect(buffer->Handle(), base);
+    if (gpu_zone) {
+        scheduler.EndGpuZone();
+    }
 
     ResetBindings();
 }
@@ -378,12 +419,22 @@ void Rasterizer::OnSubmit() {
     texture_cache.RunGarbageCollector();
     buffer_cache.ProcessPreemptiveDownloads();
     buffer_cache.RunGarbageCollector();
+    pipeline_cache.RunGarbageCollector();
 }
 
 void Rasterizer::CommitPendingGpuRanges() {
     buffer_cache.CommitPendingGpuRanges();
 }
 
+void Rasterizer::PrefetchBuffers(std::span<const std::pair<VAddr, u32>> ranges) {
+    for (const auto& [addr, size] : ranges) {
+        if (!IsMapped(addr, size)) {
+            continue;
+        }
+        buffer_cache.FindBuffer(addr, size);
+    }
+}
+
 bool Rasterizer::BindResources(const Pipeline* pipeline) {
     if (IsComputeImageCopy(pipeline) || IsComputeMetaClear(pipeline) ||
         IsComputeImageClear(pipeline)) {
@@ -392,6 +443,7 @@ bool Rasterizer::BindResources(const Pipeline* pipeline) {
 
     set_writes.clear();
     buffer_barriers.clear();
+    image_barriers.clear();
     buffer_infos.clear();
     image_infos.clear();
 
@@ -419,9 +471,32 @@ bool Rasterizer::BindResources(const Pipeline* pipeline) {
         fault_process_pending = true;
     }
 
+    FlushBarriers();
+
     return true;
 }
 
+void Rasterizer::FlushBarriers() {
+    if (buffer_barriers.empty() && image_barriers.empty()) {
+        return;
+    }
+    // All transitions collected while walking stage resources are issued in a single
+    // dependency instead of one vkCmdPipelineBarrier2 per binding. No-op transitions were
+    // already elided by the state tracking, so back-to-back draws rebinding the same
+    // resources contribute nothing here.
+    scheduler.EndRendering();
+    const auto cmdbuf = scheduler.CommandBuffer();
+    cmdbuf.pipelineBarrier2(vk::DependencyInfo{
+        .dependencyFlags = vk::DependencyFlagBits::eByRegion,
+        .bufferMemoryBarrierCount = static_cast<u32>(buffer_barriers.size()),
+        .pBufferMemoryBarriers = buffer_barriers.data(),
+        .imageMemoryBarrierCount = static_cast<u32>(image_barriers.size()),
+        .pImageMemoryBarriers = image_barriers.data(),
+    });
+    buffer_barriers.clear();
+    image_barriers.clear();
+}
+
 bool Rasterizer::IsComputeMetaClear(const Pipeline* pipeline) {
     if (!pipeline->IsCompute()) {
         return false;
@@ -723,29 +798,39 @@ void Rasterizer::BindTextures(const Shader::Info& stage, Shader::Backend::Bindin
             // The image is either bound as storage in a separate descriptor or bound as render
             // target in feedback loop. Depth images are excluded because they can't be bound as
             // storage and feedback loop doesn't make sense for them
+            // Collect transitions instead of emitting them per binding; they are flushed
+            // in one batch at the end of BindResources.
+            constexpr auto dst_stage =
+                vk::PipelineStageFlagBits2::eAllGraphics | vk::PipelineStageFlagBits2::eComputeShader;
             if ((image.binding.force_general || image.binding.is_target) &&
                 !image.info.props.is_depth) {
-                image.Transit(instance.IsAttachmentFeedbackLoopLayoutSupported() &&
-                                      image.binding.is_target
-                                  ? vk::ImageLayout::eAttachmentFeedbackLoopOptimalEXT
-                                  : vk::ImageLayout::eGeneral,
-                              vk::AccessFlagBits2::eShaderRead |
-                                  (image.info.props.is_depth
-                                       ? vk::AccessFlagBits2::eDepthStencilAttachmentWrite
-                                       : vk::AccessFlagBits2::eColorAttachmentWrite),
-                              {});
+                const auto barriers =
+                    image.GetBarriers(instance.IsAttachmentFeedbackLoopLayoutSupported() &&
+                                              image.binding.is_target
+                                          ? vk::ImageLayout::eAttachmentFeedbackLoopOptimalEXT
+                                          : vk::ImageLayout::eGeneral,
+                                      vk::AccessFlagBits2::eShaderRead |
+                                          (image.info.props.is_depth
+                                               ? vk::AccessFlagBits2::eDepthStencilAttachmentWrite
+                                               : vk::AccessFlagBits2::eColorAttachmentWrite),
+                                      dst_stage, {});
+                image_barriers.insert(image_barriers.end(), barriers.begin(), barriers.end());
             } else {
                 if (is_storage) {
-                    image.Transit(vk::ImageLayout::eGeneral,
-                                  vk::AccessFlagBits2::eShaderRead |
-                                      vk::AccessFlagBits2::eShaderWrite,
-                                  desc.view_info.range);
+                    const auto barriers =
+                        image.GetBarriers(vk::ImageLayout::eGeneral,
+                                          vk::AccessFlagBits2::eShaderRead |
+                                              vk::AccessFlagBits2::eShaderWrite,
+                                          dst_stage, desc.view_info.range);
+                    image_barriers.insert(image_barriers.end(), barriers.begin(), barriers.end());
                 } else {
                     const auto new_layout = image.info.props.is_depth
                                                 ? vk::ImageLayout::eDepthStencilReadOnlyOptimal
                                                 : vk::ImageLayout::eShaderReadOnlyOptimal;
-                    image.Transit(new_layout, vk::AccessFlagBits2::eShaderRead,
-                                  desc.view_info.range);
+                    const auto barriers = image.GetBarriers(
+                        new_layout, vk::AccessFlagBits2::eShaderRead, dst_stage,
+                        desc.view_info.range);
+                    image_barriers.insert(image_barriers.end(), barriers.begin(), barriers.end());
                 }
             }
             image.usage.storage |= is_storage;
@@ -834,6 +919,7 @@ RenderState Rasterizer::BeginRendering(const GraphicsPipeline* pipeline) {
         state.width = std::min<u32>(state.width, std::max(image->info.size.width >> mip, 1u));
         state.height = std::min<u32>(state.height, std::max(image->info.size.height >> mip, 1u));
         state.num_layers = std::min<u32>(state.num_layers, image_view.info.range.extent.layers);
+        state.color_formats[cb] = image_view.info.format;
         state.color_attachments[cb] = {
             .imageView = *image_view.image_view,
             .imageLayout = image->backing->state.layout,
@@ -869,12 +955,19 @@ RenderState Rasterizer::BeginRendering(const GraphicsPipeline* pipeline) {
                           vk::AccessFlagBits2::eDepthStencilAttachmentRead,
                       desc.view_info.range);
 
+        if (desc.view_info.is_storage || regs.depth_control.stencil_enable) {
+            // The pass may write this depth buffer; invalidate any recorded copies of it.
+            ++image.depth_content_serial;
+            image.depth_copy_src = {};
+        }
+
         state.width = std::min<u32>(state.width, image.info.size.width);
         state.height = std::min<u32>(state.height, image.info.size.height);
         state.has_depth = regs.depth_buffer.DepthValid();
         state.has_stencil = regs.depth_buffer.StencilValid();
         state.num_layers = std::min<u32>(state.num_layers, image_view.info.range.extent.layers);
         if (state.has_depth) {
+            state.depth_format = image_view.info.format;
             state.depth_attachment = {
                 .imageView = *image_view.image_view,
                 .imageLayout = image.backing->state.layout,
@@ -885,6 +978,7 @@ RenderState Rasterizer::BeginRendering(const GraphicsPipeline* pipeline) {
             };
         }
         if (state.has_stencil) {
+            state.stencil_format = image_view.info.format;
             state.stencil_attachment = {
                 .imageView = *image_view.image_view,
                 .imageLayout = image.backing->state.layout,
@@ -930,9 +1024,28 @@ void Rasterizer::DepthStencilCopy(bool is_depth, bool is_stencil) {
         regs.depth_buffer, regs.depth_view, regs.depth_control,
         regs.depth_htile_data_base.GetAddress(), liverpool->last_db_extent, true);
 
-    auto& read_image = texture_cache.GetImage(texture_cache.FindImage(read_desc));
+    const auto read_id = texture_cache.FindImage(read_desc);
+    auto& read_image = texture_cache.GetImage(read_id);
     auto& write_image = texture_cache.GetImage(texture_cache.FindImage(write_desc));
 
+    auto aspect_mask = vk::ImageAspectFlags(0);
+    if (is_depth) {
+        aspect_mask |= vk::ImageAspectFlagBits::eDepth;
+    }
+    if (is_stencil) {
+        aspect_mask |= vk::ImageAspectFlagBits::eStencil;
+    }
+
+    // Skip the copy when the destination already holds this exact content; games re-issue
+    // the decompress copy every pass even when the source depth was not written in between.
+    if (write_image.depth_copy_src == read_id &&
+        write_image.depth_copy_src_addr == read_image.info.guest_address &&
+        write_image.depth_copy_src_serial == read_image.depth_content_serial &&
+        (aspect_mask & ~write_image.depth_copy_aspects) == vk::ImageAspectFlags(0)) {
+        ScopedMarkerInsert("DepthStencilCopy:elided");
+        return;
+    }
+
     VideoCore::SubresourceRange sub_range;
     sub_range.base.layer = liverpool->regs.depth_view.slice_start;
     sub_range.extent.layers = liverpool->regs.depth_view.NumSlices() - sub_range.base.layer;
@@ -978,6 +1091,18 @@ void Rasterizer::DepthStencilCopy(bool is_depth, bool is_stencil) {
                                         write_image.GetImage(),
                                         vk::ImageLayout::eTransferDstOptimal, region);
 
+    ++write_image.depth_content_serial;
+    if (write_image.depth_copy_src == read_id &&
+        write_image.depth_copy_src_serial == read_image.depth_content_serial) {
+        // Same source and content as the recorded copy, only more aspects.
+        write_image.depth_copy_aspects |= aspect_mask;
+    } else {
+        write_image.depth_copy_src = read_id;
+        write_image.depth_copy_src_addr = read_image.info.guest_address;
+        write_image.depth_copy_src_serial = read_image.depth_content_serial;
+        write_image.depth_copy_aspects = aspect_mask;
+    }
+
     ScopeMarkerEnd();
 }
 
@@ -1048,12 +1173,21 @@ void Rasterizer::UnmapMemory(VAddr addr, u64 size) {
     }
 }
 
-void Rasterizer::UpdateDynamicState(const GraphicsPipeline* pipeline, const bool is_indexed) const {
-    UpdateViewportScissorState();
-    UpdateDepthStencilState();
-    UpdatePrimitiveState(is_indexed);
-    UpdateRasterizationState();
-    UpdateColorBlendingState(pipeline);
+void Rasterizer::UpdateDynamicState(const GraphicsPipeline* pipeline, const bool is_indexed) {
+    // All inputs below are draw-state registers plus the pipeline, so when the pipeline
+    // was reused without a register write in between the recomputed values would be
+    // byte-identical. Skip straight to committing whatever the scheduler invalidated
+    // since the previous draw (renderpass restarts, submits).
+    const bool skip_recompute =
+        pipeline_cache.IsLastPipelineReused() && is_indexed == last_dynamic_is_indexed;
+    last_dynamic_is_indexed = is_indexed;
+    if (!skip_recompute) {
+        UpdateViewportScissorState();
+        UpdateDepthStencilState();
+        UpdatePrimitiveState(is_indexed);
+        UpdateRasterizationState();
+        UpdateColorBlendingState(pipeline);
+    }
 
     auto& dynamic_state = scheduler.GetDynamicState();
     dynamic_state.Commit(instance, scheduler.CommandBuffer());
@@ -69,6 +69,7 @@ public:
     void Finish();
     void OnSubmit();
     void CommitPendingGpuRanges();
+    void PrefetchBuffers(std::span<const std::pair<VAddr, u32>> ranges);
 
     PipelineCache& GetPipelineCache() {
         return pipeline_cache;
@@ -90,7 +91,7 @@ private:
     void DepthStencilCopy(bool is_depth, bool is_stencil);
     void EliminateFastClear();
 
-    void UpdateDynamicState(const GraphicsPipeline* pipeline, bool is_indexed) const;
+    void UpdateDynamicState(const GraphicsPipeline* pipeline, bool is_indexed);
     void UpdateViewportScissorState() const;
     void UpdateDepthStencilState() const;
     void UpdatePrimitiveState(bool is_indexed) const;
@@ -103,6 +104,7 @@ private:
                      Shader::PushData& push_data);
     void BindTextures(const Shader::Info& stage, Shader::Backend::Bindings& binding);
     bool BindResources(const Pipeline* pipeline);
+    void FlushBarriers();
 
     void ResetBindings() {
         for (auto& image_id : bound_images) {
@@ -132,12 +134,23 @@ private:
     using RenderTargetInfo = std::pair<VideoCore::ImageId, VideoCore::TextureCache::ImageDesc>;
     std::array<RenderTargetInfo, AmdGpu::NUM_COLOR_BUFFERS> cb_descs;
     std::pair<VideoCore::ImageId, VideoCore::TextureCache::ImageDesc> db_desc;
+
+    // Attachment descriptions derived from the raw CB/DB register block contents. Passes that
+    // bind the same targets every frame reuse the previous derivation instead of decoding
+    // tiling and view information from the registers again.
+    struct TargetDescCache {
+        u64 reg_hash{};
+        VideoCore::TextureCache::ImageDesc desc;
+    };
+    std::array<TargetDescCache, AmdGpu::NUM_COLOR_BUFFERS> cb_desc_cache;
+    TargetDescCache db_desc_cache;
     boost::container::static_vector<vk::DescriptorImageInfo, Shader::NUM_IMAGES> image_infos;
     boost::container::static_vector<vk::DescriptorBufferInfo, Shader::NUM_BUFFERS> buffer_infos;
     boost::container::static_vector<VideoCore::ImageId, Shader::NUM_IMAGES> bound_images;
 
     Pipeline::DescriptorWrites set_writes;
     Pipeline::BufferBarriers buffer_barriers;
+    VideoCore::Image::Barriers image_barriers;
     Shader::PushData push_data;
 
     using BufferBindingInfo = std::tuple<VideoCore::BufferId, AmdGpu::Buffer, u64>;
@@ -146,6 +159,7 @@ private:
     boost::container::static_vector<ImageBindingInfo, Shader::NUM_IMAGES> image_bindings;
     bool fault_process_pending{};
     bool attachment_feedback_loop{};
+    bool last_dynamic_is_indexed{};
 };
 
 } // namespace Vulkan
@@ -60,12 +60,13 @@ std::size_t ResourcePool::ManageOverflow() {
 
 constexpr std::size_t COMMAND_BUFFER_POOL_SIZE = 4;
 
-CommandPool::CommandPool(const Instance& instance, MasterSemaphore* master_semaphore)
-    : ResourcePool{master_semaphore, COMMAND_BUFFER_POOL_SIZE}, instance{instance} {
+CommandPool::CommandPool(const Instance& instance, MasterSemaphore* master_semaphore,
+                         vk::CommandBufferLevel level, std::optional<u32> queue_family)
+    : ResourcePool{master_semaphore, COMMAND_BUFFER_POOL_SIZE}, instance{instance}, level{level} {
     const vk::CommandPoolCreateInfo pool_create_info = {
         .flags = vk::CommandPoolCreateFlagBits::eTransient |
                  vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
-        .queueFamilyIndex = instance.GetGraphicsQueueFamilyIndex(),
+        .queueFamilyIndex = queue_family.value_or(instance.GetGraphicsQueueFamilyIndex()),
     };
     const vk::Device device = instance.GetDevice();
     auto [pool_result, pool] = device.createCommandPoolUnique(pool_create_info);
@@ -82,7 +83,7 @@ void CommandPool::Allocate(std::size_t begin, std::size_t end) {
 
     const vk::CommandBufferAllocateInfo buffer_alloc_info = {
         .commandPool = *cmd_pool,
-        .level = vk::CommandBufferLevel::ePrimary,
+        .level = level,
         .commandBufferCount = COMMAND_BUFFER_POOL_SIZE,
     };
 
@@ -169,14 +170,29 @@ vk::DescriptorSet DescriptorHeap::Commit(vk::DescriptorSetLayout set_layout) {
     ASSERT_MSG(result == vk::Result::eSuccess,
                "Unexpected error during descriptor set allocation {}", vk::to_string(result));
 
-    // We've changed pool so also reset descriptor batch cache.
+    // We've changed pool so also reset descriptor batch and fingerprint caches.
     descriptor_sets.clear();
+    cached_sets.clear();
     const auto desc_set = desc_sets.back();
     desc_sets.pop_back();
     descriptor_sets[set_key] = std::move(desc_sets);
     return desc_set;
 }
 
+vk::DescriptorSet DescriptorHeap::CommitCached(vk::DescriptorSetLayout set_layout, u64 fingerprint,
+                                               bool& is_new) {
+    if (const auto it = cached_sets.find(fingerprint); it != cached_sets.end()) {
+        is_new = false;
+        return it->second;
+    }
+
+    // Commit may exchange the backing pool and flush the cache, so insert afterwards.
+    const auto desc_set = Commit(set_layout);
+    cached_sets.emplace(fingerprint, desc_set);
+    is_new = true;
+    return desc_set;
+}
+
 void DescriptorHeap::CreateDescriptorPool() {
     const vk::DescriptorPoolCreateInfo pool_info = {
         .flags = vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind,
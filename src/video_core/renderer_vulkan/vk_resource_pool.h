@@ -4,6 +4,7 @@
 #pragma once
 
 #include <deque>
+#include <optional>
 #include <vector>
 #include <boost/container/static_vector.hpp>
 #include <tsl/robin_map.h>
@@ -51,7 +52,9 @@ protected:
 
 class CommandPool final : public ResourcePool {
 public:
-    explicit CommandPool(const Instance& instance, MasterSemaphore* master_semaphore);
+    explicit CommandPool(const Instance& instance, MasterSemaphore* master_semaphore,
+                         vk::CommandBufferLevel level = vk::CommandBufferLevel::ePrimary,
+                         std::optional<u32> queue_family = std::nullopt);
     ~CommandPool() override;
 
     void Allocate(std::size_t begin, std::size_t end) override;
@@ -60,6 +63,7 @@ public:
 
 private:
     const Instance& instance;
+    vk::CommandBufferLevel level;
     vk::UniqueCommandPool cmd_pool;
     std::vector<vk::CommandBuffer> cmd_buffers;
 };
@@ -75,6 +79,12 @@ public:
 
     vk::DescriptorSet Commit(vk::DescriptorSetLayout set_layout);
 
+    /// Returns the descriptor set cached for the given write fingerprint, committing a fresh
+    /// one when the fingerprint is new. is_new tells the caller whether the set still has to
+    /// be written. Cached sets are dropped whenever the backing pool is exchanged.
+    vk::DescriptorSet CommitCached(vk::DescriptorSetLayout set_layout, u64 fingerprint,
+                                   bool& is_new);
+
 private:
     void CreateDescriptorPool();
 
@@ -87,6 +97,7 @@ private:
     std::deque<std::pair<vk::DescriptorPool, u64>> pending_pools;
     using DescSetBatch = boost::container::static_vector<vk::DescriptorSet, DescriptorSetBatch>;
     tsl::robin_map<u64, DescSetBatch> descriptor_sets;
+    tsl::robin_map<u64, vk::DescriptorSet> cached_sets;
 };
 
 } // namespace Vulkan
@@ -1,9 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <boost/container/small_vector.hpp>
+
 #include "common/assert.h"
 #include "common/debug.h"
 #include "common/thread.h"
+#include "core/debug_state.h"
 #include "imgui/renderer/texture_manager.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -12,11 +15,30 @@ namespace Vulkan {
 
 std::mutex Scheduler::submit_mutex;
 
-Scheduler::Scheduler(const Instance& instance)
-    : instance{instance}, master_semaphore{instance}, command_pool{instance, &master_semaphore} {
+Scheduler::Scheduler(const Instance& instance, QueueType queue_type)
+    : instance{instance}, queue_type{queue_type},
+      queue{queue_type == QueueType::AsyncCompute ? instance.GetComputeQueue()
+                                                  : instance.GetGraphicsQueue()},
+      master_semaphore{instance},
+      command_pool{instance, &master_semaphore, vk::CommandBufferLevel::ePrimary,
+                   queue_type == QueueType::AsyncCompute ? instance.GetComputeQueueFamilyIndex()
+                                                         : instance.GetGraphicsQueueFamilyIndex()} {
 #if TRACY_GPU_ENABLED
     profiler_scope = reinterpret_cast<tracy::VkCtxScope*>(std::malloc(sizeof(tracy::VkCtxScope)));
 #endif
+    // The zone profiler recycles its queries with host resets after readback.
+    if (instance.IsHostQueryResetSupported()) {
+        const vk::QueryPoolCreateInfo query_pool_info = {
+            .queryType = vk::QueryType::eTimestamp,
+            .queryCount = NumGpuZoneQueries,
+        };
+        auto [pool_result, pool] = instance.GetDevice().createQueryPoolUnique(query_pool_info);
+        ASSERT_MSG(pool_result == vk::Result::eSuccess, "Failed to create timestamp query pool: {}",
+                   vk::to_string(pool_result));
+        gpu_zone_pool = std::move(pool);
+        instance.GetDevice().resetQueryPool(*gpu_zone_pool, 0, NumGpuZoneQueries);
+        timestamp_period = instance.GetTimestampPeriod();
+    }
     AllocateWorkerCommandBuffers();
     priority_pending_ops_thread =
         std::jthread(std::bind_front(&Scheduler::PriorityPendingOpsThread, this));
@@ -32,11 +54,25 @@ void Scheduler::BeginRendering(const RenderState& new_state) {
     if (is_rendering && render_state == new_state) {
         return;
     }
+    if (is_rendering && new_state.CanContinue(render_state)) {
+        // The state only lost its clear load ops (they were consumed by the scope already
+        // open on these attachments), so the draw can merge into it without a restart.
+        // Store the merged state, whose load ops are all eLoad, so a later state that does
+        // request a clear cannot compare equal to the stale clearing state and be dropped.
+        render_state = new_state;
+        return;
+    }
     EndRendering();
     is_rendering = true;
     render_state = new_state;
 
-    const vk::RenderingInfo rendering_info = {
+    current_cmdbuf.beginRendering(BuildRenderingInfo({}));
+    render_zone_open = BeginGpuZone("Graphics pass");
+}
+
+vk::RenderingInfo Scheduler::BuildRenderingInfo(vk::RenderingFlags flags) const {
+    return vk::RenderingInfo{
+        .flags = flags,
         .renderArea =
             {
                 .offset = {0, 0},
@@ -50,20 +86,154 @@ void Scheduler::BeginRendering(const RenderState& new_state) {
         .pDepthAttachment = render_state.has_depth ? &render_state.depth_attachment : nullptr,
         .pStencilAttachment = render_state.has_stencil ? &render_state.stencil_attachment : nullptr,
     };
-
-    current_cmdbuf.beginRendering(rendering_info);
 }
 
 void Scheduler::EndRendering() {
     if (!is_rendering) {
         return;
     }
+    ASSERT_MSG(!is_parallel_recording, "Rendering scope ended during parallel recording");
     is_rendering = false;
+    if (render_zone_open) {
+        EndGpuZone();
+        render_zone_open = false;
+    }
     current_cmdbuf.endRendering();
 }
 
+bool Scheduler::BeginGpuZone(const char* name, u64 cs_hash) {
+    if (!gpu_zone_pool || gpu_zone_open || !DebugState.IsGpuZoneProfilingEnabled()) {
+        return false;
+    }
+    if (next_zone_query + 2 > NumGpuZoneQueries) {
+        // Pool exhausted; zones resume once the pending batches have been drained.
+        return false;
+    }
+    const u32 query = next_zone_query;
+    next_zone_query += 2;
+    current_cmdbuf.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, *gpu_zone_pool, query);
+    frame_zones.push_back(
+        {.name = name, .begin_query = query, .end_query = query + 1, .cs_hash = cs_hash});
+    gpu_zone_open = true;
+    return true;
+}
+
+void Scheduler::EndGpuZone() {
+    if (!gpu_zone_open) {
+        return;
+    }
+    current_cmdbuf.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, *gpu_zone_pool,
+                                  frame_zones.back().end_query);
+    gpu_zone_open = false;
+}
+
+void Scheduler::DrainGpuZoneResults() {
+    while (!pending_zone_batches.empty() &&
+           master_semaphore.IsFree(pending_zone_batches.front().tick)) {
+        const auto& batch = pending_zone_batches.front();
+        const u32 first_query = batch.zones.front().begin_query;
+        const u32 num_queries = batch.zones.back().end_query - first_query + 1;
+        std::vector<u64> timestamps(num_queries);
+        const auto result = instance.GetDevice().getQueryPoolResults(
+            *gpu_zone_pool, first_query, num_queries, num_queries * sizeof(u64), timestamps.data(),
+            sizeof(u64), vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait);
+        if (result == vk::Result::eSuccess) {
+            for (const auto& zone : batch.zones) {
+                const u64 gpu_ticks =
+                    timestamps[zone.end_query - first_query] - timestamps[zone.begin_query - first_query];
+                const float ms = gpu_ticks * timestamp_period / 1000000.0f;
+                DebugState.RecordGpuZoneTime(zone.name, ms);
+                if (zone.cs_hash != 0) {
+                    DebugState.RecordComputeZoneTime(zone.cs_hash, ms);
+                }
+            }
+        }
+        instance.GetDevice().resetQueryPool(*gpu_zone_pool, first_query, num_queries);
+        pending_zone_batches.pop_front();
+    }
+    // All queries have been recycled, start over from the beginning of the pool.
+    if (pending_zone_batches.empty() && frame_zones.empty()) {
+        next_zone_query = 0;
+    }
+}
+
+std::span<Scheduler::ParallelRecordSlot> Scheduler::BeginParallelRecording(u32 num_chunks) {
+    ASSERT_MSG(is_rendering && !is_parallel_recording,
+               "Parallel recording requires an active rendering scope");
+    // Restart the render scope so its contents come exclusively from the secondaries.
+    current_cmdbuf.endRendering();
+    current_cmdbuf.beginRendering(
+        BuildRenderingInfo(vk::RenderingFlagBits::eContentsSecondaryCommandBuffers));
+    is_parallel_recording = true;
+
+    // Each worker records through its own pool; command pools require external sync.
+    while (secondary_command_pools.size() < num_chunks) {
+        secondary_command_pools.emplace_back(std::make_unique<CommandPool>(
+            instance, &master_semaphore, vk::CommandBufferLevel::eSecondary));
+    }
+
+    const vk::CommandBufferInheritanceRenderingInfo inheritance_rendering = {
+        .colorAttachmentCount = render_state.num_color_attachments,
+        .pColorAttachmentFormats =
+            render_state.num_color_attachments > 0 ? render_state.color_formats.data() : nullptr,
+        .depthAttachmentFormat =
+            render_state.has_depth ? render_state.depth_format : vk::Format::eUndefined,
+        .stencilAttachmentFormat =
+            render_state.has_stencil ? render_state.stencil_format : vk::Format::eUndefined,
+        .rasterizationSamples = vk::SampleCountFlagBits::e1,
+    };
+    const vk::CommandBufferInheritanceInfo inheritance = {
+        .pNext = &inheritance_rendering,
+    };
+    const vk::CommandBufferBeginInfo begin_info = {
+        .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit |
+                 vk::CommandBufferUsageFlagBits::eRenderPassContinue,
+        .pInheritanceInfo = &inheritance,
+    };
+
+    parallel_slots.resize(num_chunks);
+    for (u32 i = 0; i < num_chunks; ++i) {
+        auto& slot = parallel_slots[i];
+        slot.cmdbuf = secondary_command_pools[i]->Commit();
+        Check(slot.cmdbuf.begin(begin_info));
+        // Secondaries start with no bound state; replicate the tracker values and mark
+        // everything dirty so the first Commit re-emits the full state per worker.
+        slot.dynamic_state = dynamic_state;
+        slot.dynamic_state.Invalidate();
+    }
+    return parallel_slots;
+}
+
+void Scheduler::EndParallelRecording() {
+    ASSERT_MSG(is_parallel_recording, "No parallel recording in progress");
+    boost::container::small_vector<vk::CommandBuffer, 16> cmdbufs;
+    for (auto& slot : parallel_slots) {
+        Check(slot.cmdbuf.end());
+        cmdbufs.emplace_back(slot.cmdbuf);
+    }
+    current_cmdbuf.executeCommands(static_cast<u32>(cmdbufs.size()), cmdbufs.data());
+    parallel_slots.clear();
+    is_parallel_recording = false;
+
+    // Resume inline recording and re-emit dynamic state, which the secondaries clobbered.
+    current_cmdbuf.endRendering();
+    current_cmdbuf.beginRendering(BuildRenderingInfo({}));
+    dynamic_state.Invalidate();
+}
+
 void Scheduler::Flush(SubmitInfo& info) {
     // When flushing, we only send data to the driver; no waiting is necessary.
+    // Guest command streams can raise dozens of back-to-back submit_done packets per
+    // frame and every vkQueueSubmit carries driver overhead, so flushes that merely
+    // advance the tick are coalesced until the latency budget since the last real
+    // submission has run out. Flushes that synchronize (semaphores or a fence attached)
+    // and explicit tick waits always submit.
+    const bool tick_advance_only =
+        info.num_wait_semas == 0 && info.num_signal_semas == 0 && !info.fence;
+    if (tick_advance_only &&
+        std::chrono::steady_clock::now() - last_submit_time < SubmitLatencyBudget) {
+        return;
+    }
     SubmitExecution(info);
 }
 
@@ -82,9 +252,10 @@ void Scheduler::Finish() {
 
 void Scheduler::Wait(u64 tick) {
     if (tick >= master_semaphore.CurrentTick()) {
-        // Make sure we are not waiting for the current tick without signalling
+        // Make sure we are not waiting for the current tick without signalling.
+        // This must bypass the flush coalescing or the wait would deadlock.
         SubmitInfo info{};
-        Flush(info);
+        SubmitExecution(info);
     }
     master_semaphore.Wait(tick);
 }
@@ -95,6 +266,7 @@ void Scheduler::PopPendingOperations() {
         pending_ops.front().callback();
         pending_ops.pop();
     }
+    DrainGpuZoneResults();
 }
 
 void Scheduler::AllocateWorkerCommandBuffers() {
@@ -131,6 +303,24 @@ void Scheduler::SubmitExecution(SubmitInfo& info) {
 #endif
 
     EndRendering();
+
+    // Batch the completed zones against this submission's tick. A zone that is still open
+    // (a flush mid-dispatch) carries over; its end timestamp lands in the next batch.
+    if (!frame_zones.empty()) {
+        GpuZone open_zone{};
+        if (gpu_zone_open) {
+            open_zone = frame_zones.back();
+            frame_zones.pop_back();
+        }
+        if (!frame_zones.empty()) {
+            pending_zone_batches.push_back({.zones = std::move(frame_zones), .tick = signal_value});
+            frame_zones.clear();
+        }
+        if (gpu_zone_open) {
+            frame_zones.push_back(open_zone);
+        }
+    }
+
     Check(current_cmdbuf.end());
 
     const vk::Semaphore timeline = master_semaphore.Handle();
@@ -159,12 +349,15 @@ void Scheduler::SubmitExecution(SubmitInfo& info) {
         .pSignalSemaphores = info.signal_semas.data(),
     };
 
-    ImGui::Core::TextureManager::Submit();
-    auto submit_result = instance.GetGraphicsQueue().submit(submit_info, info.fence);
+    if (queue_type == QueueType::Graphics) {
+        ImGui::Core::TextureManager::Submit();
+    }
+    auto submit_result = queue.submit(submit_info, info.fence);
     ASSERT_MSG(submit_result != vk::Result::eErrorDeviceLost, "Device lost during submit");
 
     master_semaphore.Refresh();
     AllocateWorkerCommandBuffers();
+    last_submit_time = std::chrono::steady_clock::now();
 
     // Apply pending operations
     PopPendingOperations();
@@ -172,6 +365,7 @@ void Scheduler::SubmitExecution(SubmitInfo& info) {
 
 void Scheduler::PriorityPendingOpsThread(std::stop_token stoken) {
     Common::SetCurrentThreadName("shadPS4:GpuSchedPriorityPendingOpsRunner");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
     while (!stoken.stop_requested()) {
         PendingOp op;
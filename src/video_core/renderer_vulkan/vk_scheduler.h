@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <queue>
+#include <vector>
 
 #include "common/unique_function.h"
 #include "video_core/amdgpu/regs_color.h"
@@ -26,6 +31,9 @@ struct RenderState {
     std::array<vk::RenderingAttachmentInfo, 8> color_attachments;
     vk::RenderingAttachmentInfo depth_attachment;
     vk::RenderingAttachmentInfo stencil_attachment;
+    std::array<vk::Format, 8> color_formats;
+    vk::Format depth_format;
+    vk::Format stencil_format;
     u32 num_color_attachments;
     u32 num_layers;
     bool has_depth;
@@ -44,6 +52,37 @@ struct RenderState {
     bool operator==(const RenderState& other) const noexcept {
         return std::memcmp(this, &other, sizeof(RenderState)) == 0;
     }
+
+    /// Returns true if draws with this state can continue a rendering scope begun with
+    /// prev without restarting it. This is the case when only load ops and clear values
+    /// differ and nothing needs clearing anymore: loading inside the open scope is
+    /// equivalent to continuing it.
+    bool CanContinue(const RenderState& prev) const noexcept {
+        const auto attachment_compatible = [](const vk::RenderingAttachmentInfo& attach,
+                                              const vk::RenderingAttachmentInfo& prev_attach) {
+            return attach.imageView == prev_attach.imageView &&
+                   attach.imageLayout == prev_attach.imageLayout &&
+                   attach.storeOp == prev_attach.storeOp &&
+                   attach.loadOp == vk::AttachmentLoadOp::eLoad;
+        };
+        if (num_color_attachments != prev.num_color_attachments ||
+            num_layers != prev.num_layers || has_depth != prev.has_depth ||
+            has_stencil != prev.has_stencil || width != prev.width || height != prev.height) {
+            return false;
+        }
+        for (u32 cb = 0; cb < num_color_attachments; ++cb) {
+            if (!attachment_compatible(color_attachments[cb], prev.color_attachments[cb])) {
+                return false;
+            }
+        }
+        if (has_depth && !attachment_compatible(depth_attachment, prev.depth_attachment)) {
+            return false;
+        }
+        if (has_stencil && !attachment_compatible(stencil_attachment, prev.stencil_attachment)) {
+            return false;
+        }
+        return true;
+    }
 };
 
 struct SubmitInfo {
@@ -341,11 +380,18 @@ struct DynamicState {
 
 class Scheduler {
 public:
-    explicit Scheduler(const Instance& instance);
+    enum class QueueType : u32 {
+        Graphics,
+        AsyncCompute,
+    };
+
+    explicit Scheduler(const Instance& instance, QueueType queue_type = QueueType::Graphics);
     ~Scheduler();
 
     /// Sends the current execution context to the GPU
-    /// and increments the scheduler timeline semaphore.
+    /// and increments the scheduler timeline semaphore. Flushes that only advance the
+    /// tick (no semaphores or fence attached) may be coalesced into a later submission
+    /// within a small latency budget.
     void Flush(SubmitInfo& info);
 
     /// Sends the current execution context to the GPU
@@ -367,6 +413,33 @@ public:
     /// Ends current rendering scope.
     void EndRendering();
 
+    /// Per-worker context for recording render pass contents on another thread.
+    /// Each slot owns a secondary command buffer and a replica of the dynamic state
+    /// tracker, since bound dynamic state does not carry over into secondaries.
+    struct ParallelRecordSlot {
+        vk::CommandBuffer cmdbuf;
+        DynamicState dynamic_state;
+    };
+
+    /// Restarts the current rendering scope so its contents are sourced from secondary
+    /// command buffers and begins one secondary per requested chunk, inheriting the
+    /// attachment formats of the scope. The returned slots stay valid until
+    /// EndParallelRecording. Must be called inside a rendering scope.
+    std::span<ParallelRecordSlot> BeginParallelRecording(u32 num_chunks);
+
+    /// Ends the secondary command buffers, executes them in the primary one and resumes
+    /// inline recording.
+    void EndParallelRecording();
+
+    /// Opens a named GPU timing zone in the current command buffer and returns true on
+    /// success. Zones do not nest and are dropped while GPU profiling is disabled or the
+    /// query pool is exhausted. The name must point to a string with static lifetime.
+    /// A non-zero cs_hash additionally attributes the zone time to that compute program.
+    bool BeginGpuZone(const char* name, u64 cs_hash = 0);
+
+    /// Closes the currently open GPU timing zone.
+    void EndGpuZone();
+
     /// Returns the current render state.
     const RenderState& GetRenderState() const {
         return render_state;
@@ -401,6 +474,11 @@ public:
         return &master_semaphore;
     }
 
+    /// Returns the host queue this scheduler submits to.
+    [[nodiscard]] vk::Queue GetQueue() const noexcept {
+        return queue;
+    }
+
     /// Defers an operation until the gpu has reached the current cpu tick.
     /// Will be run when submitting or calling PopPendingOperations.
     void DeferOperation(Common::UniqueFunction<void>&& func) {
@@ -422,12 +500,19 @@ public:
 private:
     void AllocateWorkerCommandBuffers();
 
+    vk::RenderingInfo BuildRenderingInfo(vk::RenderingFlags flags) const;
+
+    /// Reads back timestamps of zone batches the GPU has finished and reports them.
+    void DrainGpuZoneResults();
+
     void SubmitExecution(SubmitInfo& info);
 
     void PriorityPendingOpsThread(std::stop_token stoken);
 
 private:
     const Instance& instance;
+    QueueType queue_type;
+    vk::Queue queue;
     MasterSemaphore master_semaphore;
     CommandPool command_pool;
     DynamicState dynamic_state;
@@ -443,8 +528,33 @@ private:
     std::condition_variable_any priority_pending_ops_cv;
     std::jthread priority_pending_ops_thread;
     RenderState render_state;
+    std::vector<std::unique_ptr<CommandPool>> secondary_command_pools;
+    std::vector<ParallelRecordSlot> parallel_slots;
+    // Deadline for coalescing tick-advance-only flushes into one vkQueueSubmit.
+    static constexpr std::chrono::microseconds SubmitLatencyBudget{3000};
+    std::chrono::steady_clock::time_point last_submit_time{};
     bool is_rendering = false;
+    bool is_parallel_recording = false;
     tracy::VkCtxScope* profiler_scope{};
+
+    static constexpr u32 NumGpuZoneQueries = 1024;
+    struct GpuZone {
+        const char* name;
+        u32 begin_query;
+        u32 end_query;
+        u64 cs_hash;
+    };
+    struct GpuZoneBatch {
+        std::vector<GpuZone> zones;
+        u64 tick;
+    };
+    vk::UniqueQueryPool gpu_zone_pool;
+    std::vector<GpuZone> frame_zones;
+    std::deque<GpuZoneBatch> pending_zone_batches;
+    u32 next_zone_query = 0;
+    bool gpu_zone_open = false;
+    bool render_zone_open = false;
+    float timestamp_period = 1.0f;
 };
 
 } // namespace Vulkan
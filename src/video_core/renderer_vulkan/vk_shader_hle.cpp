@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
 #include "shader_recompiler/info.h"
 #include "video_core/renderer_vulkan/vk_rasterizer.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -12,7 +14,8 @@ namespace Vulkan {
 
 static constexpr u64 COPY_SHADER_HASH = 0xfefebf9f;
 
-static bool ExecuteCopyShaderHLE(const Shader::Info& info, const AmdGpu::ComputeProgram& cs_program,
+static bool ExecuteCopyShaderHLE(const Shader::Info& info, const AmdGpu::Regs& regs,
+                                 const AmdGpu::ComputeProgram& cs_program,
                                  Rasterizer& rasterizer) {
     auto& scheduler = rasterizer.GetScheduler();
     auto& buffer_cache = rasterizer.GetBufferCache();
@@ -120,14 +123,31 @@ static bool ExecuteCopyShaderHLE(const Shader::Info& info, const AmdGpu::Compute
     return true;
 }
 
+using HleHandler = bool (*)(const Shader::Info& info, const AmdGpu::Regs& regs,
+                            const AmdGpu::ComputeProgram& cs_program, Rasterizer& rasterizer);
+
+struct HleShaderEntry {
+    u64 pgm_hash;
+    const char* name;
+    HleHandler handler;
+};
+
+// Registry of known GCN compute programs with hand-written host implementations.
+// Candidates for new entries come from the devtools compute shader report, which ranks
+// unmatched programs by accumulated GPU time.
+static constexpr std::array HLE_REGISTRY = {
+    HleShaderEntry{COPY_SHADER_HASH, "buffer copy", &ExecuteCopyShaderHLE},
+};
+
 bool ExecuteShaderHLE(const Shader::Info& info, const AmdGpu::Regs& regs,
                       const AmdGpu::ComputeProgram& cs_program, Rasterizer& rasterizer) {
-    switch (info.pgm_hash) {
-    case COPY_SHADER_HASH:
-        return ExecuteCopyShaderHLE(info, cs_program, rasterizer);
-    default:
-        return false;
+    for (const auto& entry : HLE_REGISTRY) {
+        if (entry.pgm_hash == info.pgm_hash) {
+            LOG_TRACE(Render_Vulkan, "Dispatching HLE shader '{}'", entry.name);
+            return entry.handler(info, regs, cs_program, rasterizer);
+        }
     }
+    return false;
 }
 
 } // namespace Vulkan
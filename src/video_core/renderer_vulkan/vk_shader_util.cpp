@@ -1,12 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
 #include <memory>
 #include <glslang/Include/ResourceLimits.h>
 #include <glslang/Public/ShaderLang.h>
 #include <glslang/SPIRV/GlslangToSpv.h>
 #include "common/assert.h"
+#include "common/hash.h"
 #include "common/logging/log.h"
+#include "video_core/cache_storage.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
 
 namespace Vulkan {
@@ -161,6 +164,21 @@ bool InitializeCompiler() {
 
 vk::ShaderModule Compile(std::string_view code, vk::ShaderStageFlagBits stage, vk::Device device,
                          std::vector<std::string> defines) {
+    // SPIR-V is driver independent, so cached blobs are reusable as-is; only the glslang
+    // run is skipped. The key covers everything that affects the generated code.
+    u64 blob_key = XXH3_64bits(code.data(), code.size());
+    blob_key = HashCombine(blob_key, static_cast<u64>(stage));
+    for (const auto& def : defines) {
+        blob_key = HashCombine(blob_key, XXH3_64bits(def.data(), def.size()));
+    }
+    const auto blob_name = fmt::format("{:016x}", blob_key);
+
+    std::vector<u32> cached_code{};
+    Storage::DataBase::Instance().Load(Storage::BlobType::HostShader, blob_name, cached_code);
+    if (!cached_code.empty()) {
+        return CompileSPV(cached_code, device);
+    }
+
     if (!InitializeCompiler()) {
         return {};
     }
@@ -251,6 +269,9 @@ vk::ShaderModule Compile(std::string_view code, vk::ShaderStageFlagBits stage, v
         LOG_INFO(Render_Vulkan, "SPIR-V conversion messages: {}", spv_messages);
     }
 
+    Storage::DataBase::Instance().Save(Storage::BlobType::HostShader, blob_name,
+                                       std::vector<u32>{out_code});
+
     return CompileSPV(out_code, device);
 }
 
@@ -266,4 +287,53 @@ vk::ShaderModule CompileSPV(std::span<const u32> code, vk::Device device) {
     return module;
 }
 
+vk::UniquePipelineCache CreatePrimedPipelineCache(vk::PhysicalDevice physical_device,
+                                                  vk::Device device, const std::string& name) {
+    std::vector<u8> data{};
+    Storage::DataBase::Instance().Load(Storage::BlobType::DriverCache, name, data);
+
+    // The blob header records the device and driver it was produced by; drivers are not
+    // required to tolerate foreign data, so validate it before handing it over.
+    struct Header {
+        u32 header_size;
+        u32 header_version;
+        u32 vendor_id;
+        u32 device_id;
+        std::array<u8, VK_UUID_SIZE> uuid;
+    } header{};
+    if (data.size() >= sizeof(Header)) {
+        std::memcpy(&header, data.data(), sizeof(Header));
+        const auto props = physical_device.getProperties();
+        if (header.header_version != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+            header.vendor_id != props.vendorID || header.device_id != props.deviceID ||
+            std::memcmp(header.uuid.data(), props.pipelineCacheUUID.data(), VK_UUID_SIZE) != 0) {
+            LOG_INFO(Render_Vulkan, "Driver cache blob '{}' is from another device, ignoring it",
+                     name);
+            data.clear();
+        }
+    } else {
+        data.clear();
+    }
+
+    const vk::PipelineCacheCreateInfo cache_ci = {
+        .initialDataSize = data.size(),
+        .pInitialData = data.data(),
+    };
+    auto [cache_result, cache] = device.createPipelineCacheUnique(cache_ci);
+    ASSERT_MSG(cache_result == vk::Result::eSuccess, "Failed to create pipeline cache: {}",
+               vk::to_string(cache_result));
+    return std::move(cache);
+}
+
+void SavePipelineCache(vk::Device device, vk::PipelineCache cache, const std::string& name) {
+    if (!Storage::DataBase::Instance().IsOpened()) {
+        return;
+    }
+    auto [data_result, data] = device.getPipelineCacheData(cache);
+    if (data_result != vk::Result::eSuccess || data.empty()) {
+        return;
+    }
+    Storage::DataBase::Instance().Save(Storage::BlobType::DriverCache, name, std::move(data));
+}
+
 } // namespace Vulkan
@@ -26,4 +26,16 @@ vk::ShaderModule Compile(std::string_view code, vk::ShaderStageFlagBits stage, v
  */
 vk::ShaderModule CompileSPV(std::span<const u32> code, vk::Device device);
 
+/**
+ * @brief Creates a driver pipeline cache primed with the named blob from the storage database.
+ * Blobs recorded by a different device or driver version are discarded.
+ */
+vk::UniquePipelineCache CreatePrimedPipelineCache(vk::PhysicalDevice physical_device,
+                                                  vk::Device device, const std::string& name);
+
+/**
+ * @brief Persists the contents of a driver pipeline cache under the given blob name.
+ */
+void SavePipelineCache(vk::Device device, vk::PipelineCache cache, const std::string& name);
+
 } // namespace Vulkan
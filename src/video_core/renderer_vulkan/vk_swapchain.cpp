@@ -20,6 +20,7 @@ static constexpr vk::SurfaceFormatKHR SURFACE_FORMAT_HDR = {
 
 Swapchain::Swapchain(const Instance& instance_, const Frontend::WindowSDL& window_)
     : instance{instance_}, window{window_}, surface{CreateSurface(instance.GetInstance(), window)} {
+    has_present_fences = instance.IsSwapchainMaintenance1Supported();
     FindPresentFormat();
     FindPresentMode();
 
@@ -85,6 +86,11 @@ void Swapchain::Recreate(u32 width_, u32 height_) {
     Create(width_, height_);
 }
 
+void Swapchain::RefreshPresentMode() {
+    FindPresentMode();
+    needs_recreation = true;
+}
+
 void Swapchain::SetHDR(bool hdr) {
     if (needs_hdr == hdr) {
         return;
@@ -128,8 +134,19 @@ bool Swapchain::AcquireNextImage() {
 }
 
 bool Swapchain::Present() {
+    vk::Fence present_fence{};
+    if (has_present_fences) {
+        // The fence may still be in flight from the last present of this image.
+        present_fence = present_fences[image_index];
+        WaitPresentFence(present_fence);
+    }
 
+    const vk::SwapchainPresentFenceInfoEXT fence_info = {
+        .swapchainCount = 1,
+        .pFences = &present_fence,
+    };
     const vk::PresentInfoKHR present_info = {
+        .pNext = has_present_fences ? &fence_info : nullptr,
         .waitSemaphoreCount = 1,
         .pWaitSemaphores = &present_ready[image_index],
         .swapchainCount = 1,
@@ -144,12 +161,40 @@ bool Swapchain::Present() {
         ASSERT_MSG(result == vk::Result::eSuccess, "Swapchain presentation failed: {}",
                    vk::to_string(result));
     }
+    if (has_present_fences) {
+        // The fence is signaled even for unsuccessful presents, so always track it.
+        pending_present_fences.push_back(present_fence);
+    }
 
     frame_index = (frame_index + 1) % image_count;
 
+    ThrottlePresentQueue();
+
     return !needs_recreation;
 }
 
+void Swapchain::WaitPresentFence(vk::Fence fence) {
+    const auto it = std::ranges::find(pending_present_fences, fence);
+    if (it == pending_present_fences.end()) {
+        return;
+    }
+    const vk::Device device = instance.GetDevice();
+    const auto wait_result = device.waitForFences(fence, true, std::numeric_limits<u64>::max());
+    ASSERT_MSG(wait_result == vk::Result::eSuccess, "Failed to wait for present fence: {}",
+               vk::to_string(wait_result));
+    const auto reset_result = device.resetFences(fence);
+    ASSERT_MSG(reset_result == vk::Result::eSuccess, "Failed to reset present fence: {}",
+               vk::to_string(reset_result));
+    pending_present_fences.erase(it);
+}
+
+void Swapchain::ThrottlePresentQueue() {
+    const u32 max_frames_in_flight = Config::getMaxFramesInFlight();
+    while (pending_present_fences.size() > max_frames_in_flight) {
+        WaitPresentFence(pending_present_fences.front());
+    }
+}
+
 void Swapchain::FindPresentFormat() {
     const auto [formats_result, formats] =
         instance.GetPhysicalDevice().getSurfaceFormatsKHR(surface);
@@ -256,6 +301,10 @@ void Swapchain::SetSurfaceProperties() {
 
 void Swapchain::Destroy() {
     vk::Device device = instance.GetDevice();
+    // Presentation engine accesses are only known to be over once the present fences signal.
+    while (!pending_present_fences.empty()) {
+        WaitPresentFence(pending_present_fences.front());
+    }
     const auto wait_result = device.waitIdle();
     if (wait_result != vk::Result::eSuccess) {
         LOG_WARNING(Render_Vulkan, "Failed to wait for device to become idle: {}",
@@ -271,9 +320,13 @@ void Swapchain::Destroy() {
     for (const auto& sem : present_ready) {
         device.destroySemaphore(sem);
     }
+    for (const auto& fence : present_fences) {
+        device.destroyFence(fence);
+    }
 
     image_acquired.clear();
     present_ready.clear();
+    present_fences.clear();
 }
 
 void Swapchain::RefreshSemaphores() {
@@ -295,9 +348,22 @@ void Swapchain::RefreshSemaphores() {
         semaphore = sem;
     }
 
+    if (has_present_fences) {
+        present_fences.resize(image_count);
+        for (vk::Fence& fence : present_fences) {
+            auto [fence_result, new_fence] = device.createFence({});
+            ASSERT_MSG(fence_result == vk::Result::eSuccess,
+                       "Failed to create present fence: {}", vk::to_string(fence_result));
+            fence = new_fence;
+        }
+    }
+
     for (u32 i = 0; i < image_count; ++i) {
         SetObjectName(device, image_acquired[i], "Swapchain Semaphore: image_acquired {}", i);
         SetObjectName(device, present_ready[i], "Swapchain Semaphore: present_ready {}", i);
+        if (has_present_fences) {
+            SetObjectName(device, present_fences[i], "Swapchain Fence: present {}", i);
+        }
     }
 }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deque>
 #include <mutex>
 #include <vector>
 #include "common/types.h"
@@ -34,6 +35,9 @@ public:
     /// Presents the current image and move to the next one
     bool Present();
 
+    /// Re-reads the configured present mode and schedules a recreation to apply it.
+    void RefreshPresentMode();
+
     vk::SurfaceKHR GetSurface() const {
         return surface;
     }
@@ -111,6 +115,13 @@ private:
     /// Creates the image acquired and present ready semaphores
     void RefreshSemaphores();
 
+    /// Waits for the given present fence if it is still pending and recycles it.
+    void WaitPresentFence(vk::Fence fence);
+
+    /// Blocks until the number of queued presents drops below the configured
+    /// frames-in-flight limit. Requires VK_EXT_swapchain_maintenance1.
+    void ThrottlePresentQueue();
+
 private:
     const Instance& instance;
     const Frontend::WindowSDL& window;
@@ -126,14 +137,17 @@ private:
     std::vector<vk::ImageView> images_view;
     std::vector<vk::Semaphore> image_acquired;
     std::vector<vk::Semaphore> present_ready;
+    std::vector<vk::Fence> present_fences;
+    std::deque<vk::Fence> pending_present_fences;
     u32 width = 0;
     u32 height = 0;
     u32 image_count = 0;
     u32 image_index = 0;
     u32 frame_index = 0;
     bool needs_recreation = true;
-    bool needs_hdr = false;    // The game requested HDR swapchain
-    bool supports_hdr = false; // SC supports HDR output
+    bool needs_hdr = false;           // The game requested HDR swapchain
+    bool supports_hdr = false;        // SC supports HDR output
+    bool has_present_fences = false;  // VK_EXT_swapchain_maintenance1 fence-on-present
 };
 
 } // namespace Vulkan
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "common/path_util.h"
+#include "video_core/shader_pack.h"
+
+#ifdef _WIN64
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace Storage {
+
+ShaderPack::~ShaderPack() {
+    Close();
+}
+
+bool ShaderPack::Open(const std::filesystem::path& path) {
+    Close();
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read};
+    if (!file.IsOpen()) {
+        return false;
+    }
+    const u64 file_size = file.GetSize();
+    if (file_size < sizeof(Header)) {
+        return false;
+    }
+
+#ifdef _WIN64
+    HANDLE hfile = std::bit_cast<HANDLE>(file.GetFileMapping());
+    HANDLE mapping = CreateFileMappingW(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        LOG_ERROR(Common_Filesystem, "Failed to create shader pack mapping");
+        return false;
+    }
+    void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    // The view holds a reference on the mapping object, so the handle can go.
+    CloseHandle(mapping);
+    if (!ptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to map shader pack view");
+        return false;
+    }
+#else
+    const int fd = static_cast<int>(file.GetFileMapping());
+    void* ptr = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to mmap shader pack: {}", strerror(errno));
+        return false;
+    }
+#endif
+
+    base = static_cast<const u8*>(ptr);
+    mapped_size = file_size;
+
+    Header header{};
+    std::memcpy(&header, base, sizeof(header));
+    if (header.magic != Magic || header.version != Version ||
+        sizeof(Header) + header.num_entries * sizeof(IndexEntry) > file_size) {
+        LOG_WARNING(Common_Filesystem, "Ignoring incompatible shader pack {}",
+                    Common::FS::PathToUTF8String(path));
+        Close();
+        return false;
+    }
+
+    num_entries = header.num_entries;
+    index = reinterpret_cast<const IndexEntry*>(base + sizeof(Header));
+    LOG_INFO(Common_Filesystem, "Mapped shader pack with {} shaders", num_entries);
+    return true;
+}
+
+void ShaderPack::Close() {
+    if (!base) {
+        return;
+    }
+#ifdef _WIN64
+    UnmapViewOfFile(const_cast<u8*>(base));
+#else
+    munmap(const_cast<u8*>(base), mapped_size);
+#endif
+    base = nullptr;
+    mapped_size = 0;
+    index = nullptr;
+    num_entries = 0;
+}
+
+std::span<const u32> ShaderPack::Find(u64 key) const {
+    if (!base) {
+        return {};
+    }
+    const auto* end = index + num_entries;
+    const auto* it = std::lower_bound(index, end, key,
+                                      [](const IndexEntry& entry, u64 k) { return entry.key < k; });
+    if (it == end || it->key != key || it->offset + it->size > mapped_size) {
+        return {};
+    }
+    return {reinterpret_cast<const u32*>(base + it->offset), it->size / sizeof(u32)};
+}
+
+bool ShaderPack::Write(const std::filesystem::path& path,
+                       std::span<const std::pair<u64, std::vector<u32>>> shaders) {
+    std::vector<IndexEntry> entries(shaders.size());
+    u64 offset = sizeof(Header) + shaders.size() * sizeof(IndexEntry);
+    for (size_t i = 0; i < shaders.size(); ++i) {
+        entries[i] = {
+            .key = shaders[i].first,
+            .offset = offset,
+            .size = shaders[i].second.size() * sizeof(u32),
+        };
+        offset += entries[i].size;
+    }
+    // The index must be key-sorted for lookup, but blobs stay in insertion order.
+    std::ranges::sort(entries, {}, &IndexEntry::key);
+
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Create};
+    if (!file.IsOpen()) {
+        return false;
+    }
+    const Header header{
+        .magic = Magic,
+        .version = Version,
+        .num_entries = shaders.size(),
+    };
+    file.WriteRaw<u8>(&header, sizeof(header));
+    file.WriteSpan<IndexEntry>(entries);
+    // Blob order must match the offsets assigned above.
+    for (const auto& [key, code] : shaders) {
+        file.WriteSpan<u32>(code);
+    }
+    return true;
+}
+
+} // namespace Storage
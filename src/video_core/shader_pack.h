@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+#include "common/types.h"
+
+namespace Storage {
+
+/// Compact single-file shader container: header, key-sorted index, raw SPIR-V blobs.
+/// The whole file is memory-mapped, so a lookup is a binary search over the mapped
+/// index and returns a zero-copy view of the code, with no per-shader file opens.
+class ShaderPack {
+public:
+    ShaderPack() = default;
+    ~ShaderPack();
+
+    ShaderPack(const ShaderPack&) = delete;
+    ShaderPack& operator=(const ShaderPack&) = delete;
+
+    /// Maps an existing pack read-only. Returns false if missing or malformed.
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    [[nodiscard]] bool IsOpened() const {
+        return base != nullptr;
+    }
+
+    [[nodiscard]] u64 NumShaders() const {
+        return num_entries;
+    }
+
+    /// Returns a view into the mapped file, or an empty span when the key is absent.
+    std::span<const u32> Find(u64 key) const;
+
+    /// Serializes the provided shaders into a new pack file, sorting the index by key.
+    static bool Write(const std::filesystem::path& path,
+                      std::span<const std::pair<u64, std::vector<u32>>> shaders);
+
+private:
+    static constexpr u32 Magic = 0x4B505353; // 'SSPK'
+    static constexpr u32 Version = 1;
+
+    struct Header {
+        u32 magic;
+        u32 version;
+        u64 num_entries;
+    };
+
+    struct IndexEntry {
+        u64 key;
+        u64 offset; // Byte offset of the blob from the file start
+        u64 size;   // Blob size in bytes
+    };
+
+    const u8* base{};
+    size_t mapped_size{};
+    const IndexEntry* index{};
+    u64 num_entries{};
+};
+
+} // namespace Storage
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string>
+
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
@@ -10,6 +12,7 @@
 #include "video_core/host_shaders/color_to_ms_depth_frag.h"
 #include "video_core/host_shaders/fs_tri_vert.h"
 #include "video_core/host_shaders/ms_image_blit_frag.h"
+#include "video_core/host_shaders/ms_image_resolve_frag.h"
 
 namespace VideoCore {
 
@@ -42,6 +45,9 @@ BlitHelper::~BlitHelper() {
     device.destroy(color_to_ms_depth_frag);
     device.destroy(src_msaa_copy_frag);
     device.destroy(src_non_msaa_copy_frag);
+    for (const auto& frag : ms_resolve_frags) {
+        device.destroy(frag.second);
+    }
 }
 
 void BlitHelper::ReinterpretColorAsMsDepth(u32 width, u32 height, u32 num_samples,
@@ -251,6 +257,118 @@ void BlitHelper::CopyBetweenMsImages(u32 width, u32 height, u32 num_samples,
     scheduler.GetDynamicState().Invalidate();
 }
 
+void BlitHelper::ResolveMsImage(u32 width, u32 height, u32 num_samples,
+                                vk::Format src_pixel_format, vk::Format dst_pixel_format,
+                                vk::Image source, u32 src_layer, vk::Image dest, u32 dst_layer) {
+    const vk::ImageViewUsageCreateInfo src_usage_ci{.usage = vk::ImageUsageFlagBits::eSampled};
+    const vk::ImageViewCreateInfo src_view_ci = {
+        .pNext = &src_usage_ci,
+        .image = source,
+        .viewType = vk::ImageViewType::e2D,
+        .format = src_pixel_format,
+        .subresourceRange{
+            .aspectMask = vk::ImageAspectFlagBits::eColor,
+            .baseMipLevel = 0U,
+            .levelCount = 1U,
+            .baseArrayLayer = src_layer,
+            .layerCount = 1U,
+        },
+    };
+    const auto [src_view_result, src_view] = instance.GetDevice().createImageView(src_view_ci);
+    ASSERT_MSG(src_view_result == vk::Result::eSuccess, "Failed to create image view: {}",
+               vk::to_string(src_view_result));
+
+    const vk::ImageViewUsageCreateInfo dst_usage_ci{.usage =
+                                                        vk::ImageUsageFlagBits::eColorAttachment};
+    const vk::ImageViewCreateInfo dst_view_ci = {
+        .pNext = &dst_usage_ci,
+        .image = dest,
+        .viewType = vk::ImageViewType::e2D,
+        .format = dst_pixel_format,
+        .subresourceRange{
+            .aspectMask = vk::ImageAspectFlagBits::eColor,
+            .baseMipLevel = 0U,
+            .levelCount = 1U,
+            .baseArrayLayer = dst_layer,
+            .layerCount = 1U,
+        },
+    };
+    const auto [dst_view_result, dst_view] = instance.GetDevice().createImageView(dst_view_ci);
+    ASSERT_MSG(dst_view_result == vk::Result::eSuccess, "Failed to create image view: {}",
+               vk::to_string(dst_view_result));
+    scheduler.DeferOperation([device = instance.GetDevice(), src_view, dst_view] {
+        device.destroyImageView(src_view);
+        device.destroyImageView(dst_view);
+    });
+
+    Vulkan::RenderState state{};
+    state.width = width;
+    state.height = height;
+    state.color_attachments[state.num_color_attachments++] = vk::RenderingAttachmentInfo{
+        .imageView = dst_view,
+        .imageLayout = vk::ImageLayout::eColorAttachmentOptimal,
+        .loadOp = vk::AttachmentLoadOp::eDontCare,
+        .storeOp = vk::AttachmentStoreOp::eStore,
+    };
+    scheduler.BeginRendering(state);
+
+    const auto cmdbuf = scheduler.CommandBuffer();
+    const vk::DescriptorImageInfo image_info = {
+        .sampler = VK_NULL_HANDLE,
+        .imageView = src_view,
+        .imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+    };
+    const vk::WriteDescriptorSet texture_write = {
+        .dstSet = VK_NULL_HANDLE,
+        .dstBinding = 0U,
+        .dstArrayElement = 0U,
+        .descriptorCount = 1U,
+        .descriptorType = vk::DescriptorType::eSampledImage,
+        .pImageInfo = &image_info,
+    };
+    cmdbuf.pushDescriptorSetKHR(vk::PipelineBindPoint::eGraphics, *single_texture_pl_layout, 0U,
+                                texture_write);
+
+    const MsPipelineKey key{num_samples, dst_pixel_format, true};
+    auto it = std::ranges::find(ms_image_resolve_pl, key, &MsPipeline::first);
+    if (it == ms_image_resolve_pl.end()) {
+        CreateMsResolvePipeline(key);
+        it = --ms_image_resolve_pl.end();
+    }
+    cmdbuf.bindPipeline(vk::PipelineBindPoint::eGraphics, *it->second);
+
+    const vk::Viewport viewport = {
+        .x = 0,
+        .y = 0,
+        .width = float(state.width),
+        .height = float(state.height),
+        .minDepth = 0.f,
+        .maxDepth = 1.f,
+    };
+    cmdbuf.setViewportWithCount(viewport);
+
+    const vk::Rect2D scissor = {
+        .offset = {0, 0},
+        .extent = {state.width, state.height},
+    };
+    cmdbuf.setScissorWithCount(scissor);
+
+    cmdbuf.draw(3, 1, 0, 0);
+
+    scheduler.EndRendering();
+    scheduler.GetDynamicState().Invalidate();
+}
+
+vk::PipelineCache BlitHelper::GetPipelineCache() {
+    // The blit helper is constructed before the storage database is opened, so the driver
+    // cache is primed lazily on the first conversion draw instead.
+    if (!pipeline_cache) {
+        pipeline_cache = Vulkan::CreatePrimedPipelineCache(instance.GetPhysicalDevice(),
+                                                           instance.GetDevice(), "blit");
+    }
+    return *pipeline_cache;
+}
+
 void BlitHelper::CreateShaders() {
     const auto device = instance.GetDevice();
     fs_tri_vertex =
@@ -263,6 +381,19 @@ void BlitHelper::CreateShaders() {
                                              vk::ShaderStageFlagBits::eFragment, device);
 }
 
+vk::ShaderModule BlitHelper::GetMsResolveShader(u32 num_samples) {
+    const auto it = std::ranges::find(ms_resolve_frags, num_samples,
+                                      &std::pair<u32, vk::ShaderModule>::first);
+    if (it != ms_resolve_frags.end()) {
+        return it->second;
+    }
+    const auto frag = Vulkan::Compile(HostShaders::MS_IMAGE_RESOLVE_FRAG,
+                                      vk::ShaderStageFlagBits::eFragment, instance.GetDevice(),
+                                      {"NUM_SAMPLES=" + std::to_string(num_samples)});
+    ms_resolve_frags.emplace_back(num_samples, frag);
+    return frag;
+}
+
 void BlitHelper::CreatePipelineLayouts() {
     const vk::DescriptorSetLayoutBinding texture_binding = {
         .binding = 0,
@@ -352,12 +483,15 @@ void BlitHelper::CreateColorToMSDepthPipeline(const MsPipelineKey& key) {
     };
 
     auto [pipeline_result, pipeline] =
-        instance.GetDevice().createGraphicsPipelineUnique(VK_NULL_HANDLE, pipeline_info);
+        instance.GetDevice().createGraphicsPipelineUnique(GetPipelineCache(), pipeline_info);
     ASSERT_MSG(pipeline_result == vk::Result::eSuccess, "Failed to create graphics pipeline: {}",
                vk::to_string(pipeline_result));
     Vulkan::SetObjectName(instance.GetDevice(), *pipeline, "Color to MS Depth {}", key.num_samples);
 
     color_to_ms_depth_pl.emplace_back(key, std::move(pipeline));
+
+    // New conversion pipelines are rare, so persist right away; shutdown skips destructors.
+    Vulkan::SavePipelineCache(instance.GetDevice(), *pipeline_cache, "blit");
 }
 
 void BlitHelper::CreateMsCopyPipeline(const MsPipelineKey& key) {
@@ -430,13 +564,97 @@ void BlitHelper::CreateMsCopyPipeline(const MsPipelineKey& key) {
     };
 
     auto [pipeline_result, pipeline] =
-        instance.GetDevice().createGraphicsPipelineUnique(VK_NULL_HANDLE, pipeline_info);
+        instance.GetDevice().createGraphicsPipelineUnique(GetPipelineCache(), pipeline_info);
     ASSERT_MSG(pipeline_result == vk::Result::eSuccess, "Failed to create graphics pipeline: {}",
                vk::to_string(pipeline_result));
     Vulkan::SetObjectName(instance.GetDevice(), *pipeline, "Non MS Image to MS Image {}",
                           key.num_samples);
 
     ms_image_copy_pl.emplace_back(key, std::move(pipeline));
+
+    Vulkan::SavePipelineCache(instance.GetDevice(), *pipeline_cache, "blit");
+}
+
+void BlitHelper::CreateMsResolvePipeline(const MsPipelineKey& key) {
+    const vk::PipelineInputAssemblyStateCreateInfo input_assembly = {
+        .topology = vk::PrimitiveTopology::eTriangleList,
+    };
+    // The destination is single sampled; the source sample count only selects the
+    // specialized fragment shader doing the averaging loop.
+    const vk::PipelineMultisampleStateCreateInfo multisampling = {
+        .rasterizationSamples = vk::SampleCountFlagBits::e1,
+    };
+    const vk::PipelineDepthStencilStateCreateInfo depth_state = {
+        .depthTestEnable = false,
+        .depthWriteEnable = false,
+        .depthCompareOp = vk::CompareOp::eAlways,
+    };
+    const std::array dynamic_states = {vk::DynamicState::eViewportWithCount,
+                                       vk::DynamicState::eScissorWithCount};
+    const vk::PipelineDynamicStateCreateInfo dynamic_info = {
+        .dynamicStateCount = static_cast<u32>(dynamic_states.size()),
+        .pDynamicStates = dynamic_states.data(),
+    };
+
+    std::array<vk::PipelineShaderStageCreateInfo, 2> shader_stages;
+    shader_stages[0] = {
+        .stage = vk::ShaderStageFlagBits::eVertex,
+        .module = fs_tri_vertex,
+        .pName = "main",
+    };
+    shader_stages[1] = {
+        .stage = vk::ShaderStageFlagBits::eFragment,
+        .module = GetMsResolveShader(key.num_samples),
+        .pName = "main",
+    };
+
+    const vk::PipelineRenderingCreateInfo pipeline_rendering_ci = {
+        .colorAttachmentCount = 1u,
+        .pColorAttachmentFormats = &key.attachment_format,
+        .depthAttachmentFormat = vk::Format::eUndefined,
+        .stencilAttachmentFormat = vk::Format::eUndefined,
+    };
+
+    const vk::PipelineColorBlendAttachmentState attachment = {
+        .blendEnable = false,
+        .colorWriteMask = vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
+                          vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA,
+    };
+
+    const vk::PipelineColorBlendStateCreateInfo color_blending = {
+        .logicOpEnable = false,
+        .logicOp = vk::LogicOp::eCopy,
+        .attachmentCount = 1u,
+        .pAttachments = &attachment,
+    };
+    const vk::PipelineViewportStateCreateInfo viewport_info{};
+    const vk::PipelineVertexInputStateCreateInfo vertex_input_info{};
+    const vk::PipelineRasterizationStateCreateInfo raster_state{.lineWidth = 1.f};
+
+    const vk::GraphicsPipelineCreateInfo pipeline_info = {
+        .pNext = &pipeline_rendering_ci,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_info,
+        .pInputAssemblyState = &input_assembly,
+        .pViewportState = &viewport_info,
+        .pRasterizationState = &raster_state,
+        .pMultisampleState = &multisampling,
+        .pDepthStencilState = &depth_state,
+        .pColorBlendState = &color_blending,
+        .pDynamicState = &dynamic_info,
+        .layout = *single_texture_pl_layout,
+    };
+
+    auto [pipeline_result, pipeline] =
+        instance.GetDevice().createGraphicsPipelineUnique(GetPipelineCache(), pipeline_info);
+    ASSERT_MSG(pipeline_result == vk::Result::eSuccess, "Failed to create graphics pipeline: {}",
+               vk::to_string(pipeline_result));
+    Vulkan::SetObjectName(instance.GetDevice(), *pipeline, "MS Image Resolve {}", key.num_samples);
+
+    ms_image_resolve_pl.emplace_back(key, std::move(pipeline));
+
+    Vulkan::SavePipelineCache(instance.GetDevice(), *pipeline_cache, "blit");
 }
 
 } // namespace VideoCore
@@ -33,9 +33,14 @@ public:
     void CopyBetweenMsImages(u32 width, u32 height, u32 num_samples, vk::Format pixel_format,
                              bool src_msaa, vk::Image source, vk::Image dest);
 
+    void ResolveMsImage(u32 width, u32 height, u32 num_samples, vk::Format src_pixel_format,
+                        vk::Format dst_pixel_format, vk::Image source, u32 src_layer,
+                        vk::Image dest, u32 dst_layer);
+
 private:
     void CreateShaders();
     void CreatePipelineLayouts();
+    vk::ShaderModule GetMsResolveShader(u32 num_samples);
 
     struct MsPipelineKey {
         u32 num_samples;
@@ -46,20 +51,26 @@ private:
     };
     void CreateColorToMSDepthPipeline(const MsPipelineKey& key);
     void CreateMsCopyPipeline(const MsPipelineKey& key);
+    void CreateMsResolvePipeline(const MsPipelineKey& key);
+    vk::PipelineCache GetPipelineCache();
 
 private:
     const Vulkan::Instance& instance;
     Vulkan::Scheduler& scheduler;
     vk::UniqueDescriptorSetLayout single_texture_descriptor_set_layout;
     vk::UniquePipelineLayout single_texture_pl_layout;
+    vk::UniquePipelineCache pipeline_cache;
     vk::ShaderModule fs_tri_vertex;
     vk::ShaderModule color_to_ms_depth_frag;
     vk::ShaderModule src_msaa_copy_frag;
     vk::ShaderModule src_non_msaa_copy_frag;
+    // Averaging resolve shaders, specialized per source sample count on first use.
+    std::vector<std::pair<u32, vk::ShaderModule>> ms_resolve_frags;
 
     using MsPipeline = std::pair<MsPipelineKey, vk::UniquePipeline>;
     std::vector<MsPipeline> color_to_ms_depth_pl;
     std::vector<MsPipeline> ms_image_copy_pl;
+    std::vector<MsPipeline> ms_image_resolve_pl;
 };
 
 } // namespace VideoCore
@@ -187,14 +187,15 @@ ImageView& Image::FindView(const ImageViewInfo& view_info, bool ensure_guest_sam
     if (ensure_guest_samples && backing->num_samples > 1 != info.num_samples > 1) {
         SetBackingSamples(info.num_samples);
     }
-    const auto& view_infos = backing->image_view_infos;
-    const auto it = std::ranges::find(view_infos, view_info);
-    if (it != view_infos.end()) {
-        const auto view_id = backing->image_view_ids[std::distance(view_infos.begin(), it)];
+    const u128 key = view_info.PackedKey();
+    const auto& view_keys = backing->image_view_keys;
+    const auto it = std::ranges::find(view_keys, key);
+    if (it != view_keys.end()) {
+        const auto view_id = backing->image_view_ids[std::distance(view_keys.begin(), it)];
         return (*slot_image_views)[view_id];
     }
     const auto view_id = slot_image_views->insert(*instance, view_info, *this);
-    backing->image_view_infos.emplace_back(view_info);
+    backing->image_view_keys.emplace_back(key);
     backing->image_view_ids.emplace_back(view_id);
     return (*slot_image_views)[view_id];
 }
@@ -233,36 +234,73 @@ Image::Barriers Image::GetBarriers(vk::ImageLayout dst_layout, vk::AccessFlags2
 
         for (u32 mip : mips) {
             for (u32 layer : layers) {
-                // NOTE: these loops may produce a lot of small barriers.
-                // If this becomes a problem, we can optimize it by merging adjacent barriers.
                 const auto subres_idx = mip * info.resources.layers + layer;
                 ASSERT(subres_idx < subresource_states.size());
                 auto& state = subresource_states[subres_idx];
 
-                if (state.layout != dst_layout || state.access_mask != dst_mask) {
-                    barriers.emplace_back(vk::ImageMemoryBarrier2{
-                        .srcStageMask = state.pl_stage,
-                        .srcAccessMask = state.access_mask,
-                        .dstStageMask = dst_stage,
-                        .dstAccessMask = dst_mask,
-                        .oldLayout = state.layout,
-                        .newLayout = dst_layout,
-                        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                        .image = GetImage(),
-                        .subresourceRange{
-                            .aspectMask = aspect_mask,
-                            .baseMipLevel = mip,
-                            .levelCount = 1,
-                            .baseArrayLayer = layer,
-                            .layerCount = 1,
-                        },
-                    });
-                    state.layout = dst_layout;
-                    state.access_mask = dst_mask;
-                    state.pl_stage = dst_stage;
+                if (state.layout == dst_layout && state.access_mask == dst_mask) {
+                    continue;
+                }
+                // Extend the previous barrier over adjacent layers leaving the same state
+                // instead of emitting one barrier per subresource.
+                if (!barriers.empty()) {
+                    auto& prev = barriers.back();
+                    auto& prev_range = prev.subresourceRange;
+                    if (prev.srcStageMask == state.pl_stage &&
+                        prev.srcAccessMask == state.access_mask &&
+                        prev.oldLayout == state.layout && prev_range.baseMipLevel == mip &&
+                        prev_range.levelCount == 1 &&
+                        prev_range.baseArrayLayer + prev_range.layerCount == layer) {
+                        ++prev_range.layerCount;
+                        state.layout = dst_layout;
+                        state.access_mask = dst_mask;
+                        state.pl_stage = dst_stage;
+                        continue;
+                    }
+                }
+                barriers.emplace_back(vk::ImageMemoryBarrier2{
+                    .srcStageMask = state.pl_stage,
+                    .srcAccessMask = state.access_mask,
+                    .dstStageMask = dst_stage,
+                    .dstAccessMask = dst_mask,
+                    .oldLayout = state.layout,
+                    .newLayout = dst_layout,
+                    .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .image = GetImage(),
+                    .subresourceRange{
+                        .aspectMask = aspect_mask,
+                        .baseMipLevel = mip,
+                        .levelCount = 1,
+                        .baseArrayLayer = layer,
+                        .layerCount = 1,
+                    },
+                });
+                state.layout = dst_layout;
+                state.access_mask = dst_mask;
+                state.pl_stage = dst_stage;
+            }
+        }
+
+        // Collapse barriers of adjacent mips whose source states and layer spans match, so a
+        // uniform transition of the whole range still ends up as a single barrier.
+        if (barriers.size() > 1) {
+            size_t out = 0;
+            for (size_t i = 1; i < barriers.size(); ++i) {
+                auto& prev = barriers[out];
+                const auto& cur = barriers[i];
+                if (prev.srcStageMask == cur.srcStageMask &&
+                    prev.srcAccessMask == cur.srcAccessMask && prev.oldLayout == cur.oldLayout &&
+                    prev.subresourceRange.baseArrayLayer == cur.subresourceRange.baseArrayLayer &&
+                    prev.subresourceRange.layerCount == cur.subresourceRange.layerCount &&
+                    prev.subresourceRange.baseMipLevel + prev.subresourceRange.levelCount ==
+                        cur.subresourceRange.baseMipLevel) {
+                    prev.subresourceRange.levelCount += cur.subresourceRange.levelCount;
+                } else {
+                    barriers[++out] = cur;
                 }
             }
+            barriers.resize(out + 1);
         }
 
         if (!needs_partial_transition) {
@@ -682,11 +720,28 @@ void Image::Resolve(Image& src_image, const VideoCore::SubresourceRange& mrt0_ra
     SetBackingSamples(1, false);
     scheduler->EndRendering();
 
+    const auto [src_layers, dst_layers] = SanitizeCopyLayers(src_image.info, info, 1);
+    if (src_image.backing->num_samples > 1 && src_image.info.pixel_format != info.pixel_format) {
+        // vkCmdResolveImage requires identical source and destination formats, so resolves
+        // into a differently-formatted target are emulated with an averaging draw.
+        src_image.Transit(vk::ImageLayout::eShaderReadOnlyOptimal,
+                          vk::AccessFlagBits2::eShaderRead, mrt0_range);
+        Transit(vk::ImageLayout::eColorAttachmentOptimal,
+                vk::AccessFlagBits2::eColorAttachmentWrite, mrt1_range);
+        blit_helper->ResolveMsImage(info.size.width, info.size.height,
+                                    src_image.backing->num_samples, src_image.info.pixel_format,
+                                    info.pixel_format, src_image.GetImage(), mrt0_range.base.layer,
+                                    GetImage(), mrt1_range.base.layer);
+
+        flags |= VideoCore::ImageFlagBits::GpuModified;
+        flags &= ~VideoCore::ImageFlagBits::Dirty;
+        return;
+    }
+
     src_image.Transit(vk::ImageLayout::eTransferSrcOptimal, vk::AccessFlagBits2::eTransferRead,
                       mrt0_range);
     Transit(vk::ImageLayout::eTransferDstOptimal, vk::AccessFlagBits2::eTransferWrite, mrt1_range);
 
-    const auto [src_layers, dst_layers] = SanitizeCopyLayers(src_image.info, info, 1);
     if (src_image.backing->num_samples == 1) {
         const vk::ImageCopy region = {
             .srcSubresource{
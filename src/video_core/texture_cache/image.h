@@ -160,7 +160,7 @@ public:
         UniqueImage image;
         State state;
         std::vector<State> subresource_states;
-        boost::container::small_vector<ImageViewInfo, 4> image_view_infos;
+        boost::container::small_vector<u128, 4> image_view_keys;
         boost::container::small_vector<ImageViewId, 4> image_view_ids;
         u32 num_samples;
     };
@@ -170,6 +170,23 @@ public:
     u64 lru_id{};
     u64 tick_accessed_last{};
     u64 hash{};
+    u64 content_hash{};
+
+    // Per-frame activity counters for the devtools texture heatmap, reset after collection.
+    struct {
+        u32 binds{};
+        u64 upload_bytes{};
+        u64 detile_ns{};
+    } frame_stats{};
+
+    // Depth copy elision. The content serial is bumped whenever the image is written as a
+    // depth-stencil target or refreshed from guest memory; a requested copy into this image
+    // is skipped while the recorded source image and serial still match.
+    u64 depth_content_serial{};
+    ImageId depth_copy_src{};
+    VAddr depth_copy_src_addr{};
+    u64 depth_copy_src_serial{};
+    vk::ImageAspectFlags depth_copy_aspects{};
 
     struct {
         u32 texture : 1;
@@ -37,6 +37,21 @@ struct ImageViewInfo {
     bool is_storage = false;
 
     auto operator<=>(const ImageViewInfo&) const = default;
+
+    /// Packs every view-relevant field into one 128-bit word, so the per-image view cache
+    /// probes with a single compare instead of a member-wise one. Mip and layer values fit
+    /// 16 bits each and swizzles 4 bits on this hardware.
+    u128 PackedKey() const noexcept {
+        const u64 swizzles = (static_cast<u64>(mapping.r) & 0xF) |
+                             (static_cast<u64>(mapping.g) & 0xF) << 4 |
+                             (static_cast<u64>(mapping.b) & 0xF) << 8 |
+                             (static_cast<u64>(mapping.a) & 0xF) << 12;
+        return {static_cast<u64>(static_cast<u32>(format)) | static_cast<u64>(type) << 32 |
+                    static_cast<u64>(is_storage) << 40 | swizzles << 48,
+                static_cast<u64>(range.base.level) | static_cast<u64>(range.base.layer) << 16 |
+                    static_cast<u64>(range.extent.levels) << 32 |
+                    static_cast<u64>(range.extent.layers) << 48};
+    }
 };
 
 struct Image;
@@ -1,12 +1,16 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+#include <utility>
 #include <xxhash.h>
 
 #include "common/assert.h"
 #include "common/config.h"
 #include "common/debug.h"
+#include "common/hash.h"
 #include "common/scope_exit.h"
+#include "core/debug_state.h"
 #include "core/memory.h"
 #include "video_core/buffer_cache/buffer_cache.h"
 #include "video_core/page_manager.h"
@@ -18,7 +22,6 @@
 
 namespace VideoCore {
 
-static constexpr u64 PageShift = 12;
 static constexpr u64 NumFramesBeforeRemoval = 32;
 
 TextureCache::TextureCache(const Vulkan::Instance& instance_, Vulkan::Scheduler& scheduler_,
@@ -39,7 +42,11 @@ TextureCache::TextureCache(const Vulkan::Instance& instance_, Vulkan::Scheduler&
         return;
     }
 
-    const s64 device_local_memory = static_cast<s64>(instance.GetTotalMemoryBudget());
+    UpdateGcThresholds(instance.GetTotalMemoryBudget());
+}
+
+void TextureCache::UpdateGcThresholds(u64 device_budget) {
+    const s64 device_local_memory = static_cast<s64>(device_budget);
     const s64 min_spacing_expected = device_local_memory - 1_GB;
     const s64 min_spacing_critical = device_local_memory - 512_MB;
     const s64 mem_threshold = std::min<s64>(device_local_memory, TARGET_GC_THRESHOLD);
@@ -745,6 +752,26 @@ void TextureCache::RefreshImage(Image& image) {
     const bool is_gpu_modified = True(image.flags & ImageFlagBits::GpuModified);
     const bool is_gpu_dirty = True(image.flags & ImageFlagBits::GpuDirty);
 
+    // Content gate for small and medium images: games commonly rewrite identical UI atlases
+    // every frame, so skip the upload when a hash of the guest bytes is unchanged. Images up
+    // to the full-hash limit are hashed completely, which can never miss a write; larger ones
+    // fall back to a sampled hash that covers only a fraction of the bytes, so the gate can
+    // be disabled per game when a title updates textures in the unsampled gaps.
+    constexpr u64 FullHashMaxSize = 512_KB;
+    constexpr u64 ContentHashMaxSize = 4_MB;
+    const u64 guest_size = image.info.guest_size;
+    if (!is_gpu_modified && guest_size <= ContentHashMaxSize &&
+        (guest_size <= FullHashMaxSize || Config::textureContentHash())) {
+        const auto* addr = std::bit_cast<u8*>(image.info.guest_address);
+        const u64 content_hash = guest_size <= FullHashMaxSize ? XXH3_64bits(addr, guest_size)
+                                                               : SampledHash(addr, guest_size);
+        if (image.content_hash == content_hash) {
+            image.flags &= ~ImageFlagBits::Dirty;
+            return;
+        }
+        image.content_hash = content_hash;
+    }
+
     boost::container::small_vector<vk::BufferImageCopy, 14> image_copies;
     for (u32 m = 0; m < num_mips; m++) {
         const u32 width = std::max(image.info.size.width >> m, 1u);
@@ -765,6 +792,7 @@ void TextureCache::RefreshImage(Image& image) {
 
         const u32 extent_width = mip_pitch ? std::min(mip_pitch, width) : width;
         const u32 extent_height = mip_height ? std::min(mip_height, height) : height;
+        image.frame_stats.upload_bytes += mip_size;
         image_copies.push_back({
             .bufferOffset = mip_offset,
             .bufferRowLength = mip_pitch,
@@ -798,20 +826,99 @@ void TextureCache::RefreshImage(Image& image) {
         });
     }
 
+    const bool collect_stats = DebugState.IsTextureStatsEnabled();
+    const auto detile_start =
+        collect_stats ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
     const auto [buffer, offset] =
         tile_manager.DetileImage(in_buffer->Handle(), in_offset, image.info);
+    if (collect_stats) {
+        image.frame_stats.detile_ns +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                 detile_start)
+                .count();
+    }
     for (auto& copy : image_copies) {
         copy.bufferOffset += offset;
     }
 
     image.Upload(image_copies, buffer, offset);
+    if (image.info.props.is_depth) {
+        // Guest bytes changed; recorded depth copies of this image are stale.
+        ++image.depth_content_serial;
+        image.depth_copy_src = {};
+    }
+}
+
+void TextureCache::CollectFrameStats() {
+    const bool enabled = DebugState.IsTextureStatsEnabled();
+    if (!enabled && !collecting_frame_stats) {
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    if (!enabled) {
+        collecting_frame_stats = false;
+        return;
+    }
+    if (!collecting_frame_stats) {
+        // Counters kept accumulating while collection was off; drop them so the first
+        // published frame covers exactly one frame.
+        for (auto& image : slot_images) {
+            image.frame_stats = {};
+        }
+        frame_evictions = 0;
+        collecting_frame_stats = true;
+        return;
+    }
+
+    DebugStateType::TextureFrameStats stats{};
+    stats.evictions = std::exchange(frame_evictions, 0);
+    for (auto& image : slot_images) {
+        stats.total_images += image.frame_stats.binds != 0;
+        stats.total_binds += image.frame_stats.binds;
+        stats.total_upload_bytes += image.frame_stats.upload_bytes;
+        stats.total_detile_ns += image.frame_stats.detile_ns;
+        if (image.frame_stats.binds != 0 || image.frame_stats.upload_bytes != 0) {
+            stats.images.push_back({
+                .guest_address = image.info.guest_address,
+                .guest_size = image.info.guest_size,
+                .width = image.info.size.width,
+                .height = image.info.size.height,
+                .format = vk::to_string(image.info.pixel_format),
+                .binds = image.frame_stats.binds,
+                .upload_bytes = image.frame_stats.upload_bytes,
+                .detile_ns = image.frame_stats.detile_ns,
+            });
+        }
+        image.frame_stats = {};
+    }
+    DebugState.PublishTextureStats(std::move(stats));
 }
 
 vk::Sampler TextureCache::GetSampler(const AmdGpu::Sampler& sampler,
                                      AmdGpu::BorderColorBuffer border_color_base) {
+    // Draws overwhelmingly rebind the same few samplers, so probe the front cache first.
+    const size_t start = static_cast<size_t>(sampler.raw0 ^ (sampler.raw1 >> 1));
+    for (size_t probe = 0; probe < NumSamplerCacheProbes; ++probe) {
+        const auto& entry = sampler_cache[(start + probe) % NumSamplerCacheEntries];
+        if (entry.handle && entry.raw0 == sampler.raw0 && entry.raw1 == sampler.raw1) {
+            return entry.handle;
+        }
+    }
     const u64 hash = XXH3_64bits(&sampler, sizeof(sampler));
     const auto [it, new_sampler] = samplers.try_emplace(hash, instance, sampler, border_color_base);
-    return it->second.Handle();
+    const auto handle = it->second.Handle();
+    // Prefer filling an empty probe slot; otherwise evict the first candidate. The map keeps
+    // the sampler objects alive, so cached handles never dangle.
+    auto* victim = &sampler_cache[start % NumSamplerCacheEntries];
+    for (size_t probe = 0; probe < NumSamplerCacheProbes; ++probe) {
+        auto& entry = sampler_cache[(start + probe) % NumSamplerCacheEntries];
+        if (!entry.handle) {
+            victim = &entry;
+            break;
+        }
+    }
+    *victim = {sampler.raw0, sampler.raw1, handle};
+    return handle;
 }
 
 void TextureCache::RegisterImage(ImageId image_id) {
@@ -821,8 +928,9 @@ void TextureCache::RegisterImage(ImageId image_id) {
     image.flags |= ImageFlagBits::Registered;
     total_used_memory += Common::AlignUp(image.info.guest_size, 1024);
     image.lru_id = lru_cache.Insert(image_id, gc_tick);
-    ForEachPage(image.info.guest_address, image.info.guest_size,
-                [this, image_id](u64 page) { page_table[page].push_back(image_id); });
+    image_ranges.add({ImageInterval::right_open(image.info.guest_address,
+                                                image.info.guest_address + image.info.guest_size),
+                      std::set<ImageId>{image_id}});
 }
 
 void TextureCache::UnregisterImage(ImageId image_id) {
@@ -832,20 +940,10 @@ void TextureCache::UnregisterImage(ImageId image_id) {
     image.flags &= ~ImageFlagBits::Registered;
     lru_cache.Free(image.lru_id);
     total_used_memory -= Common::AlignUp(image.info.guest_size, 1024);
-    ForEachPage(image.info.guest_address, image.info.guest_size, [this, image_id](u64 page) {
-        const auto page_it = page_table.find(page);
-        if (page_it == nullptr) {
-            UNREACHABLE_MSG("Unregistering unregistered page=0x{:x}", page << PageShift);
-            return;
-        }
-        auto& image_ids = *page_it;
-        const auto vector_it = std::ranges::find(image_ids, image_id);
-        if (vector_it == image_ids.end()) {
-            ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}", page << PageShift);
-            return;
-        }
-        image_ids.erase(vector_it);
-    });
+    image_ranges.subtract(
+        {ImageInterval::right_open(image.info.guest_address,
+                                   image.info.guest_address + image.info.guest_size),
+         std::set<ImageId>{image_id}});
 }
 
 void TextureCache::TrackImage(ImageId image_id) {
@@ -962,6 +1060,11 @@ void TextureCache::RunGarbageCollector() {
     };
     if (instance.CanReportMemoryUsage()) {
         total_used_memory = instance.GetDeviceMemoryUsage();
+        if (!instance.IsIntegrated() && gc_tick % GC_BUDGET_REFRESH_INTERVAL == 0) {
+            // The driver budget shrinks when other processes claim device memory, so follow
+            // it instead of trusting the construction-time snapshot forever.
+            UpdateGcThresholds(instance.GetCurrentMemoryBudget());
+        }
     }
     if (total_used_memory < trigger_gc_memory) {
         return;
@@ -985,6 +1088,12 @@ void TextureCache::RunGarbageCollector() {
         }
         --num_deletions;
         auto& image = slot_images[image_id];
+        if (image.usage.vo_surface) {
+            // Present sources are sampled directly by the presenter, which holds descriptors
+            // to their views; evicting them would leave those dangling. They are also rebound
+            // on every flip, so they never sit idle long enough to be worth collecting.
+            return false;
+        }
         const bool download = image.SafeToDownload();
         const bool tiled = image.info.IsTiled();
         if (tiled && download) {
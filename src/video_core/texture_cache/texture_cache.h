@@ -3,18 +3,20 @@
 
 #pragma once
 
+#include <array>
 #include <condition_variable>
 #include <mutex>
-#include <thread>
+#include <set>
 #include <unordered_set>
 #include <boost/container/small_vector.hpp>
+#include <boost/icl/interval_map.hpp>
 #include <queue>
 #include <tsl/robin_map.h>
 
+#include "common/adaptive_mutex.h"
 #include "common/lru_cache.h"
 #include "common/slot_vector.h"
 #include "shader_recompiler/resource.h"
-#include "video_core/multi_level_page_table.h"
 #include "video_core/texture_cache/blit_helper.h"
 #include "video_core/texture_cache/image.h"
 #include "video_core/texture_cache/image_view.h"
@@ -35,16 +37,14 @@ class TextureCache {
     static constexpr s64 DEFAULT_PRESSURE_GC_MEMORY = 1_GB + 512_MB;
     static constexpr s64 DEFAULT_CRITICAL_GC_MEMORY = 3_GB;
     static constexpr s64 TARGET_GC_THRESHOLD = 8_GB;
+    static constexpr u64 GC_BUDGET_REFRESH_INTERVAL = 256;
 
     using ImageIds = boost::container::small_vector<ImageId, 16>;
 
-    struct Traits {
-        using Entry = ImageIds;
-        static constexpr size_t AddressSpaceBits = 40;
-        static constexpr size_t FirstLevelBits = 10;
-        static constexpr size_t PageBits = 20;
-    };
-    using PageTable = MultiLevelPageTable<Traits>;
+    /// Interval index over the guest ranges of live images; overlap candidates are found in
+    /// O(log n + k) instead of scanning every image sharing a page.
+    using ImageIntervalMap = boost::icl::interval_map<VAddr, std::set<ImageId>>;
+    using ImageInterval = ImageIntervalMap::interval_type;
 
 public:
     enum class BindingType : u32 {
@@ -115,6 +115,7 @@ public:
     void UpdateImage(ImageId image_id) {
         std::scoped_lock lock{mutex};
         Image& image = slot_images[image_id];
+        ++image.frame_stats.binds;
         TrackImage(image_id);
         TouchImage(image);
         RefreshImage(image);
@@ -157,6 +158,10 @@ public:
         return surface_metas.contains(address);
     }
 
+    /// Publishes the per-image activity counters of the last frame to the devtools
+    /// heatmap and resets them. Called once per presented frame when collection is enabled.
+    void CollectFrameStats();
+
     /// Returns true if a slice of the specified metadata surface has been cleared.
     bool IsMetaCleared(VAddr address, u32 slice) const {
         const auto& it = surface_metas.find(address);
@@ -198,16 +203,12 @@ public:
         using FuncReturn = typename std::invoke_result<Func, ImageId, Image&>::type;
         static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
         ImageIds images;
-        ForEachPage(cpu_addr, size, [this, &images, cpu_addr, size, func](u64 page) {
-            const auto it = page_table.find(page);
-            if (it == nullptr) {
-                if constexpr (BOOL_BREAK) {
-                    return false;
-                } else {
-                    return;
-                }
-            }
-            for (const ImageId image_id : *it) {
+        const auto interval = ImageInterval::right_open(cpu_addr, cpu_addr + size);
+        const auto [begin, end] = image_ranges.equal_range(interval);
+        bool stop = false;
+        for (auto it = begin; it != end && !stop; ++it) {
+            // Images spanning several segments are deduplicated through the picked flag.
+            for (const ImageId image_id : it->second) {
                 Image& image = slot_images[image_id];
                 if (image.flags & ImageFlagBits::Picked) {
                     continue;
@@ -219,54 +220,33 @@ public:
                 images.push_back(image_id);
                 if constexpr (BOOL_BREAK) {
                     if (func(image_id, image)) {
-                        return true;
+                        stop = true;
+                        break;
                     }
                 } else {
                     func(image_id, image);
                 }
             }
-            if constexpr (BOOL_BREAK) {
-                return false;
-            }
-        });
+        }
         for (const ImageId image_id : images) {
             slot_images[image_id].flags &= ~ImageFlagBits::Picked;
         }
     }
 
 private:
-    /// Iterate over all page indices in a range
-    template <typename Func>
-    static void ForEachPage(PAddr addr, size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
-        const u64 page_end = (addr + size - 1) >> Traits::PageBits;
-        for (u64 page = addr >> Traits::PageBits; page <= page_end; ++page) {
-            if constexpr (RETURNS_BOOL) {
-                if (func(page)) {
-                    break;
-                }
-            } else {
-                func(page);
-            }
-        }
-    }
-
     /// Gets or creates a null image for a particular format.
     ImageId GetNullImage(vk::Format format);
 
     /// Copies image memory back to CPU.
     void DownloadImageMemory(ImageId image_id);
 
-    /// Thread function for copying downloaded images out to CPU memory.
-    void DownloadedImagesThread(const std::stop_token& token);
-
     /// Create an image from the given parameters
     [[nodiscard]] ImageId InsertImage(const ImageInfo& info, VAddr cpu_addr);
 
-    /// Register image in the page table
+    /// Register image in the interval index
     void RegisterImage(ImageId image);
 
-    /// Unregister image from the page table
+    /// Unregister image from the interval index
     void UnregisterImage(ImageId image);
 
     /// Track CPU reads and writes for image
@@ -287,10 +267,14 @@ private:
     /// Touch the image in the LRU cache.
     void TouchImage(const Image& image);
 
+    /// Derives the garbage collection thresholds from the given device memory budget.
+    void UpdateGcThresholds(u64 device_budget);
+
     void FreeImage(ImageId image_id) {
         UntrackImage(image_id);
         UnregisterImage(image_id);
         DeleteImage(image_id);
+        ++frame_evictions;
     }
 
 private:
@@ -304,6 +288,16 @@ private:
     Common::SlotVector<Image> slot_images;
     Common::SlotVector<ImageView> slot_image_views;
     tsl::robin_map<u64, Sampler> samplers;
+    /// Open-addressed front cache over the sampler map; a hit costs two u64 compares on the
+    /// raw S# words without hashing or decoding the descriptor.
+    struct SamplerCacheEntry {
+        u64 raw0;
+        u64 raw1;
+        vk::Sampler handle;
+    };
+    static constexpr size_t NumSamplerCacheEntries = 64;
+    static constexpr size_t NumSamplerCacheProbes = 4;
+    std::array<SamplerCacheEntry, NumSamplerCacheEntries> sampler_cache{};
     tsl::robin_map<vk::Format, ImageId> null_images;
     std::unordered_set<ImageId> download_images;
     u64 total_used_memory = 0;
@@ -311,9 +305,11 @@ private:
     u64 pressure_gc_memory = 0;
     u64 critical_gc_memory = 0;
     u64 gc_tick = 0;
+    u32 frame_evictions = 0;
+    bool collecting_frame_stats = false;
     Common::LeastRecentlyUsedCache<ImageId, u64> lru_cache;
-    PageTable page_table;
-    std::mutex mutex;
+    ImageIntervalMap image_ranges;
+    Common::AdaptiveSpinMutex mutex{"TextureCache"};
     struct MetaDataInfo {
         enum class Type {
             CMask,
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/div_ceil.h"
 #include "video_core/buffer_cache/buffer.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -21,9 +22,31 @@ struct TilingInfo {
     u32 bank_swizzle;
     u32 num_slices;
     u32 num_mips;
+    u32 num_texels;
     std::array<ImageInfo::MipInfo, 16> mips;
 };
 
+// Maps a bits-per-pixel count to a pipeline slot; 96bpp needs its own slot as it shares a
+// bit width with 64bpp.
+static u32 BppIndex(u32 num_bits) {
+    switch (num_bits) {
+    case 8:
+        return 0;
+    case 16:
+        return 1;
+    case 32:
+        return 2;
+    case 64:
+        return 3;
+    case 96:
+        return 4;
+    case 128:
+        return 5;
+    default:
+        UNREACHABLE_MSG("Invalid bits per pixel = {}", num_bits);
+    }
+}
+
 TileManager::TileManager(const Vulkan::Instance& instance, Vulkan::Scheduler& scheduler,
                          StreamBuffer& stream_buffer_)
     : instance{instance}, scheduler{scheduler}, stream_buffer{stream_buffer_} {
@@ -73,9 +96,24 @@ TileManager::TileManager(const Vulkan::Instance& instance, Vulkan::Scheduler& sc
     pl_layout = std::move(layout);
 }
 
-TileManager::~TileManager() = default;
+TileManager::~TileManager() {
+    for (const auto& slot : scratch_slots) {
+        vmaDestroyBuffer(instance.GetAllocator(), slot.buffer, slot.allocation);
+    }
+}
+
+vk::Buffer TileManager::GetScratchBuffer(u32 size) {
+    // Recycle a large enough buffer whose previous GPU use has completed. Sizes are rounded
+    // to the next power of two so buffers are shared between similarly sized images.
+    size = std::bit_ceil(size);
+    const auto* semaphore = scheduler.GetMasterSemaphore();
+    for (auto& slot : scratch_slots) {
+        if (slot.size >= size && semaphore->IsFree(slot.tick)) {
+            slot.tick = scheduler.CurrentTick();
+            return slot.buffer;
+        }
+    }
 
-TileManager::ScratchBuffer TileManager::GetScratchBuffer(u32 size) {
     constexpr auto usage =
         vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eStorageBuffer |
         vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst;
@@ -95,11 +133,24 @@ TileManager::ScratchBuffer TileManager::GetScratchBuffer(u32 size) {
     const auto result = vmaCreateBuffer(instance.GetAllocator(), &buffer_ci_unsafe, &alloc_info,
                                         &buffer, &allocation, nullptr);
     ASSERT(result == VK_SUCCESS);
-    return {buffer, allocation};
+    scratch_slots.push_back({buffer, allocation, size, scheduler.CurrentTick()});
+
+    // Keep the pool bounded; drop the first completed buffer when it grows too large.
+    constexpr size_t MaxScratchSlots = 8;
+    if (scratch_slots.size() > MaxScratchSlots) {
+        for (auto it = scratch_slots.begin(); it != scratch_slots.end(); ++it) {
+            if (semaphore->IsFree(it->tick)) {
+                vmaDestroyBuffer(instance.GetAllocator(), it->buffer, it->allocation);
+                scratch_slots.erase(it);
+                break;
+            }
+        }
+    }
+    return buffer;
 }
 
 vk::Pipeline TileManager::GetTilingPipeline(const ImageInfo& info, bool is_tiler) {
-    const u32 pl_id = u32(info.tile_mode) * NUM_BPPS + std::bit_width(info.num_bits) - 4;
+    const u32 pl_id = u32(info.tile_mode) * NUM_BPPS + BppIndex(info.num_bits);
     auto& tiling_pipelines = is_tiler ? tilers : detilers;
     if (auto pipeline = *tiling_pipelines[pl_id]; pipeline != VK_NULL_HANDLE) {
         return pipeline;
@@ -171,6 +222,7 @@ TileManager::Result TileManager::DetileImage(vk::Buffer in_buffer, u32 in_offset
     params.bank_swizzle = info.bank_swizzle;
     params.num_slices = info.props.is_volume ? info.size.depth : info.resources.layers;
     params.num_mips = info.resources.levels;
+    params.num_texels = info.guest_size / (info.num_bits / 8);
     for (u32 mip = 0; mip < params.num_mips; ++mip) {
         auto& mip_info = params.mips[mip];
         mip_info = info.mips_layout[mip];
@@ -186,10 +238,7 @@ TileManager::Result TileManager::DetileImage(vk::Buffer in_buffer, u32 in_offset
         .range = sizeof(params),
     };
 
-    const auto [out_buffer, out_allocation] = GetScratchBuffer(info.guest_size);
-    scheduler.DeferOperation([this, out_buffer, out_allocation]() {
-        vmaDestroyBuffer(instance.GetAllocator(), out_buffer, out_allocation);
-    });
+    const auto out_buffer = GetScratchBuffer(info.guest_size);
 
     scheduler.EndRendering();
 
@@ -236,7 +285,9 @@ TileManager::Result TileManager::DetileImage(vk::Buffer in_buffer, u32 in_offset
     }};
     cmdbuf.pushDescriptorSetKHR(vk::PipelineBindPoint::eCompute, *pl_layout, 0, set_writes);
 
-    const auto dim_x = (info.guest_size / (info.num_bits / 8)) / 64;
+    // Round up so the last partial workgroup still covers the image tail; the shader bounds
+    // the invocation against the texel count.
+    const auto dim_x = Common::DivCeil(info.guest_size / (info.num_bits / 8), 64u);
     cmdbuf.dispatch(dim_x, 1, 1);
     return {out_buffer, 0};
 }
@@ -256,6 +307,7 @@ void TileManager::TileImage(Image& in_image, std::span<vk::BufferImageCopy> buff
     params.bank_swizzle = info.bank_swizzle;
     params.num_slices = info.props.is_volume ? info.size.depth : info.resources.layers;
     params.num_mips = static_cast<u32>(buffer_copies.size());
+    params.num_texels = info.guest_size / (info.num_bits / 8);
     for (u32 mip = 0; mip < params.num_mips; ++mip) {
         auto& mip_info = params.mips[mip];
         mip_info = info.mips_layout[mip];
@@ -271,10 +323,7 @@ void TileManager::TileImage(Image& in_image, std::span<vk::BufferImageCopy> buff
         .range = sizeof(params),
     };
 
-    const auto [temp_buffer, temp_allocation] = GetScratchBuffer(info.guest_size);
-    scheduler.DeferOperation([this, temp_buffer, temp_allocation]() {
-        vmaDestroyBuffer(instance.GetAllocator(), temp_buffer, temp_allocation);
-    });
+    const auto temp_buffer = GetScratchBuffer(info.guest_size);
 
     const auto cmdbuf = scheduler.CommandBuffer();
     in_image.Download(buffer_copies, temp_buffer, 0, copy_size);
@@ -321,7 +370,9 @@ void TileManager::TileImage(Image& in_image, std::span<vk::BufferImageCopy> buff
     }};
     cmdbuf.pushDescriptorSetKHR(vk::PipelineBindPoint::eCompute, *pl_layout, 0, set_writes);
 
-    const auto dim_x = (info.guest_size / (info.num_bits / 8)) / 64;
+    // Round up so the last partial workgroup still covers the image tail; the shader bounds
+    // the invocation against the texel count.
+    const auto dim_x = Common::DivCeil(info.guest_size / (info.num_bits / 8), 64u);
     cmdbuf.dispatch(dim_x, 1, 1);
 }
 
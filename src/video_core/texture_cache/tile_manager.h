@@ -14,10 +14,9 @@ struct Image;
 class StreamBuffer;
 
 class TileManager {
-    static constexpr size_t NUM_BPPS = 5;
+    static constexpr size_t NUM_BPPS = 6;
 
 public:
-    using ScratchBuffer = std::pair<vk::Buffer, VmaAllocation>;
     using Result = std::pair<vk::Buffer, u32>;
 
     explicit TileManager(const Vulkan::Instance& instance, Vulkan::Scheduler& scheduler,
@@ -30,8 +29,16 @@ public:
     Result DetileImage(vk::Buffer in_buffer, u32 in_offset, const ImageInfo& info);
 
 private:
+    /// One reusable scratch buffer; tick is the timeline value of its last GPU use.
+    struct ScratchSlot {
+        vk::Buffer buffer;
+        VmaAllocation allocation;
+        u32 size;
+        u64 tick;
+    };
+
     vk::Pipeline GetTilingPipeline(const ImageInfo& info, bool is_tiler);
-    ScratchBuffer GetScratchBuffer(u32 size);
+    vk::Buffer GetScratchBuffer(u32 size);
 
 private:
     const Vulkan::Instance& instance;
@@ -41,6 +48,7 @@ private:
     vk::UniquePipelineLayout pl_layout;
     std::array<vk::UniquePipeline, AmdGpu::NUM_TILE_MODES * NUM_BPPS> detilers{};
     std::array<vk::UniquePipeline, AmdGpu::NUM_TILE_MODES * NUM_BPPS> tilers{};
+    std::vector<ScratchSlot> scratch_slots;
 };
 
 } // namespace VideoCore